@@ -3,6 +3,7 @@
 #define EFONT_AFM_HH
 #include <efont/metrics.hh>
 class Slurper;
+class String;
 class Filename;
 class ErrorHandler;
 namespace Efont {
@@ -43,6 +44,8 @@ class AfmReader { public:
 
     double &fd(int i)                           { return _afm->fd(i); }
     GlyphIndex find_err(PermString, const char *) const;
+    GlyphIndex find_err(const HashMap<String, GlyphIndex> &,
+                        const char *, int) const;
 
     void read_char_metric_data() const;
     void read_char_metrics() const;
@@ -4,6 +4,7 @@
 #include <lcdf/slurper.hh>
 #include <lcdf/permstr.hh>
 #include <stdarg.h>
+#include <ctype.h>
 namespace Efont {
 
 class AfmParser { public:
@@ -20,6 +21,7 @@ class AfmParser { public:
     int fail_field() const              { return _fail_field; }
     PermString message() const          { return _message; }
     void clear_message()                { _message = PermString(); }
+    void clear_match()                  { _fail_field = -1; clear_message(); }
 
     PermString keyword() const;
     bool is(const char *, ...);
@@ -30,10 +32,20 @@ class AfmParser { public:
     void skip_until(unsigned char);
 
     unsigned char *cur_line() const     { return _pos; }
+    void set_cur_line(unsigned char *s) { _pos = s; }
     unsigned char first() const         { return _pos[0]; }
     unsigned char operator[](int i) const { return _pos[i]; }
     bool left() const                   { return *_pos != 0; }
 
+    // Hand-written equivalents of vis() conversions, for hot lines.  Each
+    // scans from s, advancing s on success.  Use set_cur_line() to commit.
+    static bool scan_space(unsigned char *&s);          // ` '
+    static inline void skip_space(unsigned char *&s);   // `-'
+    static bool scan_integer(unsigned char *&s, int &); // `%d'
+    static bool scan_number(unsigned char *&s, double &); // `%g'
+    static bool scan_name(unsigned char *&s, PermString &); // `%/s'
+    static bool scan_name(unsigned char *&s, const char *&, int &);
+
   private:
 
     Slurper &_slurper;
@@ -53,6 +65,12 @@ class AfmParser { public:
 };
 
 
+inline void AfmParser::skip_space(unsigned char *&s)
+{
+    while (isspace(*s))
+        s++;
+}
+
 inline bool AfmParser::next_line()
 {
     _pos = _line = (unsigned char *)_slurper.next_line();
@@ -63,6 +63,11 @@ class AmfmMetrics { public:
 
     Metrics *interpolate(const Vector<double> &design,
                          const Vector<double> &weight, ErrorHandler *);
+    // Interpolate one instance per design vector.  instances[i] is null if
+    // designs[i]'s masters could not be loaded.
+    void interpolate(const Vector<Vector<double> > &designs,
+                     const Vector<Vector<double> > &weights,
+                     Vector<Metrics *> &instances, ErrorHandler *);
 
   private:
 
@@ -102,6 +107,8 @@ class AmfmMetrics { public:
     AmfmPrimaryFont *find_primary_font(const Vector<double> &design) const;
 
     Metrics *master(int, ErrorHandler *);
+    Metrics *make_instance(const Vector<double> &design,
+                           const Metrics &master) const;
 
 };
 
@@ -0,0 +1,112 @@
+// -*- related-file-name: "../../libefont/catalog.cc" -*-
+#ifndef EFONT_CATALOG_HH
+#define EFONT_CATALOG_HH
+#include <efont/otf.hh>
+class StringAccum;
+namespace Efont {
+
+// A UnicodeCoverage is the set of code points a font maps, stored as a
+// bitmap of the 256-code-point pages that contain at least one of them.
+class UnicodeCoverage { public:
+
+    UnicodeCoverage()                   : _count(0) { }
+    // default destructor
+
+    void assign(const Vector<uint32_t> &sorted_codes);
+
+    int count() const                   { return _count; }
+    bool contains(uint32_t code) const;
+
+    // Store inclusive ranges [first, last] in a flattened vector.
+    void ranges(Vector<uint32_t> &ranges) const;
+
+    enum { PAGE_SHIFT = 8, PAGE_BYTES = 32 };
+
+  private:
+
+    int _count;
+    Vector<uint32_t> _pages;
+    String _bits;
+
+    friend class FontCatalog;
+
+};
+
+// A CatalogFace summarizes one face of a font file.
+class CatalogFace { public:
+
+    CatalogFace();
+    // default destructor
+
+    enum { O_CFF = 0, O_TRUETYPE, O_TYPE1 };
+    enum { N_POSTSCRIPT = 0, N_FAMILY, N_SUBFAMILY, N_FULLNAME,
+           N_PREF_FAMILY, N_PREF_SUBFAMILY, N_VERSION, NNAMES };
+
+    int face;                   // index within a collection, or -1
+    int outlines;
+    String names[NNAMES];
+
+    // Language systems ("latn", "latn.DEU") in sorted order.
+    Vector<String> scripts;
+    // Sorted (script tag, feature tag) pairs, flattened.
+    Vector<uint32_t> script_features;
+
+    // Optical size information, in points.  design_size is nonzero if the
+    // font has a GPOS 'size' feature; size_range is nonzero if the font
+    // specifies a range (from its 'size' feature or OS/2 table).
+    double design_size;
+    double size_range[2];
+    int size_subfamily_id;
+    String size_subfamily_name;
+
+    UnicodeCoverage unicode;
+
+    bool has_script(OpenType::Tag script, OpenType::Tag langsys = OpenType::Tag()) const;
+    bool has_feature(OpenType::Tag feature, OpenType::Tag script = OpenType::Tag()) const;
+    void features(Vector<OpenType::Tag> &) const;
+
+    static const char *outlines_name(int outlines);
+
+};
+
+struct CatalogFile {
+    String filename;
+    uint64_t mtime;
+    uint64_t size;
+    String checksum;
+    Vector<CatalogFace> faces;
+    CatalogFile()                       : mtime(0), size(0) { }
+};
+
+// A FontCatalog records the faces of a set of font files, and can be saved
+// to and loaded from an index file.  OpenType fonts and collections are
+// read in parallel (see lcdf/parallel.hh), reading only their table
+// directories and the tables the catalog needs; Type 1 fonts are read on
+// the calling thread.
+class FontCatalog { public:
+
+    FontCatalog()                       { }
+    // default destructor
+
+    int nfiles() const                  { return _files.size(); }
+    const CatalogFile &file(int i) const { return _files[i]; }
+
+    int read(const String &filename, ErrorHandler * = 0);
+    int write(const String &filename, ErrorHandler * = 0) const;
+
+    // Make the catalog describe exactly the named files.  A file whose
+    // size and modification time are unchanged, or whose table directory
+    // checksum is unchanged, is not read again.  Returns the number of
+    // files read.
+    int refresh(const Vector<String> &filenames, ErrorHandler * = 0);
+
+    enum { MAGIC = 0x4C464354, FORMAT_VERSION = 1 };
+
+  private:
+
+    Vector<CatalogFile> _files;
+
+};
+
+}
+#endif
@@ -123,6 +123,7 @@ class Cff { public:
     IndexIterator _strings_index;
     mutable Vector<PermString> _strings;
     mutable HashMap<PermString, int> _strings_map;
+    mutable bool _strings_interned;
 
     IndexIterator _gsubrs_index;
     Vector<Charstring*> _gsubrs_cs;
@@ -131,6 +132,7 @@ class Cff { public:
     unsigned _units_per_em;
 
     int parse_header(ErrorHandler *);
+    void intern_strings() const;
 
     enum { HEADER_SIZE = 4 };
 
@@ -265,6 +267,7 @@ class Cff::CIDFont : public Cff::FontParent { public:
     Charstring *glyph(int) const;
     Charstring *glyph(PermString) const;
     int glyphid(PermString) const;
+    void glyphids(const Vector<PermString> &, Vector<int> &) const;
     const CharstringProgram *child_program(int) const;
 
     bool dict_has(DictOperator) const;
@@ -354,6 +357,7 @@ class Cff::Font : public Cff::ChildFont { public:
     Charstring *glyph(int) const;
     Charstring *glyph(PermString) const;
     int glyphid(PermString) const;
+    void glyphids(const Vector<PermString> &, Vector<int> &) const;
 
     Type1Encoding *type1_encoding() const;
     Type1Encoding *type1_encoding_copy() const;
@@ -369,6 +373,7 @@ class Cff::Font : public Cff::ChildFont { public:
     PermString _font_name;
 
     Cff::Charset _charset;
+    mutable HashMap<PermString, int> _glyph_map;
 
     IndexIterator _charstrings_index;
     mutable Vector<Charstring *> _charstrings_cs;
@@ -378,6 +383,7 @@ class Cff::Font : public Cff::ChildFont { public:
     mutable Type1Encoding *_t1encoding;
 
     int parse_encoding(int pos, ErrorHandler *);
+    void make_glyph_map() const;
     int assign_standard_encoding(const int *standard_encoding);
 
     inline const Dict &dict_of(DictOperator) const;
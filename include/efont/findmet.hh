@@ -4,6 +4,7 @@
 #include <lcdf/hashmap.hh>
 #include <lcdf/vector.hh>
 #include <lcdf/permstr.hh>
+#include <lcdf/string.hh>
 class Filename;
 class ErrorHandler;
 namespace Efont {
@@ -30,6 +31,11 @@ class MetricsFinder { public:
     virtual void record(Metrics *, PermString);
     virtual void record(AmfmMetrics *);
 
+    // Read an AFM file.  A finder in the chain, such as a
+    // PersistentMetricsFinder, may supply the metrics instead.
+    Metrics *read_metrics_file(const Filename &, ErrorHandler *);
+    virtual bool read_metrics_file_x(const Filename &, Metrics *&, ErrorHandler *);
+
   private:
 
     MetricsFinder *_next;
@@ -68,6 +74,28 @@ class CacheMetricsFinder: public MetricsFinder { public:
 };
 
 
+// A PersistentMetricsFinder keeps compiled copies of the AFM files read
+// through its chain in a cache directory.  A compiled copy replaces the AFM
+// file as long as the file's device, inode, size, and modification time are
+// unchanged; loading it skips parsing and most allocation.
+class PersistentMetricsFinder: public MetricsFinder { public:
+
+    PersistentMetricsFinder(const String &directory);
+
+    bool read_metrics_file_x(const Filename &, Metrics *&, ErrorHandler *);
+
+    static String compile(const Metrics *, const String &source_key);
+    static Metrics *load(const String &data, const String &source_key);
+
+    enum { MAGIC = 0x4C464D43, FORMAT_VERSION = 1 };
+
+  private:
+
+    String _directory;
+
+};
+
+
 class InstanceMetricsFinder: public MetricsFinder { public:
 
     InstanceMetricsFinder(bool call_mmpfb = true);
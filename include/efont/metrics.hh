@@ -72,6 +72,13 @@ class Metrics { public:
     inline int add_kv(double d);
 
     void interpolate_dimens(const Metrics &, double, bool increment);
+    // Set each instance's dimensions as if by interpolate_dimens() from
+    // every master, where weights[i][m] weights masters[m] for
+    // instances[i].  A master with zero weight in every instance may be
+    // null.
+    static void interpolate_dimens(const Vector<Metrics *> &instances,
+                                   const Vector<Metrics *> &masters,
+                                   const Vector<Vector<double> > &weights);
 
     // PAIR PROGRAM
 
@@ -115,6 +122,8 @@ class Metrics { public:
 
     unsigned _uses;
 
+    friend class PersistentMetricsFinder;
+
 };
 
 
@@ -5,6 +5,7 @@
 #include <efont/otfdata.hh>
 namespace Efont { namespace OpenType {
 class GsubLookup;
+class GsubLigatureTrie;
 class Substitution;
 
 class Gsub { public:
@@ -18,6 +19,8 @@ class Gsub { public:
 
     int nlookups() const;
     GsubLookup lookup(unsigned) const;
+    bool apply(int lookup, const Glyph *, int pos, int n, Substitution &) const;
+    void closure(Vector<bool> &glyphs, const Vector<int> &lookups) const;
 
     enum { HEADERSIZE = 10 };
 
@@ -28,6 +31,15 @@ class Gsub { public:
     Data _lookup_list;
     bool _chaincontext_reverse_backtrack;
 
+    // Ligature lookups compiled on first use.  _ligature_trie_state[i] is
+    // 0 until a thread claims lookup i, 1 while that thread compiles it, and
+    // 2 once _ligature_tries[i] is ready.  Other threads apply the lookup
+    // uncompiled in the meantime, so apply() may run on several threads.
+    mutable Vector<Vector<GsubLigatureTrie> > _ligature_tries;
+    mutable Vector<int> _ligature_trie_state;
+
+    const Vector<GsubLigatureTrie> *ligature_tries(int i, const GsubLookup &) const;
+
 };
 
 class GsubLookup { public:
@@ -37,15 +49,22 @@ class GsubLookup { public:
     void mark_out_glyphs(const Gsub &gsub, Vector<bool> &gmap) const;
     bool unparse_automatics(const Gsub &gsub, Vector<Substitution> &subs, const Coverage &limit) const;
     bool apply(const Glyph *, int pos, int n, Substitution &) const;
+    int nsubtables() const              { return _d.u16(4); }
+    Data subtable(int i) const;
+    int mark_filtering_set() const;
     enum {
         HEADERSIZE = 6, RECSIZE = 2,
         L_SINGLE = 1, L_MULTIPLE = 2, L_ALTERNATE = 3, L_LIGATURE = 4,
         L_CONTEXT = 5, L_CHAIN = 6, L_EXTENSION = 7, L_REVCHAIN = 8
     };
+    enum {
+        F_RIGHT_TO_LEFT = 0x0001, F_IGNORE_BASE_GLYPHS = 0x0002,
+        F_IGNORE_LIGATURES = 0x0004, F_IGNORE_MARKS = 0x0008,
+        F_USE_MARK_FILTERING_SET = 0x0010, F_MARK_ATTACHMENT_TYPE = 0xFF00
+    };
   private:
     Data _d;
     int _type;
-    Data subtable(int i) const;
 };
 
 class GsubSingle { public:
@@ -88,6 +107,34 @@ class GsubLigature { public:
            LIG_HEADERSIZE = 4, LIG_RECSIZE = 2 };
   private:
     Data _d;
+    friend class GsubLigatureTrie;
+};
+
+class GsubLigatureTrie { public:
+    GsubLigatureTrie()                  : _nligatures(0) { }
+    GsubLigatureTrie(const GsubLigature &);
+    // default destructor
+
+    int nligatures() const              { return _nligatures; }
+
+    // Nodes are numbered from 1; -1 means no match.
+    inline int start(Glyph) const;
+    inline int next(int node, Glyph) const;
+    Glyph output(int node) const        { return _nodes[node].output; }
+    int order(int node) const           { return _nodes[node].order; }
+
+    bool apply(const Glyph *, int pos, int n, Substitution &) const;
+
+  private:
+    struct Node {
+        Glyph glyph;
+        int child_begin;
+        int child_end;
+        Glyph output;
+        int order;              // position in the subtable, -1 if none
+    };
+    Vector<Node> _nodes;        // _nodes[0] is the root
+    int _nligatures;
 };
 
 class GsubContext { public:
@@ -127,10 +174,98 @@ class GsubChainContext { public:
     bool f3_unparse(const Gsub &gsub, Vector<Substitution> &subs, const Coverage &limit) const;
 };
 
+class GsubShaper { public:
+
+    GsubShaper(const Gsub &, const Font &, ErrorHandler * = 0);
+    // default destructor
+
+    void shape(Vector<Glyph> &glyphs, Vector<int> &clusters,
+               const Vector<int> &lookups) const;
+    void apply_lookup(int lookup, Vector<Glyph> &glyphs,
+                      Vector<int> &clusters) const;
+
+    int alternate() const               { return _alternate; }
+    void set_alternate(int i)           { _alternate = i; }
+
+    enum { GC_BASE = 1, GC_LIGATURE = 2, GC_MARK = 3, GC_COMPONENT = 4,
+           MAX_NESTING = 16, MAX_LENGTH = 1 << 20 };
+
+  private:
+
+    struct Subtable {
+        Data d;
+        int format;
+        Coverage coverage;
+        ClassDef backtrack_class;
+        ClassDef input_class;
+        ClassDef lookahead_class;
+        Vector<Coverage> backtrack;
+        Vector<Coverage> input;
+        Vector<Coverage> lookahead;
+        GsubLigatureTrie ligatures;
+        int records_offset;
+        int nrecords;
+        Subtable(int type, const Data &d);
+    };
+
+    struct LookupInfo {
+        int type;
+        int flags;
+        int mark_set;
+        Vector<Subtable> subtables;
+    };
+
+    struct Matcher {
+        const Data *d;
+        int offset;
+        const ClassDef *classes;
+        const Vector<Coverage> *coverages;
+        Matcher(const Data &d_, int offset_, const ClassDef *classes_ = 0)
+            : d(&d_), offset(offset_), classes(classes_), coverages(0) { }
+        Matcher(const Vector<Coverage> &coverages_)
+            : d(0), offset(0), classes(0), coverages(&coverages_) { }
+        inline bool match(int i, Glyph g) const;
+    };
+
+    Vector<LookupInfo> _lookups;
+    ClassDef _glyph_class;
+    ClassDef _mark_class;
+    Vector<Coverage> _mark_sets;
+    bool _reverse_backtrack;
+    int _alternate;
+
+    bool skip(const LookupInfo &, Glyph) const;
+    int next_position(const LookupInfo &, const Vector<Glyph> &, int) const;
+    int prev_position(const LookupInfo &, const Vector<Glyph> &, int) const;
+    bool apply_at(int lookup, Vector<Glyph> &, Vector<int> &, int pos,
+                  int &next, int depth) const;
+    bool apply_ligature(const LookupInfo &, const Subtable &,
+                        Vector<Glyph> &, Vector<int> &, int pos) const;
+    bool apply_context(const LookupInfo &, const Subtable &, int ci,
+                       Vector<Glyph> &, Vector<int> &, int pos,
+                       int &next, int depth) const;
+    bool apply_chain(const LookupInfo &, const Subtable &, int ci,
+                     Vector<Glyph> &, Vector<int> &, int pos,
+                     int &next, int depth) const;
+    bool apply_rule(const LookupInfo &, Vector<Glyph> &, Vector<int> &,
+                    int pos, int nbacktrack, const Matcher &backtrack,
+                    int ninput, const Matcher &input,
+                    int nlookahead, const Matcher &lookahead,
+                    const Data &records, int records_offset, int nrecords,
+                    int &next, int depth) const;
+    void apply_reverse(const LookupInfo &, Vector<Glyph> &) const;
+    static void replace(Vector<Glyph> &, Vector<int> &, int pos,
+                        const Glyph *out, int nout);
+
+};
+
 class Substitution { public:
 
     Substitution();
     Substitution(const Substitution &);
+#if __cplusplus >= 201103L
+    inline Substitution(Substitution &&) noexcept;
+#endif
 
     // single substitution
     Substitution(Glyph in, Glyph out);
@@ -149,6 +284,9 @@ class Substitution { public:
     ~Substitution();
 
     Substitution &operator=(const Substitution &);
+#if __cplusplus >= 201103L
+    Substitution &operator=(Substitution &&) noexcept;
+#endif
 
     bool context_in(const Coverage &) const;
     bool context_in(const GlyphSet &) const;
@@ -189,6 +327,7 @@ class Substitution { public:
 
     inline int out_nglyphs() const;
     inline Glyph right_glyph() const;
+    inline int right_nglyphs() const;
     inline Glyph *right_glyphptr();
     inline const Glyph *right_glyphptr() const;
 
@@ -250,9 +389,28 @@ class Substitution { public:
 };
 
 inline Substitution::Substitution()
-    : _left_is(T_NONE), _in_is(T_NONE), _out_is(T_NONE), _right_is(T_NONE)
+    : _left_is(T_NONE), _in_is(T_NONE), _out_is(T_NONE), _right_is(T_NONE),
+      _alternate(false)
+{
+}
+
+#if __cplusplus >= 201103L
+inline Substitution::Substitution(Substitution &&o) noexcept
+    : _left_is(o._left_is), _in_is(o._in_is), _out_is(o._out_is),
+      _right_is(o._right_is), _alternate(o._alternate)
 {
+    // Substitutes whose type is T_NONE are never initialized.
+    if (_left_is != T_NONE)
+        _left = o._left;
+    if (_in_is != T_NONE)
+        _in = o._in;
+    if (_out_is != T_NONE)
+        _out = o._out;
+    if (_right_is != T_NONE)
+        _right = o._right;
+    o._left_is = o._in_is = o._out_is = o._right_is = T_NONE;
 }
+#endif
 
 /* Single 1: u16 format, offset coverage, u16 glyphdelta
    Single 2: u16 format, offset coverage, u16 count, glyph subst[]
@@ -365,6 +523,11 @@ inline Glyph Substitution::right_glyph() const
     return extract_glyph(_right, _right_is);
 }
 
+inline int Substitution::right_nglyphs() const
+{
+    return extract_nglyphs(_right, _right_is, false);
+}
+
 inline const Glyph *Substitution::left_glyphptr() const
 {
     return extract_glyphptr(_left, _left_is);
@@ -405,6 +568,26 @@ inline Glyph *Substitution::right_glyphptr()
     return extract_glyphptr(_right, _right_is);
 }
 
+inline int GsubLigatureTrie::next(int node, Glyph g) const
+{
+    int l = _nodes[node].child_begin, r = _nodes[node].child_end;
+    while (l < r) {
+        int m = l + (r - l) / 2;
+        if (g < _nodes[m].glyph)
+            r = m;
+        else if (g == _nodes[m].glyph)
+            return m;
+        else
+            l = m + 1;
+    }
+    return -1;
+}
+
+inline int GsubLigatureTrie::start(Glyph g) const
+{
+    return _nodes.size() ? next(0, g) : -1;
+}
+
 inline StringAccum &operator<<(StringAccum &sa, const Substitution &sub)
 {
     sub.unparse(sa);
@@ -412,4 +595,10 @@ inline StringAccum &operator<<(StringAccum &sa, const Substitution &sub)
 }
 
 }}
+
+// Substitutions own their glyph arrays and coverages through plain pointers.
+template <> struct Vector_relocatable<Efont::OpenType::Substitution> {
+    enum { value = 1 };
+};
+
 #endif
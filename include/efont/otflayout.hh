@@ -0,0 +1,59 @@
+// -*- related-file-name: "../../libefont/otflayout.cc" -*-
+#ifndef EFONT_OTFLAYOUT_HH
+#define EFONT_OTFLAYOUT_HH
+#include <efont/otfgsub.hh>
+#include <efont/otfgpos.hh>
+namespace Efont { namespace OpenType {
+
+// A LayoutSnapshot is a compact binary copy of a font's decoded GSUB and
+// GPOS layout: the raw ScriptList and FeatureList of each table, plus the
+// flattened substitutions or positionings of every lookup that can be
+// flattened independently of the glyphs in use.  Contextual lookups are
+// not flattened; callers unparse them from the font as usual.  Snapshots
+// are big-endian and contain only offsets, so they can be read in place.
+
+class LayoutSnapshot { public:
+
+    LayoutSnapshot()                    { }
+    LayoutSnapshot(const String &str, const String &font_key);
+    // default destructor
+
+    static String make(const Font &otf, ErrorHandler * = 0);
+    static String font_key(const Font &otf);
+    static String key_text(const String &font_key);
+
+    bool ok() const                     { return _str.length() > 0; }
+    const String &data() const          { return _str; }
+
+    enum { T_GSUB = 0, T_GPOS = 1, NTABLES = 2 };
+
+    bool has_table(int t) const;
+    ScriptList script_list(int t) const;
+    FeatureList feature_list(int t) const;
+    int nlookups(int t) const;
+
+    // Append a lookup's flattened substitutions or positionings to the
+    // vector and return true, or return false if the lookup must be
+    // unparsed from the font.  Single substitutions are limited to input
+    // glyphs in limit, as GsubLookup::unparse_automatics would do.
+    bool unparse(int lookup, Vector<Substitution> &, const Coverage &limit, bool &understood) const;
+    bool unparse(int lookup, Vector<Positioning> &, bool &understood) const;
+
+    enum { MAGIC = 0x4F544C53, FORMAT_VERSION = 2, HEADERSIZE = 32,
+           LENGTH_OFFSET = 24, CHECKSUM_OFFSET = 28,
+           TABLE_RECSIZE = 4, TABLE_HEADERSIZE = 18, LOOKUP_RECSIZE = 12,
+           POSITION_SIZE = 10, POSITIONING_SIZE = 22 };
+    enum { LF_FLATTENED = 1, LF_UNDERSTOOD = 2 };
+    enum { EF_PAIR = 1 };
+
+  private:
+
+    String _str;
+
+    Data table(int t) const;
+    Data lookup_record(int t, int lookup) const;
+
+};
+
+}}
+#endif
@@ -2,6 +2,7 @@
 #ifndef PAIROP_HH
 #define PAIROP_HH
 #include <efont/encoding.hh> /* get GlyphIndex */
+#include <lcdf/hashmap.hh>
 namespace Efont {
 
 enum PairOpDefs {
@@ -59,12 +60,13 @@ class PairOp { public:
 
 class PairProgram { public:
 
-    PairProgram()                               : _reversed(false) { }
+    PairProgram()                       : _reversed(false), _index(-1), _index_valid(false) { }
     PairProgram(const PairProgram &);
 
     void reserve_glyphs(int);
 
     PairOpIndex find_left(GlyphIndex gi) const  { return _left_map[gi]; }
+    // Return the first op for the pair in leftgi's list.
     PairOpIndex find(GlyphIndex leftgi, GlyphIndex rightgi) const;
 
     int op_count() const                        { return _op.size(); }
@@ -74,6 +76,10 @@ class PairProgram { public:
     bool add_kern(GlyphIndex, GlyphIndex, int);
     bool add_lig(GlyphIndex, GlyphIndex, GlyphIndex, int kind = opLigSimple);
 
+    // Add many ops at once, as if by add_kern() or add_lig() on each in
+    // turn.  Afterwards each left glyph's ops are stored contiguously.
+    void add_ops(const Vector<PairOp> &ops);
+
     void set_reversed(bool r)                   { _reversed = r; }
     void unreverse();
     void optimize();
@@ -82,12 +88,34 @@ class PairProgram { public:
 
   private:
 
+    struct Key {
+        GlyphIndex left;
+        GlyphIndex right;
+        Key()                                   : left(-1), right(-1) { }
+        Key(GlyphIndex l, GlyphIndex r)         : left(l), right(r) { }
+        bool operator==(const Key &k) const {
+            return left == k.left && right == k.right;
+        }
+        friend hashcode_t hashcode(const Key &k) {
+            return (hashcode_t) k.left * 0x10001U + (hashcode_t) k.right;
+        }
+    };
+
     bool _reversed;
     Vector<PairOpIndex> _left_map;
     Vector<PairOp> _op;
 
+    // (left, right) -> first op for the pair, built on first use.
+    mutable HashMap<Key, PairOpIndex> _index;
+    mutable bool _index_valid;
+
+    void make_index() const;
+    void add_op(const PairOp &);
+
     inline const char *print_name(GlyphIndex) const;
 
+    friend class PersistentMetricsFinder;
+
     PairProgram &operator=(const PairProgram &) { assert(0); return *this; }
 
 };
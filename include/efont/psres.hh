@@ -14,6 +14,11 @@ class PsresDatabase { public:
     PsresDatabase();
     ~PsresDatabase();
 
+    // If a cache directory is set, add_psres_path() keeps a compiled copy
+    // of the database it reads there.  Later calls with the same path use
+    // the copy until a PSres.upr file or a path directory changes.
+    void set_cache_directory(const String& dir) { _cache_directory = dir; }
+
     void add_psres_path(const char* path, const char* defaults, bool override);
     bool add_psres_file(Filename&, bool override);
     void add_database(PsresDatabase*, bool override);
@@ -23,14 +28,31 @@ class PsresDatabase { public:
     const String& unescaped_value(PermString section, PermString key) const;
     Filename filename_value(PermString section, PermString key) const;
 
+    enum { MAGIC = 0x4C465052, FORMAT_VERSION = 1 };
+
   private:
 
     HashMap<PermString, int> _section_map;
-    Vector<PsresDatabaseSection*> _sections;
+    mutable Vector<PsresDatabaseSection*> _sections;
+
+    String _cache_directory;
+    Vector<String> _dependencies;
+
+    // Sections read from a cache are created on first use.
+    String _cache_data;
+    void* _cache_map;
+    size_t _cache_map_len;
+    Vector<uint32_t> _section_pos;
 
     PsresDatabaseSection* force_section(PermString);
+    PsresDatabaseSection* load_section(int) const;
     bool add_one_psres_file(Slurper&, bool override);
     void add_psres_directory(PermString);
+    void read_psres_path(const char* path, const char* defaults);
+
+    void add_dependency(const String&);
+    bool read_cache(const String& filename, const String& key);
+    void write_cache(const String& filename, const String& key);
 
 };
 
@@ -43,8 +65,8 @@ class PsresDatabaseSection { public:
     void add_psres_file_section(Slurper&, PermString, bool);
     void add_section(PsresDatabaseSection*, bool override);
 
-    const String& value(PermString key)         { return value(_map[key]); }
-    inline const String& unescaped_value(PermString key) const;
+    const String& value(PermString key)         { return value(find(key)); }
+    inline const String& unescaped_value(PermString key);
     Filename filename_value(PermString key);
 
   private:
@@ -55,19 +77,30 @@ class PsresDatabaseSection { public:
     Vector<String> _values;
     Vector<int> _value_escaped;
 
+    // A section read from a cache looks keys up in the cache's hash table
+    // and copies entries into _map on first use.
+    String _cache;
+    uint32_t _cache_pos;
+
     const String& value(int index);
+    int find(PermString key);
+    void load_all();
+
+    friend class PsresDatabase;
 
 };
 
 inline PsresDatabaseSection* PsresDatabase::section(PermString n) const
 {
-    return _sections[_section_map[n]];
+    int i = _section_map[n];
+    return _sections[i] || !i ? _sections[i] : load_section(i);
 }
 
-inline const String& PsresDatabaseSection::unescaped_value(PermString key) const
+inline const String& PsresDatabaseSection::unescaped_value(PermString key)
 {
-    assert(!_value_escaped[_map[key]]);
-    return _values[_map[key]];
+    int index = find(key);
+    assert(!_value_escaped[index]);
+    return _values[index];
 }
 
 }
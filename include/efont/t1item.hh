@@ -249,11 +249,13 @@ inline Type1Definition *Type1Definition::make(PermString n, double v, PermString
 inline void Type1Definition::set_val(const String &v)
 {
     _val = v;
+    _val.c_str();               // the value_* parsers need a '\0'
 }
 
 inline void Type1Definition::set_val(StringAccum &sa)
 {
     _val = sa.take_string();
+    _val.c_str();
 }
 
 inline void Type1Encoding::put(int e, PermString glyph)
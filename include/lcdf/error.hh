@@ -280,7 +280,11 @@ class ErrorHandler { public:
      *
      * @sa account, clear */
     int nerrors() const {
+#if HAVE_ATOMIC_BUILTINS
+	return __atomic_load_n(&_nerrors, __ATOMIC_RELAXED);
+#else
 	return _nerrors;
+#endif
     }
 
 
@@ -436,7 +440,11 @@ class ErrorHandler { public:
      *
      * The default implementation sets the nerrors() counter to zero. */
     virtual void clear() {
+#if HAVE_ATOMIC_BUILTINS
+	__atomic_store_n(&_nerrors, 0, __ATOMIC_RELAXED);
+#else
 	_nerrors = 0;
+#endif
     }
 
 
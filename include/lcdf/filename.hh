@@ -38,4 +38,6 @@ class Filename { public:
 
 };
 
+int replace_file(const String &filename, const String &data, int mode = -1);
+
 #endif
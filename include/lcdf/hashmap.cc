@@ -2,7 +2,7 @@
 #define LCDF_HASHMAP_CC
 
 /*
- * hashmap.{cc,hh} -- simple open-coded hash table class
+ * hashmap.{cc,hh} -- Robin Hood open-addressing hash table class
  * Eddie Kohler
  *
  * Copyright (c) 1999-2000 Massachusetts Institute of Technology
@@ -23,49 +23,65 @@
 
 template <class K, class V>
 HashMap<K, V>::HashMap()
-    : _capacity(0), _grow_limit(0), _n(0), _e(0), _default_value()
+    : _capacity(0), _grow_limit(0), _n(0), _shift(0), _e(0), _dist(0),
+      _default_value()
 {
-    increase(-1);
 }
 
 template <class K, class V>
 HashMap<K, V>::HashMap(const V &def)
-    : _capacity(0), _grow_limit(0), _n(0), _e(0), _default_value(def)
+    : _capacity(0), _grow_limit(0), _n(0), _shift(0), _e(0), _dist(0),
+      _default_value(def)
 {
-    increase(-1);
 }
 
 
 template <class K, class V>
 HashMap<K, V>::HashMap(const HashMap<K, V> &m)
     : _capacity(m._capacity), _grow_limit(m._grow_limit), _n(m._n),
-      _e(new Pair[m._capacity]), _default_value(m._default_value)
+      _shift(m._shift), _e(m._capacity ? new Pair[m._capacity] : 0),
+      _dist(m._capacity ? new unsigned short[m._capacity] : 0),
+      _default_value(m._default_value)
 {
     for (int i = 0; i < _capacity; i++)
-	_e[i] = m._e[i];
+	if ((_dist[i] = m._dist[i]))
+	    _e[i] = m._e[i];
 }
 
+#if __cplusplus >= 201103L
+template <class K, class V>
+HashMap<K, V>::HashMap(HashMap<K, V> &&m) noexcept
+    : _capacity(m._capacity), _grow_limit(m._grow_limit), _n(m._n),
+      _shift(m._shift), _e(m._e), _dist(m._dist),
+      _default_value(std::move(m._default_value))
+{
+    m._capacity = m._grow_limit = m._n = m._shift = 0;
+    m._e = 0;
+    m._dist = 0;
+}
+#endif
+
 
 template <class K, class V>
 HashMap<K, V> &
 HashMap<K, V>::operator=(const HashMap<K, V> &o)
 {
-    // This works with self-assignment.
-
-    _capacity = o._capacity;
-    _grow_limit = o._grow_limit;
-    _n = o._n;
-    _default_value = o._default_value;
-
-    Pair *new_e = new Pair[_capacity];
-    for (int i = 0; i < _capacity; i++)
-	new_e[i] = o._e[i];
-
-    delete[] _e;
-    _e = new_e;
+    if (&o != this) {
+	HashMap<K, V> copy(o);
+	swap(copy);
+    }
+    return *this;
+}
 
+#if __cplusplus >= 201103L
+template <class K, class V>
+HashMap<K, V> &
+HashMap<K, V>::operator=(HashMap<K, V> &&o) noexcept
+{
+    swap(o);
     return *this;
 }
+#endif
 
 
 template <class K, class V>
@@ -73,104 +89,200 @@ void
 HashMap<K, V>::increase(int min_size)
 {
     int ncap = (_capacity < 8 ? 8 : _capacity * 2);
-    while (ncap < min_size && ncap > 0)
+    while (ncap - (ncap >> 2) < min_size && ncap > 0)
 	ncap *= 2;
     if (ncap <= 0)		// want too many elements
 	return;
 
     Pair *ne = new Pair[ncap];
-    if (!ne)			// out of memory
-	return;
+    unsigned short *nd = new unsigned short[ncap];
+    std::fill(nd, nd + ncap, 0);
 
     Pair *oe = _e;
+    unsigned short *od = _dist;
     int ocap = _capacity;
     _e = ne;
+    _dist = nd;
     _capacity = ncap;
-    _grow_limit = ((3 * _capacity) >> 2) - 1;
+    _grow_limit = ncap - (ncap >> 2);
+    _shift = sizeof(hashcode_t) * 8;
+    for (int c = ncap; c > 1; c >>= 1)
+	_shift--;
 
-    Pair *otrav = oe;
-    for (int i = 0; i < ocap; i++, otrav++)
-	if (otrav->key) {
-	    int j = bucket(otrav->key);
-	    _e[j] = *otrav;
+    // Starting just after an empty slot visits entries in nearly home
+    // bucket order, so make_slot() rarely has to shift.
+    int start = 0;
+    while (start < ocap && od[start])
+	start++;
+    for (int k = 0; k < ocap; k++) {
+	int i = (start + 1 + k) & (ocap - 1);
+	if (od[i]) {
+	    int j = make_slot(hashcode(oe[i].key));
+	    _e[j] = LCDF_HASHMAP_MOVE(oe[i]);
 	}
+    }
 
     delete[] oe;
+    delete[] od;
+}
+
+// Returns a free slot for a new entry whose key has hashcode hc and is not
+// in the table.  Entries stay ordered by home bucket, so the rest of the
+// cluster shifts forward one slot.
+template <class K, class V>
+int
+HashMap<K, V>::make_slot(hashcode_t hc)
+{
+    int mask = _capacity - 1;
+    int i = home(hc);
+    unsigned d = 1;
+    while (_dist[i] >= d)
+	i = (i + 1) & mask, ++d;
+    return make_slot(i, d, hc);
 }
 
+// Frees slot i, which is where an entry with probe distance d belongs.
 template <class K, class V>
-inline void
-HashMap<K, V>::check_capacity()
+int
+HashMap<K, V>::make_slot(int i, unsigned d, hashcode_t hc)
 {
-    if (_n >= _grow_limit)
+    int mask = _capacity - 1;
+    int j = i;
+    while (_dist[j] && _dist[j] < max_dist)
+	j = (j + 1) & mask;
+    if (d >= max_dist || _dist[j]) {
+	// Probe distance too long to record.
+	int ocap = _capacity;
 	increase(-1);
+	assert(_capacity > ocap);
+	return make_slot(hc);
+    }
+    while (j != i) {
+	int k = (j - 1) & mask;
+	_e[j] = LCDF_HASHMAP_MOVE(_e[k]);
+	_dist[j] = _dist[k] + 1;
+	j = k;
+    }
+    _dist[i] = d;
+    return i;
+}
+
+// Returns key's slot.  If key is new, adds it, leaving the slot's value
+// for the caller to assign.
+template <class K, class V>
+int
+HashMap<K, V>::force_slot(const K &key, bool &is_new)
+{
+    hashcode_t hc = hashcode(key);
+    if (_n >= _grow_limit) {
+	int i = slot(key, hc);
+	if ((is_new = i < 0))
+	    increase(-1);
+	else
+	    return i;
+    }
+
+    int mask = _capacity - 1;
+    int i = home(hc);
+    unsigned d = 1;
+    for (; _dist[i] >= d; i = (i + 1) & mask, ++d)
+	if (_dist[i] == d && _e[i].key == key) {
+	    is_new = false;
+	    return i;
+	}
+
+    i = make_slot(i, d, hc);
+    _e[i].key = key;
+    _n++;
+    is_new = true;
+    return i;
 }
 
 template <class K, class V>
 bool
 HashMap<K, V>::insert(const K &key, const V &val)
 {
-    check_capacity();
-    int i = bucket(key);
-    bool is_new = !(bool)_e[i].key;
-    _e[i].key = key;
+    bool is_new;
+    int i = force_slot(key, is_new);
     _e[i].value = val;
-    _n += is_new;
     return is_new;
 }
 
+#if __cplusplus >= 201103L
+template <class K, class V>
+bool
+HashMap<K, V>::insert(const K &key, V &&val)
+{
+    bool is_new;
+    int i = force_slot(key, is_new);
+    _e[i].value = std::move(val);
+    return is_new;
+}
+#endif
+
 template <class K, class V>
 V &
 HashMap<K, V>::find_force(const K &key, const V &value)
 {
-    check_capacity();
-    int i = bucket(key);
-    if (!(bool)_e[i].key) {
-	_e[i].key = key;
+    bool is_new;
+    int i = force_slot(key, is_new);
+    if (is_new)
 	_e[i].value = value;
-	_n++;
-    }
     return _e[i].value;
 }
 
+template <class K, class V>
+bool
+HashMap<K, V>::erase(const K &key)
+{
+    int i = slot(key, hashcode(key));
+    if (i < 0)
+	return false;
+    int mask = _capacity - 1;
+    int j = (i + 1) & mask;
+    while (_dist[j] > 1) {
+	_e[i] = LCDF_HASHMAP_MOVE(_e[j]);
+	_dist[i] = _dist[j] - 1;
+	i = j;
+	j = (j + 1) & mask;
+    }
+    _e[i] = Pair();
+    _dist[i] = 0;
+    _n--;
+    return true;
+}
+
 template <class K, class V>
 void
 HashMap<K, V>::clear()
 {
     delete[] _e;
+    delete[] _dist;
     _e = 0;
-    _capacity = _grow_limit = _n = 0;
-    increase(-1);
+    _dist = 0;
+    _capacity = _grow_limit = _n = _shift = 0;
 }
 
 template <class K, class V>
 void
 HashMap<K, V>::swap(HashMap<K, V> &o)
 {
-    int capacity = _capacity;
-    int grow_limit = _grow_limit;
-    int n = _n;
-    Pair *e = _e;
-    V default_value = _default_value;
-    _capacity = o._capacity;
-    _grow_limit = o._grow_limit;
-    _n = o._n;
-    _e = o._e;
-    _default_value = o._default_value;
-    o._capacity = capacity;
-    o._grow_limit = grow_limit;
-    o._n = n;
-    o._e = e;
-    o._default_value = default_value;
+    std::swap(_capacity, o._capacity);
+    std::swap(_grow_limit, o._grow_limit);
+    std::swap(_n, o._n);
+    std::swap(_shift, o._shift);
+    std::swap(_e, o._e);
+    std::swap(_dist, o._dist);
+    std::swap(_default_value, o._default_value);
 }
 
 template <class K, class V>
 _HashMap_const_iterator<K, V>::_HashMap_const_iterator(const HashMap<K, V> *hm, int pos)
     : _hm(hm), _pos(pos)
 {
-    typename HashMap<K, V>::Pair *e = _hm->_e;
+    const unsigned short *dist = _hm->_dist;
     int capacity = _hm->_capacity;
-    while (_pos < capacity && !(bool)e[_pos].key)
+    while (_pos < capacity && !dist[_pos])
 	_pos++;
 }
 
@@ -178,9 +290,9 @@ template <class K, class V>
 void
 _HashMap_const_iterator<K, V>::operator++(int)
 {
-    typename HashMap<K, V>::Pair *e = _hm->_e;
+    const unsigned short *dist = _hm->_dist;
     int capacity = _hm->_capacity;
-    for (_pos++; _pos < capacity && !(bool)e[_pos].key; _pos++)
+    for (_pos++; _pos < capacity && !dist[_pos]; _pos++)
 	;
 }
 
@@ -1,14 +1,18 @@
 #ifndef LCDF_HASHMAP_HH
 #define LCDF_HASHMAP_HH
 #include <assert.h>
+#include <algorithm>
 #include <lcdf/hashcode.hh>
+#if __cplusplus >= 201103L
+# include <utility>
+# define LCDF_HASHMAP_MOVE(x) std::move(x)
+#else
+# define LCDF_HASHMAP_MOVE(x) (x)
+#endif
 
 // K AND V REQUIREMENTS:
 //
 //		K::K()
-//		K::operator bool() const
-//			Must have (bool)(K()) == false
-//			and no k with (bool)k == false is stored.
 // K &		K::operator=(const K &)
 //		k1 == k2
 // hashcode_t	hashcode(const K &)
@@ -17,6 +21,17 @@
 //
 //		V::V()
 // V &		V::operator=(const V &)
+//			Or, in C++11, V::operator=(V &&); copy assignment is
+//			then needed only by the functions that copy values.
+//
+// HashMap is an open-addressing table using Robin Hood linear probing.  A
+// short per slot records the slot's distance from its entry's home bucket,
+// so lookups scan a compact array and compare keys only at slots whose
+// distance matches.  Entries in a cluster stay sorted by home bucket:
+// insertion shifts later entries forward, and erase() shifts them back
+// rather than leaving tombstones.  Shifting and rehashing move entries
+// (copying them before C++11), so erase() and any insertion invalidate
+// iterators and pointers returned by findp().
 
 template <class K, class V> class _HashMap_const_iterator;
 template <class K, class V> class _HashMap_iterator;
@@ -27,7 +42,10 @@ class HashMap { public:
     HashMap();
     explicit HashMap(const V &);
     HashMap(const HashMap<K, V> &);
-    ~HashMap()				{ delete[] _e; }
+#if __cplusplus >= 201103L
+    HashMap(HashMap<K, V> &&) noexcept;
+#endif
+    ~HashMap()				{ delete[] _e; delete[] _dist; }
 
     int size() const			{ return _n; }
     bool empty() const			{ return _n == 0; }
@@ -49,13 +67,27 @@ class HashMap { public:
     V &find_force(const K &, const V &);
     inline V &find_force(const K &);
 
+    // Look up a key of another type L, such as a const char * for a String
+    // key.  Requires hashcode(L) consistent with hashcode(K) and K == L.
+    template <class L> inline const V &find_like(const L &) const;
+    template <class L> inline V *findp_like(const L &) const;
+
     bool insert(const K &, const V &);
+#if __cplusplus >= 201103L
+    bool insert(const K &, V &&);
+#endif
+    bool erase(const K &);
     void clear();
 
     HashMap<K, V> &operator=(const HashMap<K, V> &);
+#if __cplusplus >= 201103L
+    HashMap<K, V> &operator=(HashMap<K, V> &&) noexcept;
+#endif
     void swap(HashMap<K, V> &);
 
-    void resize(int size)		{ increase(size); }
+    // Make room for n entries without rehashing.
+    void reserve(int n)			{ if (n > _grow_limit) increase(n); }
+    void resize(int n)			{ reserve(n); }
 
     struct Pair {
 	K key;
@@ -65,15 +97,22 @@ class HashMap { public:
 
   private:
 
+    enum { max_dist = 65535 };
+
     int _capacity;
     int _grow_limit;
     int _n;
+    int _shift;
     Pair *_e;
+    unsigned short *_dist;		// 0 if empty, else probe distance + 1
     V _default_value;
 
     void increase(int);
-    inline void check_capacity();
-    inline int bucket(const K &) const;
+    inline int home(hashcode_t) const;
+    template <class L> inline int slot(const L &, hashcode_t) const;
+    int make_slot(hashcode_t);
+    int make_slot(int, unsigned, hashcode_t);
+    int force_slot(const K &, bool &);
 
     friend class _HashMap_const_iterator<K, V>;
     friend class _HashMap_iterator<K, V>;
@@ -120,26 +159,39 @@ class _HashMap_iterator : public _HashMap_const_iterator<K, V> { public:
 
 template <class K, class V>
 inline int
-HashMap<K, V>::bucket(const K &key) const
+HashMap<K, V>::home(hashcode_t hc) const
 {
-    assert(key);
-    hashcode_t hc = hashcode(key);
-    int i =   hc       & (_capacity - 1);
-    int j = ((hc >> 6) & (_capacity - 1)) | 1;
-
-    while (_e[i].key && !(_e[i].key == key))
-	i = (i + j) & (_capacity - 1);
+    // Fibonacci hashing: many hashcode() functions, such as PermString's,
+    // leave the low bits nearly constant.
+    const hashcode_t mult = (sizeof(hashcode_t) > 4
+			     ? (hashcode_t) 0x9E3779B97F4A7C15ULL
+			     : (hashcode_t) 0x9E3779B9U);
+    return (int) ((hc * mult) >> _shift);
+}
 
-    return i;
+template <class K, class V>
+template <class L>
+inline int
+HashMap<K, V>::slot(const L &key, hashcode_t hc) const
+{
+    if (_n == 0)
+	return -1;
+    int mask = _capacity - 1;
+    int i = home(hc);
+    // An entry equal to key has the same home bucket, and therefore the
+    // same distance at every slot; a shorter distance ends the search.
+    for (unsigned d = 1; _dist[i] >= d; i = (i + 1) & mask, ++d)
+	if (_dist[i] == d && _e[i].key == key)
+	    return i;
+    return -1;
 }
 
 template <class K, class V>
 inline const V &
 HashMap<K, V>::find(const K &key) const
 {
-    int i = bucket(key);
-    const V *v = (_e[i].key ? &_e[i].value : &_default_value);
-    return *v;
+    int i = slot(key, hashcode(key));
+    return i >= 0 ? _e[i].value : _default_value;
 }
 
 template <class K, class V>
@@ -153,8 +205,26 @@ template <class K, class V>
 inline V *
 HashMap<K, V>::findp(const K &key) const
 {
-    int i = bucket(key);
-    return _e[i].key ? &_e[i].value : 0;
+    int i = slot(key, hashcode(key));
+    return i >= 0 ? &_e[i].value : 0;
+}
+
+template <class K, class V>
+template <class L>
+inline const V &
+HashMap<K, V>::find_like(const L &key) const
+{
+    int i = slot(key, hashcode(key));
+    return i >= 0 ? _e[i].value : _default_value;
+}
+
+template <class K, class V>
+template <class L>
+inline V *
+HashMap<K, V>::findp_like(const L &key) const
+{
+    int i = slot(key, hashcode(key));
+    return i >= 0 ? &_e[i].value : 0;
 }
 
 template <class K, class V>
@@ -0,0 +1,49 @@
+// -*- related-file-name: "../../liblcdf/parallel.cc" -*-
+#ifndef LCDF_PARALLEL_HH
+#define LCDF_PARALLEL_HH
+#include <lcdf/error.hh>
+#include <lcdf/vector.hh>
+
+extern int parallel_jobs;
+
+// A ParallelTask is a set of independent work items, numbered 0 through
+// n-1.  Each worker calls thread_begin() once, run() for every item it
+// claims, and thread_end() once.  Workers may share const Strings and the
+// Efont objects that read through them (Font, Data, Coverage, Gsub, Gpos);
+// run_parallel() uses threads only when String reference counts are atomic.
+// ErrorHandler conversions must be registered before any worker starts.
+class ParallelTask { public:
+
+    virtual ~ParallelTask()             { }
+
+    virtual void *thread_begin(bool threaded) = 0;
+    virtual void run(int item, void *thread) = 0;
+    virtual void thread_end(void *thread) = 0;
+
+};
+
+// Runs items 0 through n-1 of task, using up to parallel_jobs threads but
+// at least min_items items per thread.  Runs serially on this thread if
+// parallel_jobs is 0 or 1 or threads are unavailable.  Returns after every
+// item has run.
+void run_parallel(ParallelTask &task, int n, int min_items = 1);
+
+int default_parallel_jobs();
+
+// Collects messages on a worker thread for replay on the main thread.
+// Fatal messages do not exit until they are replayed.
+class DeferredErrorHandler : public ErrorHandler { public:
+
+    DeferredErrorHandler()              { }
+
+    String decorate(const String &str);
+    void account(int level);
+    void replay(ErrorHandler *errh) const;
+
+  private:
+
+    Vector<String> _messages;
+
+};
+
+#endif
@@ -22,7 +22,14 @@ class Slurper { public:
     char *append_next_line();
     void save_line()			{ _saved_line = true; }
 
-    char *cur_line() const		{ return (char *)_line; }
+    // Returns the next line without a terminating null character; its
+    // length is cur_line_length().  A Slurper that mapped its file into
+    // memory returns a pointer into the mapping, so nothing is copied.
+    // The view lasts until the next call that reads a line.
+    const char *next_line_view();
+
+    inline char *cur_line();
+    const char *cur_line_view() const	{ return (const char *)_line; }
     unsigned cur_line_length() const	{ return _line_len; }
     void shorten_line(unsigned);
 
@@ -43,20 +50,37 @@ class Slurper { public:
 
     bool _saved_line;
     bool _at_eof;
+    bool _line_is_view;
 
+    const unsigned char *_map;		// file contents if mapped, else null
+    unsigned _map_len;
+
+    void map_file();
     void grow_buffer();
     inline int more_data();
     char *get_line_at(unsigned);
+    const char *get_view();
+    void reserve_data(unsigned);
+    void copy_view();
 
 };
 
 
+inline char *
+Slurper::cur_line()
+{
+  if (_line_is_view)
+    copy_view();
+  return (char *)_line;
+}
+
 inline void
 Slurper::shorten_line(unsigned pos)
 {
   if (pos < _line_len) {
     _line_len = pos;
-    _line[_line_len] = 0;
+    if (!_line_is_view)
+      _line[_line_len] = 0;
   }
 }
 
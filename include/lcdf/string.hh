@@ -6,6 +6,7 @@
 # include <lcdf/permstr.hh>
 #endif
 #include <assert.h>
+#include <string.h>
 class StringAccum;
 
 class String { public:
@@ -20,6 +21,14 @@ class String { public:
 	assign(x);
     }
 
+#if __cplusplus >= 201103L
+    /** @brief Construct a String by moving @a x, which becomes empty. */
+    inline String(String &&x) noexcept
+	: _r(x._r) {
+	x.assign_memo(&null_data, 0, 0);
+    }
+#endif
+
     /** @brief Construct a String containing the C string @a cstr.
      * @param cstr a null-terminated C string
      * @return A String containing the characters of @a cstr, up to but not
@@ -257,9 +266,15 @@ class String { public:
 	// We may already have a '\0' in the right place.  If _memo has no
 	// capacity, then this is one of the special strings (null or
 	// stable). We are guaranteed, in these strings, that _data[_length]
-	// exists. Otherwise must check that _data[_length] exists.
+	// exists. Otherwise must check that _data[_length] exists.  If
+	// other Strings share the memo, one of them may have claimed
+	// _data[_length] but not yet written it, so we must not read it.
 	const char *end_data = _r.data + _r.length;
-	if ((_r.memo && end_data >= _r.memo->real_data + _r.memo->dirty)
+	if ((_r.memo && (end_data >= _r.memo->real_data + memo_dirty(_r.memo)
+#if HAVE_ATOMIC_BUILTINS
+			 || memo_refcount(_r.memo) > 1
+#endif
+			 ))
 	    || *end_data != '\0') {
 	    if (char *x = const_cast<String *>(this)->append_uninitialized(1)) {
 		*x = '\0';
@@ -470,6 +485,18 @@ class String { public:
 	return *this;
     }
 
+#if __cplusplus >= 201103L
+    /** @brief Move @a x into this string; @a x becomes empty. */
+    inline String &operator=(String &&x) noexcept {
+	if (&x != this) {
+	    deref();
+	    _r = x._r;
+	    x.assign_memo(&null_data, 0, 0);
+	}
+	return *this;
+    }
+#endif
+
     /** @brief Assign this string to the C string @a cstr. */
     inline String &operator=(const char *cstr) {
 	assign(cstr, -1, true);
@@ -554,7 +581,7 @@ class String { public:
     // String operator+(String, const char *);
     // String operator+(const char *, const String &);
     // String operator+(String, PermString);
-    // String operator+(PermString, String);
+    // String operator+(PermString, const String &);
     // String operator+(PermString, const char *);
     // String operator+(const char *, PermString);
     // String operator+(PermString, PermString);
@@ -563,7 +590,7 @@ class String { public:
 
     /** @brief Return true iff the String's data is shared or immutable. */
     inline bool data_shared() const {
-	return !_r.memo || _r.memo->refcount != 1;
+	return !_r.memo || memo_refcount(_r.memo) != 1;
     }
 
     /** @brief Return a compact version of this String.
@@ -571,7 +598,7 @@ class String { public:
      * The compact version shares no more than 256 bytes of data with any
      * other non-stable String. */
     inline String compact() const {
-	if (!_r.memo || _r.memo->refcount == 1
+	if (!_r.memo || memo_refcount(_r.memo) == 1
 	    || (uint32_t) _r.length + 256 >= _r.memo->capacity)
 	    return *this;
 	else
@@ -682,11 +709,45 @@ class String { public:
     static void one_profile_report(StringAccum &sa, int i, int examples);
 #endif
 
+    // With HAVE_ATOMIC_BUILTINS, memos may be shared between threads.
+    static inline uint32_t memo_refcount(const memo_t *memo) {
+#if HAVE_ATOMIC_BUILTINS
+	return __atomic_load_n(&memo->refcount, __ATOMIC_ACQUIRE);
+#else
+	return memo->refcount;
+#endif
+    }
+
+    static inline uint32_t memo_dirty(const memo_t *memo) {
+#if HAVE_ATOMIC_BUILTINS
+	return __atomic_load_n(&memo->dirty, __ATOMIC_ACQUIRE);
+#else
+	return memo->dirty;
+#endif
+    }
+
+    static inline void memo_ref(memo_t *memo) {
+#if HAVE_ATOMIC_BUILTINS
+	__atomic_add_fetch(&memo->refcount, 1, __ATOMIC_RELAXED);
+#else
+	++memo->refcount;
+#endif
+    }
+
+    // Returns true if this was the last reference.
+    static inline bool memo_deref(memo_t *memo) {
+#if HAVE_ATOMIC_BUILTINS
+	return __atomic_sub_fetch(&memo->refcount, 1, __ATOMIC_ACQ_REL) == 0;
+#else
+	return --memo->refcount == 0;
+#endif
+    }
+
     inline void assign_memo(const char *data, int length, memo_t *memo) const {
 	_r.data = data;
 	_r.length = length;
 	if ((_r.memo = memo))
-	    ++memo->refcount;
+	    memo_ref(memo);
     }
 
     inline String(const char *data, int length, memo_t *memo) {
@@ -698,7 +759,7 @@ class String { public:
     }
 
     inline void deref() const {
-	if (_r.memo && --_r.memo->refcount == 0)
+	if (_r.memo && memo_deref(_r.memo))
 	    delete_memo(_r.memo);
     }
 
@@ -863,7 +924,7 @@ inline String operator+(String a, PermString b) {
     return a;
 }
 
-inline String operator+(PermString a, String b) {
+inline String operator+(PermString a, const String &b) {
     return String(a) + b;
 }
 
@@ -881,8 +942,22 @@ inline String operator+(PermString a, PermString b) {
 
 #endif
 
+/** @cond never */
+template <class T> struct Vector_relocatable;
+template <> struct Vector_relocatable<String> {
+    enum { value = 1 };
+};
+/** @endcond never */
+
 inline hashcode_t hashcode(const String &str) {
     return str.hashcode();
 }
 
+/** @brief Hash a C string consistently with hashcode(const String &).
+ *
+ * Lets HashMap<String, V>::find_like() look up C strings directly. */
+inline hashcode_t hashcode(const char *s) {
+    return String::hashcode(s, s + strlen(s));
+}
+
 #endif
@@ -91,14 +91,18 @@ Vector<T>::insert(iterator it, const T &x)
 #ifdef VALGRIND_MAKE_MEM_UNDEFINED
     VALGRIND_MAKE_MEM_UNDEFINED(velt(_n), sizeof(T));
 #endif
-    for (iterator j = end(); j > it; ) {
-	--j;
-	new((void*) (j + 1)) T(*j);
-	j->~T();
+    if (Vector_relocatable<T>::value)
+	memmove((void*) (it + 1), (void*) it, (end() - it) * sizeof(T));
+    else
+	for (iterator j = end(); j > it; ) {
+	    --j;
+	    new((void*) (j + 1)) T(LCDF_VECTOR_MOVE(*j));
+	    j->~T();
+	}
 #ifdef VALGRIND_MAKE_MEM_UNDEFINED
-	VALGRIND_MAKE_MEM_UNDEFINED(j, sizeof(T));
+    if (it < end())
+	VALGRIND_MAKE_MEM_UNDEFINED(it, sizeof(T));
 #endif
-    }
     new((void*) it) T(x);
     _n++;
     return it;
@@ -109,16 +113,15 @@ Vector<T>::erase(iterator a, iterator b)
 {
     if (b > a) {
 	assert(a >= begin() && b <= end());
-	iterator i = a, j = b;
-	for (; j < end(); i++, j++) {
-	    i->~T();
-#ifdef VALGRIND_MAKE_MEM_UNDEFINED
-	    VALGRIND_MAKE_MEM_UNDEFINED(i, sizeof(T));
-#endif
-	    new((void*) i) T(*j);
-	}
-	for (; i < end(); i++)
+	for (iterator i = a; i < b; i++)
 	    i->~T();
+	if (Vector_relocatable<T>::value)
+	    memmove((void*) a, (void*) b, (end() - b) * sizeof(T));
+	else
+	    for (iterator i = a, j = b; j < end(); i++, j++) {
+		new((void*) i) T(LCDF_VECTOR_MOVE(*j));
+		j->~T();
+	    }
 	_n -= b - a;
 #ifdef VALGRIND_MAKE_MEM_NOACCESS
 	VALGRIND_MAKE_MEM_NOACCESS(_l + _n, (b - a) * sizeof(T));
@@ -131,11 +134,6 @@ Vector<T>::erase(iterator a, iterator b)
 template <class T> bool
 Vector<T>::reserve_and_push_back(size_type want, const T *push_x)
 {
-    if (push_x && push_x >= begin() && push_x < end()) {
-	T x_copy(*push_x);
-	return reserve_and_push_back(want, &x_copy);
-    }
-
     if (want < 0)
 	want = (_capacity > 0 ? _capacity * 2 : 4);
 
@@ -143,25 +141,60 @@ Vector<T>::reserve_and_push_back(size_type want, const T *push_x)
 	T *new_l = (T *)new unsigned char[sizeof(T) * want];
 	if (!new_l)
 	    return false;
+	size_type new_n = _n + (push_x ? 1 : 0);
 #ifdef VALGRIND_MAKE_MEM_NOACCESS
-	VALGRIND_MAKE_MEM_NOACCESS(new_l + _n, (want - _n) * sizeof(T));
+	VALGRIND_MAKE_MEM_NOACCESS(new_l + new_n, (want - new_n) * sizeof(T));
 #endif
 
-	for (size_type i = 0; i < _n; i++) {
-	    new(velt(new_l, i)) T(_l[i]);
-	    _l[i].~T();
-	}
+	// Copy *push_x before relocating: it may be one of our elements.
+	if (push_x)
+	    new(velt(new_l, _n)) T(*push_x);
+	relocate(new_l, _l, _n);
 	delete[] (unsigned char *)_l;
 
 	_l = new_l;
+	_n = new_n;
 	_capacity = want;
-    }
-
-    if (push_x)
+    } else if (push_x)
 	push_back(*push_x);
     return true;
 }
 
+// Moves n elements from src to the uninitialized, nonoverlapping dst,
+// leaving src uninitialized.  Elements are moved rather than copied if that
+// cannot throw.
+template <class T> void
+Vector<T>::relocate(T *dst, T *src, size_type n)
+{
+    if (Vector_relocatable<T>::value) {
+	if (n)
+	    memcpy((void*) dst, (void*) src, n * sizeof(T));
+    } else
+	for (size_type i = 0; i < n; i++) {
+#if __cplusplus >= 201103L
+	    new(velt(dst, i)) T(std::move_if_noexcept(src[i]));
+#else
+	    new(velt(dst, i)) T(src[i]);
+#endif
+	    src[i].~T();
+	}
+}
+
+template <class T> void
+Vector<T>::shrink_to_fit()
+{
+    if (_capacity > _n) {
+	T *new_l = 0;
+	if (_n) {
+	    new_l = (T *)new unsigned char[sizeof(T) * _n];
+	    relocate(new_l, _l, _n);
+	}
+	delete[] (unsigned char *)_l;
+	_l = new_l;
+	_capacity = _n;
+    }
+}
+
 template <class T> void
 Vector<T>::resize(size_type n, const T &x)
 {
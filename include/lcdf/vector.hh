@@ -12,6 +12,31 @@ static inline void *operator new(size_t, void *v) { return v; }
 #if HAVE_VALGRIND && HAVE_VALGRIND_MEMCHECK_H
 # include <valgrind/memcheck.h>
 #endif
+#include <string.h>
+#if __cplusplus >= 201103L
+# include <type_traits>
+# include <utility>
+# define LCDF_VECTOR_MOVE(x) std::move(x)
+#else
+# define LCDF_VECTOR_MOVE(x) (x)
+#endif
+
+// Vector_relocatable<T>::value is true if a T may be moved to a new address
+// with memcpy, abandoning the original without destroying it.  Vector
+// relocates such elements in bulk when it grows, inserts, and erases.
+// Specialize it for types that only own memory through pointers, such as
+// String and Vector itself.
+template <class T> struct Vector_relocatable {
+#if __cplusplus >= 201103L
+    enum { value = std::is_trivially_copyable<T>::value };
+#else
+    enum { value = 0 };
+#endif
+};
+template <class T> class Vector;
+template <class T> struct Vector_relocatable<Vector<T> > {
+    enum { value = 1 };
+};
 
 template <class T>
 class Vector { public:
@@ -38,9 +63,23 @@ class Vector { public:
     }
     // template <class In> ...
     Vector(const Vector<T> &x);
+#if __cplusplus >= 201103L
+    Vector(Vector<T> &&x) noexcept
+	: _l(x._l), _n(x._n), _capacity(x._capacity) {
+	x._l = 0;
+	x._n = x._capacity = 0;
+    }
+#endif
     ~Vector();
 
     Vector<T>& operator=(const Vector<T>&);
+#if __cplusplus >= 201103L
+    Vector<T>& operator=(Vector<T> &&x) noexcept {
+	Vector<T> tmp(std::move(x));
+	swap(tmp);
+	return *this;
+    }
+#endif
     Vector<T>& assign(size_type n, const T& e = T());
     // template <class In> ...
 
@@ -56,6 +95,7 @@ class Vector { public:
     size_type capacity() const		{ return _capacity; }
     bool empty() const			{ return _n == 0; }
     bool reserve(size_type n)		{ return reserve_and_push_back(n, 0); }
+    void shrink_to_fit();
 
     // element access
     T &operator[](size_type i) {
@@ -77,6 +117,10 @@ class Vector { public:
 
     // modifiers
     inline void push_back(const T& x);
+#if __cplusplus >= 201103L
+    inline void push_back(T&& x);
+    template <class... A> inline void emplace_back(A&&... args);
+#endif
     inline void pop_back();
     inline void push_front(const T& x);
     inline void pop_front();
@@ -95,6 +139,7 @@ class Vector { public:
     void *velt(size_type i) const		{ return (void *)&_l[i]; }
     static void *velt(T *l, size_type i)	{ return (void *)&l[i]; }
     bool reserve_and_push_back(size_type n, const T *x);
+    static void relocate(T *dst, T *src, size_type n);
 
 };
 
@@ -111,6 +156,31 @@ Vector<T>::push_back(const T& x)
 	reserve_and_push_back(RESERVE_GROW, &x);
 }
 
+#if __cplusplus >= 201103L
+template <class T> inline void
+Vector<T>::push_back(T&& x)
+{
+    emplace_back(std::move(x));
+}
+
+template <class T> template <class... A> inline void
+Vector<T>::emplace_back(A&&... args)
+{
+    if (_n < _capacity) {
+# ifdef VALGRIND_MAKE_MEM_UNDEFINED
+	VALGRIND_MAKE_MEM_UNDEFINED(velt(_n), sizeof(T));
+# endif
+	new(velt(_n)) T(std::forward<A>(args)...);
+	++_n;
+    } else {
+	// Construct first: args may refer to elements.
+	T x(std::forward<A>(args)...);
+	if (reserve_and_push_back(RESERVE_GROW, 0))
+	    emplace_back(std::move(x));
+    }
+}
+#endif
+
 template <class T> inline void
 Vector<T>::pop_back()
 {
@@ -165,9 +235,23 @@ class Vector<void*> { public:
 	resize(n, e);
     }
     Vector(const Vector<void*> &);
+#if __cplusplus >= 201103L
+    Vector(Vector<void*> &&x) noexcept
+	: _l(x._l), _n(x._n), _capacity(x._capacity) {
+	x._l = 0;
+	x._n = x._capacity = 0;
+    }
+#endif
     ~Vector();
 
     Vector<void*> &operator=(const Vector<void*> &);
+#if __cplusplus >= 201103L
+    Vector<void*> &operator=(Vector<void*> &&x) noexcept {
+	Vector<void*> tmp(std::move(x));
+	swap(tmp);
+	return *this;
+    }
+#endif
     Vector<void*> &assign(size_type n, void* x = 0);
 
     // iterators
@@ -182,6 +266,7 @@ class Vector<void*> { public:
     size_type capacity() const		{ return _capacity; }
     bool empty() const			{ return _n == 0; }
     bool reserve(size_type n);
+    void shrink_to_fit();
 
     // element access
     void*& operator[](size_type i)	{ assert(i>=0 && i<_n); return _l[i]; }
@@ -197,6 +282,7 @@ class Vector<void*> { public:
 
     // modifiers
     inline void push_back(void* x);
+    void emplace_back(void* x)		{ push_back(x); }
     inline void pop_back();
     inline void push_front(void* x);
     inline void pop_front();
@@ -275,10 +361,17 @@ class Vector<T*>: private Vector<void*> {
     explicit Vector()			: Base() { }
     explicit Vector(size_type n, T* x)	: Base(n, (void *)x) { }
     Vector(const Vector<T*>& x)		: Base(x) { }
+#if __cplusplus >= 201103L
+    Vector(Vector<T*>&& x) noexcept	: Base(std::move(static_cast<Base&>(x))) { }
+#endif
     ~Vector()				{ }
 
     Vector<T*>& operator=(const Vector<T*>& x)
 		{ Base::operator=(x); return *this; }
+#if __cplusplus >= 201103L
+    Vector<T*>& operator=(Vector<T*>&& x) noexcept
+		{ Base::operator=(std::move(static_cast<Base&>(x))); return *this; }
+#endif
     Vector<T*>& assign(size_type n, T* x = 0)
 		{ Base::assign(n, (void*)x); return *this; }
 
@@ -294,6 +387,7 @@ class Vector<T*>: private Vector<void*> {
     size_type capacity() const	{ return Base::capacity(); }
     bool empty() const		{ return Base::empty(); }
     bool reserve(size_type n)	{ return Base::reserve(n); }
+    void shrink_to_fit()	{ Base::shrink_to_fit(); }
 
     // element access
     T*& operator[](size_type i)	{ return (T*&)(Base::at(i)); }
@@ -309,6 +403,7 @@ class Vector<T*>: private Vector<void*> {
 
     // modifiers
     void push_back(T* x)	{ Base::push_back((void*)x); }
+    void emplace_back(T* x)	{ Base::push_back((void*)x); }
     void pop_back()		{ Base::pop_back(); }
     void push_front(T* x)	{ Base::push_front((void*)x); }
     void pop_front()		{ Base::pop_front(); }
@@ -20,10 +20,94 @@
 #include <efont/afmparse.hh>
 #include <efont/t1cs.hh>        /* for UNKDOUBLE */
 #include <lcdf/error.hh>
+#include <lcdf/hashmap.hh>
 #include <ctype.h>
+#include <string.h>
 #include <assert.h>
 namespace Efont {
 
+// Keywords are dispatched through a perfect hash of the alphanumeric token
+// at the start of a line or clause, rather than by trying format strings in
+// turn.  afm_keywords must stay in the same order as the enumeration.  If a
+// new keyword makes keyword_initialize() fail its assertion, pick another
+// multiplier.
+
+enum {
+    k_none = 0, k_Ascender, k_B, k_C, k_CC, k_CH, k_CapHeight,
+    k_CharWidth, k_CharacterSet, k_Characters, k_Comment, k_Descender,
+    k_EncodingScheme, k_EndCharMetrics, k_EndComposites, k_EndDirection,
+    k_EndFontMetrics, k_EndKernData, k_EndKernPairs, k_EndTrackKern,
+    k_EscChar, k_FamilyName, k_FontBBox, k_FontName, k_FullName,
+    k_IsBaseFont, k_IsFixedPitch, k_IsFixedV, k_ItalicAngle, k_KP, k_KPH,
+    k_KPX, k_KPY, k_L, k_MappingScheme, k_MetricsSets, k_N, k_Notice,
+    k_StartCharMetrics, k_StartComposites, k_StartDirection,
+    k_StartFontMetrics, k_StartKernData, k_StartKernPairs,
+    k_StartKernPairs0, k_StartKernPairs1, k_StartTrackKern, k_StdHW,
+    k_StdVW, k_TrackKern, k_UnderlinePosition, k_UnderlineThickness,
+    k_VVector, k_Version, k_W, k_W0, k_W0X, k_W0Y, k_W1, k_W1X, k_W1Y,
+    k_WX, k_Weight, k_XHeight, k_nkeywords
+};
+
+static const char * const afm_keywords[] = {
+    0, "Ascender", "B", "C", "CC", "CH", "CapHeight",
+    "CharWidth", "CharacterSet", "Characters", "Comment", "Descender",
+    "EncodingScheme", "EndCharMetrics", "EndComposites", "EndDirection",
+    "EndFontMetrics", "EndKernData", "EndKernPairs", "EndTrackKern",
+    "EscChar", "FamilyName", "FontBBox", "FontName", "FullName",
+    "IsBaseFont", "IsFixedPitch", "IsFixedV", "ItalicAngle", "KP", "KPH",
+    "KPX", "KPY", "L", "MappingScheme", "MetricsSets", "N", "Notice",
+    "StartCharMetrics", "StartComposites", "StartDirection",
+    "StartFontMetrics", "StartKernData", "StartKernPairs",
+    "StartKernPairs0", "StartKernPairs1", "StartTrackKern", "StdHW",
+    "StdVW", "TrackKern", "UnderlinePosition", "UnderlineThickness",
+    "VVector", "Version", "W", "W0", "W0X", "W0Y", "W1", "W1X", "W1Y",
+    "WX", "Weight", "XHeight"
+};
+
+static unsigned char keyword_slots[256];
+static bool keyword_slots_initialized;
+
+static inline unsigned
+keyword_slot(uint32_t h)
+{
+    return (uint32_t) (h * 0x9E3779B1U) >> 24;
+}
+
+static void
+keyword_initialize()
+{
+    if (keyword_slots_initialized)
+        return;
+    assert(sizeof(afm_keywords) / sizeof(afm_keywords[0]) == k_nkeywords);
+    for (int k = 1; k < k_nkeywords; k++) {
+        uint32_t h = 0;
+        for (const char *s = afm_keywords[k]; *s; s++)
+            h = h * 7665 + (unsigned char) *s;
+        assert(keyword_slots[keyword_slot(h)] == 0);
+        keyword_slots[keyword_slot(h)] = k;
+    }
+    keyword_slots_initialized = true;
+}
+
+// Return the keyword at s and set len to its length.
+static inline int
+afm_keyword(const unsigned char *s, int &len)
+{
+    uint32_t h = 0;
+    const unsigned char *e = s;
+    for (; isalnum(*e); e++)
+        h = h * 7665 + *e;
+    len = e - s;
+    int k = keyword_slots[keyword_slot(h)];
+    if (k != k_none
+        && strncmp(afm_keywords[k], (const char *) s, len) == 0
+        && afm_keywords[k][len] == 0)
+        return k;
+    else
+        return k_none;
+}
+
+
 AfmReader::AfmReader(AfmParser &parser, Metrics *afm, AfmMetricsXt *afm_xt,
                      ErrorHandler *errh)
     : _afm(afm), _afm_xt(afm_xt), _l(parser),
@@ -38,6 +122,7 @@ AfmReader::read(Slurper &slurp, ErrorHandler *errh)
     AfmParser p(slurp);
     if (!p.ok())
         return 0;
+    keyword_initialize();
 
     Metrics *afm = new Metrics;
     AfmMetricsXt *afm_xt = new AfmMetricsXt;
@@ -158,85 +243,129 @@ AfmReader::read()
     int metrics_sets;
     int direction;
 
+    int len;
+
     while (l.next_line())
-        switch (l.first()) {
+        switch (afm_keyword(l.cur_line(), len)) {
 
-          case 'A':
+          case k_Ascender:
             if (l.isall("Ascender %g", &fd( fdAscender )))
                 break;
             goto invalid;
 
-          case 'C':
+          case k_Characters:
             if (l.isall("Characters %d", (int *)0))
                 break;
+            goto invalid;
+
+          case k_CapHeight:
             if (l.isall("CapHeight %g", &fd( fdCapHeight )))
                 break;
+            goto invalid;
+
+          case k_CharacterSet:
             if (l.isall("CharacterSet %+s", (PermString *) 0))
                 break;
+            goto invalid;
+
+          case k_CharWidth:
             if (l.isall("CharWidth %g %g", (double *)0, (double *)0))
                 break;
+            goto invalid;
+
+          case k_Comment:
             if (l.isall("Comment %+s", (PermString *) 0))
                 break;
             goto invalid;
 
-          case 'D':
+          case k_Descender:
             if (l.isall("Descender %g", &fd( fdDescender )))
                 break;
             goto invalid;
 
-          case 'E':
+          case k_EncodingScheme:
             if (l.isall("EncodingScheme %+s", &_afm_xt->encoding_scheme))
                 break;
+            goto invalid;
+
+          case k_EndDirection:
             if (l.isall("EndDirection"))
                 break;
+            goto invalid;
+
+          case k_EndFontMetrics:
             if (l.isall("EndFontMetrics"))
                 goto done;
+            goto invalid;
+
+          case k_EscChar:
             if (l.isall("EscChar %d", (int *)0)) {
                 composite_warning();
                 break;
             }
             goto invalid;
 
-          case 'F':
+          case k_FontName:
             if (l.isall("FontName %+s", &s)) {
                 _afm->set_font_name(s);
                 break;
             }
+            goto invalid;
+
+          case k_FullName:
             if (l.isall("FullName %+s", &s)) {
                 _afm->set_full_name(s);
                 break;
             }
+            goto invalid;
+
+          case k_FamilyName:
             if (l.isall("FamilyName %+s", &s)) {
                 _afm->set_family(s);
                 break;
             }
+            goto invalid;
+
+          case k_FontBBox:
             if (l.isall("FontBBox %g %g %g %g",
                         &fd( fdFontBBllx ), &fd( fdFontBBlly ),
                         &fd( fdFontBBurx ), &fd( fdFontBBury )))
                 break;
             goto invalid;
 
-          case 'I':
+          case k_ItalicAngle:
             if (l.isall("ItalicAngle %g", &fd( fdItalicAngle )))
                 break;
+            goto invalid;
+
+          case k_IsBaseFont:
             if (l.isall("IsBaseFont %b", &isbasefont)) {
                 if (isbasefont == 0)
                     composite_warning();
                 break;
             }
+            goto invalid;
+
+          case k_IsFixedV:
             if (l.isall("IsFixedV %b", (bool *)0)) {
                 metrics_sets_warning();
                 break;
             }
+            goto invalid;
+
+          case k_IsFixedPitch:
             if (l.isall("IsFixedPitch %b", (bool *)0))
                 break;
             goto invalid;
 
-          case 'M':
+          case k_MappingScheme:
             if (l.isall("MappingScheme %d", (int *)0)) {
                 composite_warning();
                 break;
             }
+            goto invalid;
+
+          case k_MetricsSets:
             if (l.isall("MetricsSets %d", &metrics_sets)) {
                 if (metrics_sets != 0)
                     metrics_sets_warning();
@@ -244,68 +373,93 @@ AfmReader::read()
             }
             goto invalid;
 
-          case 'N':
+          case k_Notice:
             if (l.isall("Notice %+s", &_afm_xt->notice))
                 break;
             goto invalid;
 
-          case 'S':
+          case k_StartDirection:
             if (l.isall("StartDirection %d", &direction)) {
                 if (direction != 0)
                     metrics_sets_warning();
                 break;
             }
+            goto invalid;
+
+          case k_StartCharMetrics:
             if (l.isall("StartCharMetrics %d", (int *)0)) {
                 read_char_metrics();
                 break;
             }
+            goto invalid;
+
+          case k_StartKernData:
             if (l.isall("StartKernData")) {
                 read_kerns();
                 break;
             }
+            goto invalid;
+
+          case k_StartComposites:
             if (l.isall("StartComposites %d", (int *)0)) {
                 read_composites();
                 break;
             }
+            goto invalid;
+
+          case k_StdHW:
             if (l.isall("StdHW %g", &fd( fdStdHW )))
                 break;
+            goto invalid;
+
+          case k_StdVW:
             if (l.isall("StdVW %g", &fd( fdStdVW )))
                 break;
+            goto invalid;
+
+          case k_StartFontMetrics:
             if (l.isall("StartFontMetrics %g", (double *)0))
                 break;
             goto invalid;
 
-          case 'U':
+          case k_UnderlinePosition:
             if (l.isall("UnderlinePosition %g", &fd( fdUnderlinePosition )))
                 break;
+            goto invalid;
+
+          case k_UnderlineThickness:
             if (l.isall("UnderlineThickness %g", &fd( fdUnderlineThickness )))
                 break;
             goto invalid;
 
-          case 'V':
+          case k_Version:
             if (l.isall("Version %+s", &s)) {
                 _afm->set_version(s);
                 break;
             }
+            goto invalid;
+
+          case k_VVector:
             if (l.isall("VVector %g %g", (double *)0, (double *)0)) {
                 metrics_sets_warning();
                 break;
             }
             goto invalid;
 
-          case 'W':
+          case k_Weight:
             if (l.isall("Weight %+s", &s)) {
                 _afm->set_weight(s);
                 break;
             }
             goto invalid;
 
-          case 'X':
+          case k_XHeight:
             if (l.isall("XHeight %g", &fd( fdXHeight )))
                 break;
             goto invalid;
 
           default:
+            l.clear_match();
           invalid:
             invalid_lines++;
             no_match_warning();
@@ -335,11 +489,68 @@ AfmReader::read_char_metric_data() const
 
     AfmParser &l = _l;
 
-    l.is("C %d ; WX %g ; N %/s ; B %g %g %g %g ;",
-         &c, &wx, &n, &bllx, &blly, &burx, &bury);
-
     while (l.left()) {
 
+        // Common clauses have hand-written parsers.  Anything they don't
+        // accept goes to the format strings below, which report errors.
+        unsigned char *s = l.cur_line();
+        int len, ci;
+        double d[4];
+        switch (afm_keyword(s, len)) {
+
+          case k_C:
+            s += len;
+            if (AfmParser::scan_space(s) && AfmParser::scan_integer(s, ci)) {
+                c = ci;
+                goto clause_done;
+            }
+            break;
+
+          case k_WX:
+          case k_W0X:
+            s += len;
+            if (AfmParser::scan_space(s) && AfmParser::scan_number(s, d[0])) {
+                wx = d[0];
+                goto clause_done;
+            }
+            break;
+
+          case k_N:
+            s += len;
+            if (AfmParser::scan_space(s) && AfmParser::scan_name(s, n))
+                goto clause_done;
+            break;
+
+          case k_B:
+            s += len;
+            if (AfmParser::scan_space(s) && AfmParser::scan_number(s, d[0])
+                && AfmParser::scan_space(s) && AfmParser::scan_number(s, d[1])
+                && AfmParser::scan_space(s) && AfmParser::scan_number(s, d[2])
+                && AfmParser::scan_space(s) && AfmParser::scan_number(s, d[3])) {
+                bllx = d[0], blly = d[1], burx = d[2], bury = d[3];
+                goto clause_done;
+            }
+            break;
+
+          case k_L:
+            s += len;
+            if (n && AfmParser::scan_space(s)
+                && AfmParser::scan_name(s, ligright)
+                && AfmParser::scan_space(s)
+                && AfmParser::scan_name(s, ligresult)) {
+                ligature_left.push_back(n);
+                ligature_right.push_back(ligright);
+                ligature_result.push_back(ligresult);
+                goto clause_done;
+            }
+            break;
+
+          case k_none:
+            l.clear_match();
+            break;
+
+        }
+
         switch (l.first()) {
 
           case 'B':
@@ -405,6 +616,17 @@ AfmReader::read_char_metric_data() const
         }
 
         l.is(";"); // get rid of any possible semicolon
+        continue;
+
+      clause_done:
+        AfmParser::skip_space(s);
+        l.set_cur_line(s);
+        if (*s == ';') {
+            s++;
+            AfmParser::skip_space(s);
+            l.set_cur_line(s);
+        } else
+            l.is(";");
     }
 
     // create the character
@@ -432,26 +654,32 @@ void
 AfmReader::read_char_metrics() const
 {
     assert(!ligature_left.size());
+    int len;
 
     while (_l.next_line())
         // Grok the whole line. Are we on a character metric data line?
-        switch (_l.first()) {
+        switch (afm_keyword(_l.cur_line(), len)) {
 
-          case 'C':
-            if (isspace(_l[1]) || (_l[1] == 'H' && isspace(_l[2]))) {
+          case k_C:
+          case k_CH:
+            if (isspace(_l[len])) {
                 read_char_metric_data();
                 break;
             }
+            goto invalid;
+
+          case k_Comment:
             if (_l.is("Comment"))
                 break;
             goto invalid;
 
-          case 'E':
+          case k_EndCharMetrics:
             if (_l.isall("EndCharMetrics"))
                 goto end_char_metrics;
             goto invalid;
 
           default:
+            _l.clear_match();
           invalid:
             no_match_warning();
 
@@ -473,6 +701,16 @@ AfmReader::read_char_metrics() const
 }
 
 
+GlyphIndex
+AfmReader::find_err(const HashMap<String, GlyphIndex> &glyph_map,
+                    const char *name, int len) const
+{
+    GlyphIndex gi = glyph_map.find(String::make_stable(name, len));
+    if (gi < 0)
+        lerror("character `%s' doesn't exist", PermString(name, len).c_str());
+    return gi;
+}
+
 void
 AfmReader::read_kerns() const
 {
@@ -484,35 +722,79 @@ AfmReader::read_kerns() const
     // AFM files have reversed pair programs when read.
     _afm->pair_program()->set_reversed(true);
 
+    // KPX lines look glyphs up by name without interning the names.
+    HashMap<String, GlyphIndex> glyph_map(-1);
+    glyph_map.reserve(_afm->nglyphs());
+    for (GlyphIndex gi = 0; gi < _afm->nglyphs(); gi++) {
+        PermString name = _afm->name(gi);
+        glyph_map.insert(String::make_stable(name.c_str(), name.length()), gi);
+    }
+
+    // Kerns are added to the pair program all at once.
+    Vector<PairOp> kerns;
+
+    int len;
+    unsigned char *s;
+    const char *lname, *rname;
+    int llen, rlen;
+
     while (l.next_line())
-        switch (l.first()) {
+        switch (afm_keyword(s = l.cur_line(), len)) {
 
-          case 'C':
+          case k_Comment:
             if (l.is("Comment"))
                 break;
             goto invalid;
 
-          case 'E':
+          case k_EndKernPairs:
             if (l.isall("EndKernPairs"))
                 break;
+            goto invalid;
+
+          case k_EndKernData:
             if (l.isall("EndKernData"))
-                return;
+                goto end_kern_data;
+            goto invalid;
+
+          case k_EndTrackKern:
             if (l.isall("EndTrackKern"))
                 break;
             goto invalid;
 
-          case 'K':
-            if (l.isall("KPX %/s %/s %g", &left, &right, &kx)) {
-                goto validkern;
+          case k_KPX:
+            s += len;
+            if (AfmParser::scan_space(s)
+                && AfmParser::scan_name(s, lname, llen)
+                && AfmParser::scan_space(s)
+                && AfmParser::scan_name(s, rname, rlen)
+                && AfmParser::scan_space(s)
+                && AfmParser::scan_number(s, kx)) {
+                AfmParser::skip_space(s);
+                if (*s == 0) {
+                    leftgi = find_err(glyph_map, lname, llen);
+                    rightgi = find_err(glyph_map, rname, rlen);
+                    goto validkern_gi;
+                }
             }
+            if (l.isall("KPX %/s %/s %g", &left, &right, &kx))
+                goto validkern;
+            goto invalid;
+
+          case k_KP:
             if (l.isall("KP %/s %/s %g %g", &left, &right, &kx, (double *)0)) {
                 y_width_warning();
                 goto validkern;
             }
+            goto invalid;
+
+          case k_KPY:
             if (l.isall("KPY %/s %/s %g", &left, &right, (double *)0)) {
                 y_width_warning();
                 break;
             }
+            goto invalid;
+
+          case k_KPH:
             if (l.isall("KPH <%x> <%x> %g %g", (int *)0, (int *)0,
                         (double *)0, (double *)0)) {
                 lwarning("KPH not supported");
@@ -523,59 +805,77 @@ AfmReader::read_kerns() const
           validkern:
             leftgi = find_err(left, "kern");
             rightgi = find_err(right, "kern");
-            if (leftgi >= 0 && rightgi >= 0)
+          validkern_gi:
+            if (leftgi >= 0 && rightgi >= 0) {
                 // A kern with 0 amount is NOT useless!
                 // (Because of multiple masters.)
-                if (_afm->add_kern(leftgi, rightgi, _afm->add_kv(kx)))
-                    lwarning("duplicate kern; first pair ignored");
+                kerns.push_back(PairOp(leftgi, rightgi, _afm->add_kv(kx), -1));
+            }
             break;
 
-          case 'S':
+          case k_StartKernPairs:
+          case k_StartKernPairs0:
             if (l.isall("StartKernPairs %d", (int *)0) ||
                 l.isall("StartKernPairs0 %d", (int *)0))
                 break;
+            goto invalid;
+
+          case k_StartKernPairs1:
             if (l.isall("StartKernPairs1 %d", (int *)0)) {
                 metrics_sets_warning();
                 break;
             }
+            goto invalid;
+
+          case k_StartTrackKern:
             if (l.isall("StartTrackKern %d", (int *)0))
                 break;
             goto invalid;
 
-          case 'T':
+          case k_TrackKern:
             if (l.isall("TrackKern %g %g %g %g %g", (double *)0, (double *)0,
                         (double *)0, (double *)0, (double *)0))
                 break; // FIXME: implement TrackKern
             goto invalid;
 
           default:
+            l.clear_match();
           invalid:
             no_match_warning();
             break;
 
         }
+
+  end_kern_data:
+    _afm->pair_program()->add_ops(kerns);
 }
 
 
 void
 AfmReader::read_composites() const
 {
+    int len;
+
     while (_l.next_line())
-        switch (_l.first()) {
+        switch (afm_keyword(_l.cur_line(), len)) {
 
-          case 'C':
+          case k_Comment:
             if (_l.is("Comment"))
                 break;
+            goto invalid;
+
+          case k_CC:
             if (_l.is("CC"))
                 break;
             goto invalid;
 
-          case 'E':
+          case k_EndComposites:
             if (_l.isall("EndComposites"))
                 return;
             goto invalid;
 
           default:
+            _l.clear_match();
           invalid:
             no_match_warning();
             break;
@@ -342,6 +342,104 @@ AfmParser::is(const char *format, ...)
 }
 
 
+bool
+AfmParser::scan_space(unsigned char *&s)
+{
+    if (!isspace(*s))
+        return false;
+    do {
+        s++;
+    } while (isspace(*s));
+    return true;
+}
+
+
+bool
+AfmParser::scan_integer(unsigned char *&s, int &v)
+{
+    // Most integers are short; leave the rest to strtol.
+    unsigned char *t = s;
+    bool negative = (*t == '-');
+    if (*t == '-' || *t == '+')
+        t++;
+    if (isdigit(*t)) {
+        int x = 0, ndigits = 0;
+        for (; isdigit(*t) && ndigits < 9; t++, ndigits++)
+            x = 10 * x + *t - '0';
+        if (!isdigit(*t)) {
+            v = negative ? -x : x;
+            s = t;
+            return true;
+        }
+    }
+
+    union { unsigned char *uc; char *c; } new_str;
+    long l = strtol((char *)s, &new_str.c, 10);
+    if (new_str.uc == s)
+        return false;
+    v = l;
+    s = new_str.uc;
+    return true;
+}
+
+
+bool
+AfmParser::scan_number(unsigned char *&s, double &v)
+{
+    // Like strtonumber(): integers are parsed exactly, anything with a
+    // fractional part or exponent goes to strtod.
+    unsigned char *t = s;
+    bool negative = (*t == '-');
+    if (*t == '-' || *t == '+')
+        t++;
+    if (isdigit(*t)) {
+        int x = 0, ndigits = 0;
+        for (; isdigit(*t) && ndigits < 9; t++, ndigits++)
+            x = 10 * x + *t - '0';
+        if (!isdigit(*t) && *t != '.' && *t != 'e' && *t != 'E') {
+            v = negative ? -x : x;
+            s = t;
+            return true;
+        }
+    }
+
+    union { unsigned char *uc; char *c; } new_str;
+    double d = strtonumber((char *)s, &new_str.c);
+    if (new_str.uc == s)
+        return false;
+    v = (d < MIN_KNOWN_DOUBLE ? MIN_KNOWN_DOUBLE : d);
+    s = new_str.uc;
+    return true;
+}
+
+
+bool
+AfmParser::scan_name(unsigned char *&s, const char *&name, int &len)
+{
+    unsigned char *t = s;
+    while (!name_enders[*t])
+        t++;
+    if (t == s)
+        return false;
+    name = (const char *)s;
+    len = t - s;
+    s = t;
+    return true;
+}
+
+
+bool
+AfmParser::scan_name(unsigned char *&s, PermString &name)
+{
+    const char *n;
+    int len;
+    if (!scan_name(s, n, len))
+        return false;
+    name = PermString(n, len);
+    return true;
+}
+
+
 PermString
 AfmParser::keyword() const
 {
@@ -169,25 +169,10 @@ AmfmMetrics::find_primary_font(const Vector<double> &design_vector) const
 
 
 Metrics *
-AmfmMetrics::interpolate(const Vector<double> &design_vector,
-                         const Vector<double> &weight_vector,
-                         ErrorHandler *errh)
+AmfmMetrics::make_instance(const Vector<double> &design_vector,
+                           const Metrics &master) const
 {
-    assert(design_vector.size() == _naxes);
-    assert(weight_vector.size() == _nmasters);
-
-    // FIXME: check masters for correspondence.
-
-    /* 0.
-     * Make sure all necessary AFMs have been loaded. */
-    int m;
-    for (m = 0; m < _nmasters; m++)
-        if (weight_vector[m])
-            if (!master(m, errh))
-                return 0;
-
-    /* 1.
-     * Use the design vector to generate new FontName and FullName. */
+    /* Use the design vector to generate new FontName and FullName. */
 
     AmfmPrimaryFont *pf = find_primary_font(design_vector);
     // The primary font is useless to us if it doesn't have axis labels.
@@ -213,28 +198,76 @@ AmfmMetrics::interpolate(const Vector<double> &design_vector,
     // Multiple master fonts require an underscore AFTER the font name too
     font_name_sa << '_';
 
-    /* 2.
-     * Set up the new AFM with the special constructor. */
+    /* Set up the new AFM with the special constructor. */
 
-    // Find the first master with a non-zero component.
-    for (m = 0; m < _nmasters && weight_vector[m] == 0; m++)
-        ;
-    Metrics *afm = new Metrics(font_name_sa.c_str(), full_name_sa.c_str(), *_masters[m].afm);
-    if (MetricsXt *xt = _masters[m].afm->find_xt("AFM")) {
+    Metrics *afm = new Metrics(font_name_sa.c_str(), full_name_sa.c_str(), master);
+    if (MetricsXt *xt = master.find_xt("AFM")) {
         AfmMetricsXt *new_xt = new AfmMetricsXt((AfmMetricsXt &)*xt);
         afm->add_xt(new_xt);
     }
+    return afm;
+}
 
-    /* 2.
-     * Interpolate the old AFM data into the new. */
+Metrics *
+AmfmMetrics::interpolate(const Vector<double> &design_vector,
+                         const Vector<double> &weight_vector,
+                         ErrorHandler *errh)
+{
+    Vector<Vector<double> > designs(1, design_vector);
+    Vector<Vector<double> > weights(1, weight_vector);
+    Vector<Metrics *> instances;
+    interpolate(designs, weights, instances, errh);
+    return instances[0];
+}
 
-    afm->interpolate_dimens(*_masters[m].afm, weight_vector[m], false);
+void
+AmfmMetrics::interpolate(const Vector<Vector<double> > &designs,
+                         const Vector<Vector<double> > &weights,
+                         Vector<Metrics *> &instances,
+                         ErrorHandler *errh)
+{
+    assert(designs.size() == weights.size());
 
-    for (m++; m < _nmasters; m++)
-        if (weight_vector[m])
-            afm->interpolate_dimens(*_masters[m].afm, weight_vector[m], true);
+    // FIXME: check masters for correspondence.
 
-    return afm;
+    /* 0.
+     * Make sure all necessary AFMs have been loaded, and set up the new
+     * AFMs. Each master is loaded (and any error reported) only once. */
+    Vector<int> master_ok(_nmasters, -1);
+    Vector<Metrics *> masters(_nmasters, 0);
+    Vector<Metrics *> made;
+    Vector<Vector<double> > made_weights;
+    instances.assign(designs.size(), 0);
+
+    for (int i = 0; i < designs.size(); i++) {
+        assert(designs[i].size() == _naxes);
+        assert(weights[i].size() == _nmasters);
+
+        int first = -1;
+        for (int m = 0; m < _nmasters; m++)
+            if (weights[i][m]) {
+                if (master_ok[m] < 0) {
+                    masters[m] = master(m, errh);
+                    master_ok[m] = (masters[m] != 0);
+                }
+                if (!master_ok[m])
+                    goto next_instance;
+                if (first < 0)
+                    first = m;
+            }
+        if (first < 0)
+            continue;
+
+        instances[i] = make_instance(designs[i], *masters[first]);
+        made.push_back(instances[i]);
+        made_weights.push_back(weights[i]);
+
+      next_instance: ;
+    }
+
+    /* 1.
+     * Interpolate the old AFM data into the new. */
+    Metrics::interpolate_dimens(made, masters, made_weights);
 }
 
 
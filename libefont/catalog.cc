@@ -0,0 +1,818 @@
+// -*- related-file-name: "../include/efont/catalog.hh" -*-
+
+/* catalog.{cc,hh} -- indexes of installed fonts
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/catalog.hh>
+#include <efont/otfcmap.hh>
+#include <efont/otfgsub.hh>
+#include <efont/otfgpos.hh>
+#include <efont/otfname.hh>
+#include <efont/otfos2.hh>
+#include <efont/t1rw.hh>
+#include <efont/t1font.hh>
+#include <efont/t1item.hh>
+#include <lcdf/error.hh>
+#include <lcdf/filename.hh>
+#include <lcdf/hashmap.hh>
+#include <lcdf/landmark.hh>
+#include <lcdf/parallel.hh>
+#include <lcdf/straccum.hh>
+#include <lcdf/md5.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <algorithm>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+#ifdef HAVE_FCNTL_H
+# include <fcntl.h>
+#endif
+#ifndef O_BINARY
+# define O_BINARY 0
+#endif
+
+namespace Efont {
+
+/*****
+ * UnicodeCoverage
+ **/
+
+void
+UnicodeCoverage::assign(const Vector<uint32_t> &codes)
+{
+    StringAccum sa;
+    _pages.clear();
+    _count = 0;
+    for (const uint32_t *c = codes.begin(); c != codes.end(); ++c) {
+        uint32_t page = *c >> PAGE_SHIFT;
+        if (_pages.empty() || _pages.back() != page) {
+            _pages.push_back(page);
+            memset(sa.extend(PAGE_BYTES), 0, PAGE_BYTES);
+        }
+        unsigned char *bits = reinterpret_cast<unsigned char *>(sa.data() + sa.length() - PAGE_BYTES);
+        int bit = *c & ((1 << PAGE_SHIFT) - 1);
+        if (!(bits[bit >> 3] & (1 << (bit & 7)))) {
+            bits[bit >> 3] |= 1 << (bit & 7);
+            ++_count;
+        }
+    }
+    _bits = sa.take_string();
+}
+
+bool
+UnicodeCoverage::contains(uint32_t code) const
+{
+    const uint32_t *p = std::lower_bound(_pages.begin(), _pages.end(), code >> PAGE_SHIFT);
+    if (p == _pages.end() || *p != (code >> PAGE_SHIFT))
+        return false;
+    const unsigned char *bits = _bits.udata() + (p - _pages.begin()) * PAGE_BYTES;
+    int bit = code & ((1 << PAGE_SHIFT) - 1);
+    return (bits[bit >> 3] & (1 << (bit & 7))) != 0;
+}
+
+void
+UnicodeCoverage::ranges(Vector<uint32_t> &ranges) const
+{
+    ranges.clear();
+    for (int p = 0; p < _pages.size(); ++p) {
+        const unsigned char *bits = _bits.udata() + p * PAGE_BYTES;
+        for (int bit = 0; bit < (1 << PAGE_SHIFT); ++bit)
+            if (bits[bit >> 3] & (1 << (bit & 7))) {
+                uint32_t code = (_pages[p] << PAGE_SHIFT) + bit;
+                if (ranges.size() && ranges.back() == code - 1)
+                    ranges.back() = code;
+                else {
+                    ranges.push_back(code);
+                    ranges.push_back(code);
+                }
+            }
+    }
+}
+
+
+/*****
+ * CatalogFace
+ **/
+
+CatalogFace::CatalogFace()
+    : face(-1), outlines(O_TRUETYPE), design_size(0), size_subfamily_id(0)
+{
+    size_range[0] = size_range[1] = 0;
+}
+
+bool
+CatalogFace::has_script(OpenType::Tag script, OpenType::Tag langsys) const
+{
+    // Without a language system, any language system for script matches.
+    String text = script.text();
+    if (!langsys.null())
+        return std::binary_search(scripts.begin(), scripts.end(), text + String(".") + langsys.text());
+    const String *s = std::lower_bound(scripts.begin(), scripts.end(), text);
+    return s != scripts.end()
+        && (*s == text || (s->length() > text.length() && s->starts_with(text)
+                           && (*s)[text.length()] == '.'));
+}
+
+bool
+CatalogFace::has_feature(OpenType::Tag feature, OpenType::Tag script) const
+{
+    for (int i = 0; i < script_features.size(); i += 2)
+        if (script_features[i + 1] == feature.value()
+            && (script.null() || script_features[i] == script.value()))
+            return true;
+    return false;
+}
+
+void
+CatalogFace::features(Vector<OpenType::Tag> &result) const
+{
+    Vector<uint32_t> tags;
+    for (int i = 0; i < script_features.size(); i += 2)
+        tags.push_back(script_features[i + 1]);
+    std::sort(tags.begin(), tags.end());
+    uint32_t *end = std::unique(tags.begin(), tags.end());
+    result.clear();
+    for (uint32_t *t = tags.begin(); t != end; ++t)
+        result.push_back(OpenType::Tag(*t));
+}
+
+const char *
+CatalogFace::outlines_name(int outlines)
+{
+    if (outlines == O_CFF)
+        return "cff";
+    else if (outlines == O_TYPE1)
+        return "type1";
+    else
+        return "truetype";
+}
+
+
+/*****
+ * reading fonts
+ **/
+
+// These functions run on worker threads, so they must not touch any String
+// they did not create.  lcdf Strings are not thread-safe.
+
+namespace {
+enum { R_NOTFONT = 0, R_READ, R_UNCHANGED, R_TYPE1 };
+
+enum { T_CMAP = 0, T_GPOS, T_GSUB, T_NAME, T_OS2, NTABLES };
+const char * const table_names[] = {
+    "cmap", "GPOS", "GSUB", "name", "OS/2"
+};
+const int name_ids[] = {
+    OpenType::Name::N_POSTSCRIPT, OpenType::Name::N_FAMILY,
+    OpenType::Name::N_SUBFAMILY, OpenType::Name::N_FULLNAME,
+    OpenType::Name::N_PREF_FAMILY, OpenType::Name::N_PREF_SUBFAMILY,
+    OpenType::Name::N_VERSION
+};
+}
+
+static bool
+read_at(int fd, uint32_t offset, uint32_t length, String &result)
+{
+    String s = String::make_uninitialized(length);
+    char *x = s.mutable_data();
+    uint32_t pos = 0;
+#if !HAVE_PREAD
+    if (lseek(fd, offset, SEEK_SET) == (off_t) -1)
+        return false;
+#endif
+    while (pos < length) {
+#if HAVE_PREAD
+        ssize_t r = pread(fd, x + pos, length - pos, offset + pos);
+#else
+        ssize_t r = read(fd, x + pos, length - pos);
+#endif
+        if (r > 0)
+            pos += r;
+        else if (r == 0 || errno != EINTR)
+            return false;
+    }
+    result = s;
+    return true;
+}
+
+static bool
+is_sfnt(const char *data)
+{
+    return memcmp(data, "OTTO", 4) == 0
+        || memcmp(data, "\000\001\000\000", 4) == 0
+        || memcmp(data, "true", 4) == 0;
+}
+
+static void
+read_layout(const OpenType::ScriptList &script_list, const OpenType::FeatureList &feature_list, CatalogFace &cf, ErrorHandler *errh)
+{
+    Vector<OpenType::Tag> script, langsys;
+    script_list.language_systems(script, langsys, errh);
+    for (int i = 0; i < script.size(); i++) {
+        if (langsys[i].null())
+            cf.scripts.push_back(script[i].text());
+        else
+            cf.scripts.push_back(script[i].text() + String(".") + langsys[i].text());
+        int required_fid;
+        Vector<int> fids;
+        script_list.features(script[i], langsys[i], required_fid, fids, errh);
+        if (required_fid >= 0)
+            fids.push_back(required_fid);
+        for (int *fid = fids.begin(); fid != fids.end(); ++fid) {
+            cf.script_features.push_back(script[i].value());
+            cf.script_features.push_back(feature_list.tag(*fid).value());
+        }
+    }
+}
+
+static void
+sort_layout(CatalogFace &cf)
+{
+    std::sort(cf.scripts.begin(), cf.scripts.end());
+    cf.scripts.resize(std::unique(cf.scripts.begin(), cf.scripts.end()) - cf.scripts.begin());
+
+    Vector<uint64_t> pairs;
+    for (int i = 0; i < cf.script_features.size(); i += 2)
+        pairs.push_back(((uint64_t) cf.script_features[i] << 32) | cf.script_features[i + 1]);
+    std::sort(pairs.begin(), pairs.end());
+    uint64_t *end = std::unique(pairs.begin(), pairs.end());
+    cf.script_features.clear();
+    for (uint64_t *p = pairs.begin(); p != end; ++p) {
+        cf.script_features.push_back(*p >> 32);
+        cf.script_features.push_back(*p);
+    }
+}
+
+static void
+read_optical_size(const String *tables, CatalogFace &cf, ErrorHandler *errh)
+{
+    try {
+        if (tables[T_GPOS]) {
+            // ErrorHandler::silent_handler() is shared between threads
+            SilentErrorHandler serrh;
+            OpenType::Gpos gpos(tables[T_GPOS], errh);
+            OpenType::Name name(tables[T_NAME], tables[T_NAME] ? errh : &serrh);
+            // Use the first language system with a 'size' feature.
+            Vector<OpenType::Tag> script, langsys;
+            gpos.script_list().language_systems(script, langsys, errh);
+            int size_fid = -1;
+            for (int i = 0; i < script.size() && size_fid < 0; ++i) {
+                int required_fid;
+                Vector<int> fids;
+                gpos.script_list().features(script[i], langsys[i], required_fid, fids, errh);
+                size_fid = gpos.feature_list().find(OpenType::Tag("size"), fids);
+            }
+            OpenType::Data size_data;
+            if (size_fid >= 0)
+                size_data = gpos.feature_list().size_params(size_fid, name, errh);
+            if (size_data.length()) {
+                cf.design_size = size_data.u16(0) / 10.;
+                if ((cf.size_subfamily_id = size_data.u16(2)) != 0) {
+                    cf.size_range[0] = size_data.u16(6) / 10.;
+                    cf.size_range[1] = size_data.u16(8) / 10.;
+                    cf.size_subfamily_name = name.english_name(size_data.u16(4));
+                }
+                return;
+            }
+        }
+    } catch (OpenType::Error) {
+    }
+
+    try {
+        if (tables[T_OS2]) {
+            OpenType::Os2 os2(tables[T_OS2], errh);
+            if (os2.ok() && os2.has_optical_point_size()) {
+                cf.size_range[0] = os2.lower_optical_point_size();
+                cf.size_range[1] = os2.upper_optical_point_size();
+            }
+        }
+    } catch (OpenType::Error) {
+    }
+}
+
+static void
+read_unicode(const String &cmap_table, CatalogFace &cf, ErrorHandler *errh)
+{
+    Vector<std::pair<uint32_t, OpenType::Glyph> > u2g;
+    try {
+        OpenType::Cmap cmap(cmap_table, errh);
+        if (!cmap.ok())
+            return;
+        cmap.unmap_all(u2g);
+    } catch (OpenType::Error) {
+        return;
+    }
+    Vector<uint32_t> codes;
+    for (std::pair<uint32_t, OpenType::Glyph> *it = u2g.begin(); it != u2g.end(); ++it)
+        if (it->second > 0)
+            codes.push_back(it->first);
+    std::sort(codes.begin(), codes.end());
+    cf.unicode.assign(codes);
+}
+
+static bool
+read_directory(int fd, uint32_t offset, String &directory, MD5_CONTEXT *md5, ErrorHandler *errh)
+{
+    String header;
+    if (!read_at(fd, offset, OpenType::Font::HEADER_SIZE, header)) {
+        errh->error("OTF file corrupted (too small)");
+        return false;
+    } else if (!is_sfnt(header.data())) {
+        errh->error("not an OpenType font (bad magic number)");
+        return false;
+    }
+    int ntables = OpenType::Data::u16_aligned(header.udata() + 4);
+    if (!read_at(fd, offset + OpenType::Font::HEADER_SIZE, ntables * OpenType::Font::TABLE_DIR_ENTRY_SIZE, directory)) {
+        errh->error("OTF table directory out of range");
+        return false;
+    }
+    md5_update(md5, header.udata(), header.length());
+    md5_update(md5, directory.udata(), directory.length());
+    directory = header + directory;
+    return true;
+}
+
+static void
+read_face(int fd, uint64_t file_length, const String &directory, CatalogFace &cf, ErrorHandler *errh)
+{
+    const uint8_t *data = directory.udata();
+    cf.outlines = (memcmp(data, "OTTO", 4) == 0 ? CatalogFace::O_CFF : CatalogFace::O_TRUETYPE);
+    int ntables = OpenType::Data::u16_aligned(data + 4);
+
+    String tables[NTABLES];
+    for (int t = 0; t < NTABLES; ++t) {
+        OpenType::Tag tag(table_names[t]);
+        const uint8_t *entry = tag.table_entry(data + OpenType::Font::HEADER_SIZE, ntables, OpenType::Font::TABLE_DIR_ENTRY_SIZE);
+        if (!entry)
+            continue;
+        uint32_t toffset = OpenType::Data::u32_aligned(entry + 8);
+        uint32_t tlength = OpenType::Data::u32_aligned(entry + 12);
+        if (toffset > file_length || tlength > file_length - toffset
+            || !read_at(fd, toffset, tlength, tables[t]))
+            errh->error("OTF data for %<%s%> out of range", table_names[t]);
+    }
+
+    if (tables[T_NAME])
+        try {
+            OpenType::Name name(tables[T_NAME], errh);
+            if (name.ok())
+                for (int n = 0; n < CatalogFace::NNAMES; ++n)
+                    cf.names[n] = name.english_name(name_ids[n]);
+        } catch (OpenType::Error) {
+        }
+
+    if (tables[T_GSUB])
+        try {
+            OpenType::Gsub gsub(tables[T_GSUB], 0, errh);
+            read_layout(gsub.script_list(), gsub.feature_list(), cf, errh);
+        } catch (OpenType::Error) {
+        }
+    if (tables[T_GPOS])
+        try {
+            OpenType::Gpos gpos(tables[T_GPOS], errh);
+            read_layout(gpos.script_list(), gpos.feature_list(), cf, errh);
+        } catch (OpenType::Error) {
+        }
+    sort_layout(cf);
+
+    read_optical_size(tables, cf, errh);
+    if (tables[T_CMAP])
+        read_unicode(tables[T_CMAP], cf, errh);
+}
+
+// Read an OpenType font or collection, or recognize a Type 1 font.  If
+// old_checksum matches the file's checksum, return R_UNCHANGED without
+// reading any tables.
+static int
+read_file(const char *filename, const char *old_checksum, CatalogFile &cfile, ErrorHandler *errh)
+{
+    int fd = open(filename, O_RDONLY | O_BINARY);
+    if (fd < 0) {
+        errh->error("%s", strerror(errno));
+        return R_NOTFONT;
+    }
+
+    int result = R_NOTFONT;
+    struct stat st;
+    String header;
+    MD5_CONTEXT md5;
+    unsigned char digest[MD5_DIGEST_SIZE];
+    md5_init(&md5);
+    Vector<String> directories;
+
+    if (fstat(fd, &st) < 0 || st.st_size < OpenType::Font::HEADER_SIZE
+        || !read_at(fd, 0, OpenType::Font::HEADER_SIZE, header))
+        goto done;
+
+    if (memcmp(header.data(), "ttcf", 4) == 0) {
+        // TTC header: Tag ttcTag, Fixed version, ULONG numFonts,
+        // ULONG offsetTable[numFonts]
+        uint32_t nfaces = OpenType::Data::u32_aligned(header.udata() + 8);
+        String offsets;
+        if (nfaces > (uint64_t) (st.st_size - OpenType::Font::HEADER_SIZE) / 4
+            || !read_at(fd, OpenType::Font::HEADER_SIZE, nfaces * 4, offsets)) {
+            errh->error("font collection corrupted");
+            goto done;
+        }
+        md5_update(&md5, header.udata(), header.length());
+        md5_update(&md5, offsets.udata(), offsets.length());
+        for (uint32_t i = 0; i < nfaces; ++i) {
+            directories.push_back(String());
+            if (!read_directory(fd, OpenType::Data::u32_aligned(offsets.udata() + 4 * i), directories.back(), &md5, errh))
+                goto done;
+        }
+    } else if (is_sfnt(header.data())) {
+        directories.push_back(String());
+        if (!read_directory(fd, 0, directories.back(), &md5, errh))
+            goto done;
+    } else if ((unsigned char) header[0] == 128
+               || memcmp(header.data(), "%!PS-AdobeFont", 12) == 0
+               || memcmp(header.data(), "%!FontType1", 11) == 0) {
+        // Type 1 fonts are small; digest the whole file.
+        String data;
+        if (!read_at(fd, 0, st.st_size, data))
+            goto done;
+        md5_update(&md5, data.udata(), data.length());
+        result = R_TYPE1;
+    } else
+        goto done;
+
+    md5_final(digest, &md5);
+    if (old_checksum && memcmp(old_checksum, digest, MD5_DIGEST_SIZE) == 0)
+        result = R_UNCHANGED;
+    else {
+        cfile.checksum = String(reinterpret_cast<const char *>(digest), MD5_DIGEST_SIZE);
+        for (int i = 0; i < directories.size(); ++i) {
+            cfile.faces.push_back(CatalogFace());
+            cfile.faces.back().face = (directories.size() > 1 || memcmp(header.data(), "ttcf", 4) == 0 ? i : -1);
+            read_face(fd, st.st_size, directories[i], cfile.faces.back(), errh);
+        }
+        if (result != R_TYPE1)
+            result = R_READ;
+    }
+
+  done:
+    close(fd);
+    return result;
+}
+
+static void
+read_type1_file(const String &filename, CatalogFile &cfile, ErrorHandler *errh)
+{
+    FILE *f = fopen(filename.c_str(), "rb");
+    if (!f) {
+        errh->error("%s", strerror(errno));
+        return;
+    }
+    int c = getc(f);
+    ungetc(c, f);
+    Type1Reader *reader;
+    if (c == 128)
+        reader = new Type1PFBReader(f);
+    else
+        reader = new Type1PFAReader(f);
+    Type1Font *font = new Type1Font(*reader);
+    if (font->ok()) {
+        CatalogFace cf;
+        cf.outlines = CatalogFace::O_TYPE1;
+        cf.names[CatalogFace::N_POSTSCRIPT] = font->font_name();
+        String s;
+        if (Type1Definition *t1d = font->fi_dict("FamilyName"))
+            if (t1d->value_string(s))
+                cf.names[CatalogFace::N_FAMILY] = s;
+        if (Type1Definition *t1d = font->fi_dict("FullName"))
+            if (t1d->value_string(s))
+                cf.names[CatalogFace::N_FULLNAME] = s;
+        if (Type1Definition *t1d = font->fi_dict("Weight"))
+            if (t1d->value_string(s))
+                cf.names[CatalogFace::N_SUBFAMILY] = s;
+        if (Type1Definition *t1d = font->fi_dict("version"))
+            if (t1d->value_string(s))
+                cf.names[CatalogFace::N_VERSION] = s;
+        cfile.faces.push_back(cf);
+    } else
+        errh->error("not a Type 1 font");
+    delete font;
+    delete reader;
+    fclose(f);
+}
+
+
+/*****
+ * refresh
+ **/
+
+namespace {
+class RefreshTask : public ParallelTask { public:
+
+    RefreshTask(int n)                  : files(n, (const char *) 0), old_checksums(n, (const char *) 0), results(n, CatalogFile()), status(n, (int) R_NOTFONT) {
+        for (int i = 0; i < n; ++i)
+            errhs.push_back(new DeferredErrorHandler);
+    }
+    ~RefreshTask() {
+        for (DeferredErrorHandler **e = errhs.begin(); e != errhs.end(); ++e)
+            delete *e;
+    }
+
+    void *thread_begin(bool)            { return 0; }
+    void run(int item, void *) {
+        LandmarkErrorHandler cerrh(errhs[item], String(files[item]));
+        status[item] = read_file(files[item], old_checksums[item], results[item], &cerrh);
+    }
+    void thread_end(void *)             { }
+
+    // Worker threads see file names and old checksums only as C strings.
+    Vector<const char *> files;
+    Vector<const char *> old_checksums;
+    Vector<CatalogFile> results;
+    Vector<int> status;
+    Vector<DeferredErrorHandler *> errhs;
+
+};
+}
+
+int
+FontCatalog::refresh(const Vector<String> &filenames, ErrorHandler *errh)
+{
+    if (!errh)
+        errh = ErrorHandler::silent_handler();
+
+    HashMap<String, int> old_index(-1);
+    for (int i = 0; i < _files.size(); ++i)
+        old_index.insert(_files[i].filename, i);
+
+    Vector<CatalogFile> files;
+    Vector<int> old(filenames.size(), -1);
+    Vector<int> work;
+    for (int i = 0; i < filenames.size(); ++i) {
+        files.push_back(CatalogFile());
+        CatalogFile &cfile = files.back();
+        cfile.filename = filenames[i];
+        struct stat st;
+        if (stat(filenames[i].c_str(), &st) < 0) {
+            errh->error("%s: %s", filenames[i].c_str(), strerror(errno));
+            continue;
+        }
+        cfile.mtime = st.st_mtime;
+        cfile.size = st.st_size;
+        old[i] = old_index[filenames[i]];
+        if (old[i] >= 0 && _files[old[i]].mtime == cfile.mtime
+            && _files[old[i]].size == cfile.size) {
+            cfile.checksum = _files[old[i]].checksum;
+            cfile.faces = _files[old[i]].faces;
+        } else
+            work.push_back(i);
+    }
+
+    RefreshTask task(work.size());
+    for (int w = 0; w < work.size(); ++w) {
+        task.files[w] = files[work[w]].filename.c_str();
+        if (old[work[w]] >= 0 && _files[old[work[w]]].checksum.length() == MD5_DIGEST_SIZE)
+            task.old_checksums[w] = _files[old[work[w]]].checksum.data();
+    }
+    run_parallel(task, work.size());
+
+    int nread = 0;
+    for (int w = 0; w < work.size(); ++w) {
+        CatalogFile &cfile = files[work[w]];
+        task.errhs[w]->replay(errh);
+        if (task.status[w] == R_UNCHANGED) {
+            cfile.checksum = _files[old[work[w]]].checksum;
+            cfile.faces = _files[old[work[w]]].faces;
+        } else {
+            cfile.checksum = task.results[w].checksum;
+            cfile.faces = task.results[w].faces;
+            if (task.status[w] == R_TYPE1) {
+                LandmarkErrorHandler cerrh(errh, cfile.filename);
+                read_type1_file(cfile.filename, cfile, &cerrh);
+            }
+            if (task.status[w] != R_NOTFONT)
+                ++nread;
+        }
+    }
+
+    // drop files that are not fonts
+    _files.clear();
+    for (CatalogFile *cfile = files.begin(); cfile != files.end(); ++cfile)
+        if (cfile->faces.size())
+            _files.push_back(*cfile);
+    return nread;
+}
+
+
+/*****
+ * index files
+ **/
+
+// INDEX FORMAT (all integers big-endian):
+// ULONG    magic ('LFCT')
+// ULONG    version
+// ULONG    fileCount
+// File:    string filename, ULONG mtime[2], ULONG size[2], string checksum,
+//          ULONG faceCount, Face[faceCount]
+// Face:    LONG face, ULONG outlines, string names[7],
+//          ULONG scriptCount, string scripts[scriptCount],
+//          ULONG pairCount, ULONG pairs[2 * pairCount],
+//          LONG designSize, LONG sizeRange[2] (hundredths of a point),
+//          ULONG sizeSubfamilyID, string sizeSubfamilyName,
+//          ULONG unicodeCount, ULONG pageCount, ULONG pages[pageCount],
+//          32bytes bitmaps[pageCount]
+// string:  ULONG length, BYTE data[length]
+
+static void
+append_u32(StringAccum &sa, uint32_t x)
+{
+    sa << (char) (x >> 24) << (char) (x >> 16) << (char) (x >> 8) << (char) x;
+}
+
+static void
+append_string(StringAccum &sa, const String &s)
+{
+    append_u32(sa, s.length());
+    sa << s;
+}
+
+static inline int32_t
+hundredths(double x)
+{
+    return (int32_t) (x * 100 + (x < 0 ? -0.5 : 0.5));
+}
+
+int
+FontCatalog::write(const String &filename, ErrorHandler *errh) const
+{
+    if (!errh)
+        errh = ErrorHandler::silent_handler();
+
+    StringAccum sa;
+    append_u32(sa, MAGIC);
+    append_u32(sa, FORMAT_VERSION);
+    append_u32(sa, _files.size());
+    for (const CatalogFile *cfile = _files.begin(); cfile != _files.end(); ++cfile) {
+        append_string(sa, cfile->filename);
+        append_u32(sa, cfile->mtime >> 32);
+        append_u32(sa, cfile->mtime);
+        append_u32(sa, cfile->size >> 32);
+        append_u32(sa, cfile->size);
+        append_string(sa, cfile->checksum);
+        append_u32(sa, cfile->faces.size());
+        for (const CatalogFace *cf = cfile->faces.begin(); cf != cfile->faces.end(); ++cf) {
+            append_u32(sa, cf->face);
+            append_u32(sa, cf->outlines);
+            for (int n = 0; n < CatalogFace::NNAMES; ++n)
+                append_string(sa, cf->names[n]);
+            append_u32(sa, cf->scripts.size());
+            for (const String *s = cf->scripts.begin(); s != cf->scripts.end(); ++s)
+                append_string(sa, *s);
+            append_u32(sa, cf->script_features.size() / 2);
+            for (const uint32_t *p = cf->script_features.begin(); p != cf->script_features.end(); ++p)
+                append_u32(sa, *p);
+            append_u32(sa, hundredths(cf->design_size));
+            append_u32(sa, hundredths(cf->size_range[0]));
+            append_u32(sa, hundredths(cf->size_range[1]));
+            append_u32(sa, cf->size_subfamily_id);
+            append_string(sa, cf->size_subfamily_name);
+            append_u32(sa, cf->unicode._count);
+            append_u32(sa, cf->unicode._pages.size());
+            for (const uint32_t *p = cf->unicode._pages.begin(); p != cf->unicode._pages.end(); ++p)
+                append_u32(sa, *p);
+            sa << cf->unicode._bits;
+        }
+    }
+
+    if (int r = replace_file(filename, sa.take_string()))
+        return errh->error("%s: %s", filename.c_str(), strerror(-r));
+    return 0;
+}
+
+namespace {
+class IndexReader { public:
+
+    IndexReader(const String &str)      : _s(str.udata()), _end(str.uend()) { }
+
+    bool ok() const                     { return _s != 0; }
+    bool at_end() const                 { return _s == _end; }
+
+    uint32_t u32() {
+        if (_s && _end - _s >= 4) {
+            uint32_t x = OpenType::Data::u32(_s);
+            _s += 4;
+            return x;
+        }
+        _s = 0;
+        return 0;
+    }
+    String string(int len) {
+        if (_s && len >= 0 && _end - _s >= len) {
+            String x(reinterpret_cast<const char *>(_s), len);
+            _s += len;
+            return x;
+        }
+        _s = 0;
+        return String();
+    }
+    String string()                     { return string(u32()); }
+    // Guards counts against the remaining data so a corrupt index cannot
+    // cause huge allocations.
+    uint32_t count(int min_size) {
+        uint32_t n = u32();
+        if (_s && n > (uint32_t) (_end - _s) / min_size)
+            _s = 0;
+        return _s ? n : 0;
+    }
+
+  private:
+
+    const unsigned char *_s;
+    const unsigned char *_end;
+
+};
+}
+
+int
+FontCatalog::read(const String &filename, ErrorHandler *errh)
+{
+    if (!errh)
+        errh = ErrorHandler::silent_handler();
+    _files.clear();
+
+    FILE *f = fopen(filename.c_str(), "rb");
+    if (!f)
+        return errh->error("%s: %s", filename.c_str(), strerror(errno));
+    StringAccum sa;
+    int amt;
+    do {
+        if (char *x = sa.reserve(8192)) {
+            amt = fread(x, 1, 8192, f);
+            sa.adjust_length(amt);
+        } else
+            amt = 0;
+    } while (amt != 0);
+    fclose(f);
+
+    String data = sa.take_string();
+    IndexReader r(data);
+    if (r.u32() != MAGIC || r.u32() != FORMAT_VERSION)
+        return errh->error("%s: not a font catalog", filename.c_str());
+    uint32_t nfiles = r.count(4);
+    for (uint32_t i = 0; i < nfiles && r.ok(); ++i) {
+        _files.push_back(CatalogFile());
+        CatalogFile &cfile = _files.back();
+        cfile.filename = r.string();
+        cfile.mtime = (uint64_t) r.u32() << 32;
+        cfile.mtime |= r.u32();
+        cfile.size = (uint64_t) r.u32() << 32;
+        cfile.size |= r.u32();
+        cfile.checksum = r.string();
+        uint32_t nfaces = r.count(4);
+        for (uint32_t j = 0; j < nfaces && r.ok(); ++j) {
+            cfile.faces.push_back(CatalogFace());
+            CatalogFace &cf = cfile.faces.back();
+            cf.face = (int32_t) r.u32();
+            cf.outlines = r.u32();
+            for (int n = 0; n < CatalogFace::NNAMES; ++n)
+                cf.names[n] = r.string();
+            uint32_t nscripts = r.count(4);
+            for (uint32_t k = 0; k < nscripts; ++k)
+                cf.scripts.push_back(r.string());
+            uint32_t npairs = r.count(8);
+            for (uint32_t k = 0; k < 2 * npairs; ++k)
+                cf.script_features.push_back(r.u32());
+            cf.design_size = (int32_t) r.u32() / 100.;
+            cf.size_range[0] = (int32_t) r.u32() / 100.;
+            cf.size_range[1] = (int32_t) r.u32() / 100.;
+            cf.size_subfamily_id = r.u32();
+            cf.size_subfamily_name = r.string();
+            cf.unicode._count = r.u32();
+            uint32_t npages = r.count(4 + UnicodeCoverage::PAGE_BYTES);
+            for (uint32_t k = 0; k < npages; ++k)
+                cf.unicode._pages.push_back(r.u32());
+            cf.unicode._bits = r.string(npages * UnicodeCoverage::PAGE_BYTES);
+        }
+    }
+
+    if (!r.ok() || !r.at_end()) {
+        _files.clear();
+        return errh->error("%s: font catalog corrupted", filename.c_str());
+    }
+    return 0;
+}
+
+}
@@ -339,7 +339,7 @@ default_dict()
 
 Cff::Cff(const String& s, unsigned units_per_em, ErrorHandler* errh)
     : _data_string(s), _data(reinterpret_cast<const uint8_t *>(_data_string.data())), _len(_data_string.length()),
-      _strings_map(-2), _units_per_em(units_per_em)
+      _strings_map(-1), _strings_interned(false), _units_per_em(units_per_em)
 {
     static_assert((sizeof(standard_strings) / sizeof(standard_strings[0])) == NSTANDARD_STRINGS,
                   "NSTANDARD_STRINGS defined incorrectly");
@@ -428,30 +428,37 @@ Cff::sid(PermString s)
         return -1;
 
     // check standard strings
-    if (standard_permstrings_map["a"] < 0)
+    if (standard_permstrings_map.empty()) {
+        standard_permstrings_map.reserve(NSTANDARD_STRINGS);
         for (int i = 0; i < NSTANDARD_STRINGS; i++) {
             if (!standard_permstrings[i])
                 standard_permstrings[i] = PermString(standard_strings[i]);
             standard_permstrings_map.insert(standard_permstrings[i], i);
         }
+    }
     int sid = standard_permstrings_map[s];
     if (sid >= 0)
         return sid;
 
     // check user strings
-    sid = _strings_map[s];
-    if (sid >= -1)
-        return sid;
-
-    for (int i = 0; i < _strings.size(); i++)
-        if (!_strings[i] && s.length() == _strings_index[i+1] - _strings_index[i] && memcmp(s.c_str(), _strings_index[i], s.length()) == 0) {
-            _strings[i] = s;
-            _strings_map.insert(s, i + NSTANDARD_STRINGS);
-            return i + NSTANDARD_STRINGS;
-        }
+    if (!_strings_interned)
+        intern_strings();
+    return _strings_map[s];
+}
 
-    _strings_map.insert(s, -1);
-    return -1;
+void
+Cff::intern_strings() const
+{
+    // Intern every user string in one pass over the strings INDEX.  If a
+    // string appears twice, its first SID wins.
+    _strings_map.reserve(_strings.size());
+    IndexIterator iter = _strings_index;
+    for (int i = 0; iter && i < _strings.size(); iter++, i++) {
+        if (!_strings[i])
+            _strings[i] = PermString(reinterpret_cast<const char *>(iter[0]), iter[1] - iter[0]);
+        _strings_map.find_force(_strings[i], i + NSTANDARD_STRINGS);
+    }
+    _strings_interned = true;
 }
 
 String
@@ -490,7 +497,6 @@ Cff::sid_permstring(int sid) const
         else {
             PermString s = PermString(reinterpret_cast<const char *>(_strings_index[sid]), _strings_index[sid + 1] - _strings_index[sid]);
             _strings[sid] = s;
-            _strings_map.insert(s, sid + NSTANDARD_STRINGS);
             return s;
         }
     }
@@ -1234,7 +1240,7 @@ Cff::FontParent::gsubr_bias() const
 
 Cff::Font::Font(Cff *cff, PermString font_name, const Dict &top_dict, ErrorHandler *errh)
     : ChildFont(cff, 0, 2, top_dict, errh), _font_name(font_name),
-      _t1encoding(0)
+      _glyph_map(-1), _t1encoding(0)
 {
     assert(!_top_dict.has_first(oROS));
     if (_error < 0)
@@ -1409,7 +1415,7 @@ Cff::Font::glyph(int gid) const
 Charstring *
 Cff::Font::glyph(PermString name) const
 {
-    int gid = _charset.sid_to_gid(_cff->sid(name));
+    int gid = glyphid(name);
     if (gid < 0)
         return 0;
     if (!_charstrings_cs[gid])
@@ -1417,10 +1423,38 @@ Cff::Font::glyph(PermString name) const
     return _charstrings_cs[gid];
 }
 
+void
+Cff::Font::make_glyph_map() const
+{
+    // One pass over the charset.  A name resolves only through the SID
+    // that Cff::sid() returns for it, as when glyphid() searched by SID: a
+    // glyph whose charset entry uses a later copy of a string, or a user
+    // copy of a standard string, cannot be found by name.
+    _glyph_map.reserve(_charset.nglyphs());
+    for (int g = 0; g < _charset.nglyphs(); g++) {
+        int sid = _charset.gid_to_sid(g);
+        PermString name = _cff->sid_permstring(sid);
+        if (name && _cff->sid(name) == sid)
+            _glyph_map.insert(name, g);
+    }
+}
+
 int
 Cff::Font::glyphid(PermString name) const
 {
-    return _charset.sid_to_gid(_cff->sid(name));
+    if (_glyph_map.empty())
+        make_glyph_map();
+    return _glyph_map[name];
+}
+
+void
+Cff::Font::glyphids(const Vector<PermString> &names, Vector<int> &gids) const
+{
+    if (_glyph_map.empty())
+        make_glyph_map();
+    gids.resize(names.size());
+    for (int i = 0; i < names.size(); i++)
+        gids[i] = _glyph_map[names[i]];
 }
 
 Type1Encoding *
@@ -1603,6 +1637,14 @@ Cff::CIDFont::glyphid(PermString name) const
     return _charset.sid_to_gid(cid);
 }
 
+void
+Cff::CIDFont::glyphids(const Vector<PermString> &names, Vector<int> &gids) const
+{
+    gids.resize(names.size());
+    for (int i = 0; i < names.size(); i++)
+        gids[i] = CIDFont::glyphid(names[i]);
+}
+
 Charstring *
 Cff::CIDFont::glyph(PermString name) const
 {
@@ -21,8 +21,22 @@
 #include <efont/afm.hh>
 #include <efont/amfm.hh>
 #include <efont/psres.hh>
+#include <efont/otfdata.hh>
+#include <lcdf/straccum.hh>
+#include <lcdf/error.hh>
+#include <lcdf/filename.hh>
 #include <string.h>
 #include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+# include <sys/mman.h>
+#endif
 namespace Efont {
 
 MetricsFinder::~MetricsFinder()
@@ -99,12 +113,28 @@ MetricsFinder::find_amfm_x(PermString, MetricsFinder *, ErrorHandler *)
     return 0;
 }
 
+Metrics *
+MetricsFinder::read_metrics_file(const Filename &fn, ErrorHandler *errh)
+{
+    Metrics *m;
+    for (MetricsFinder *f = this; f; f = f->_next)
+        if (f->read_metrics_file_x(fn, m, errh))
+            return m;
+    return AfmReader::read(fn, errh);
+}
+
+bool
+MetricsFinder::read_metrics_file_x(const Filename &, Metrics *&, ErrorHandler *)
+{
+    return false;
+}
+
 Metrics *
 MetricsFinder::try_metrics_file(const Filename &fn, MetricsFinder *finder,
                                 ErrorHandler *errh)
 {
     if (fn.readable()) {
-        Metrics *afm = AfmReader::read(fn, errh);
+        Metrics *afm = finder->read_metrics_file(fn, errh);
         if (afm) finder->record(afm);
         return afm;
     } else
@@ -189,6 +219,352 @@ CacheMetricsFinder::clear()
 }
 
 
+/*****
+ * PersistentMetricsFinder
+ **/
+
+// COMPILED METRICS FORMAT (all integers big-endian; a DOUBLE is the bits
+// of an IEEE 754 double, high word first):
+// ULONG    magic ('LFMC')
+// ULONG    version
+// string   sourceKey (identifies the AFM file and its version)
+// string   fontName, family, fullName, weight, version
+// DOUBLE   scale
+// ULONG    fdCount, DOUBLE fd[fdCount]
+// ULONG    glyphCount, string names[glyphCount]
+// DOUBLE   wd[glyphCount], lf[glyphCount], rt[glyphCount],
+//          tp[glyphCount], bt[glyphCount]
+// LONG     codes[glyphCount]
+// ULONG    kernCount, DOUBLE kerns[kernCount]
+// ULONG    reversed
+// ULONG    opCount, Op[opCount]
+// LONG     leftMap[glyphCount]
+// ULONG    hasAfmXt, then if hasAfmXt is nonzero:
+//          string notice, encodingScheme
+//          ULONG commentCount, string comments[commentCount]
+// Op:      LONG left, right, result, value, nextLeft
+// string:  ULONG length, BYTE data[length]
+
+static void
+append_u32(StringAccum &sa, uint32_t x)
+{
+    sa << (char) (x >> 24) << (char) (x >> 16) << (char) (x >> 8) << (char) x;
+}
+
+static void
+append_double(StringAccum &sa, double d)
+{
+    uint64_t x;
+    memcpy(&x, &d, sizeof(x));
+    append_u32(sa, x >> 32);
+    append_u32(sa, x);
+}
+
+static void
+append_string(StringAccum &sa, const char *s, int len)
+{
+    append_u32(sa, len);
+    sa.append(s, len);
+}
+
+static void
+append_string(StringAccum &sa, PermString s)
+{
+    append_string(sa, s.c_str(), s.length());
+}
+
+namespace {
+class CompiledReader { public:
+
+    CompiledReader(const String &str)   : _s(str.udata()), _end(str.uend()) { }
+
+    bool ok() const                     { return _s != 0; }
+    bool at_end() const                 { return _s == _end; }
+    void fail()                         { _s = 0; }
+
+    uint32_t u32() {
+        if (_s && _end - _s >= 4) {
+            uint32_t x = OpenType::Data::u32(_s);
+            _s += 4;
+            return x;
+        }
+        _s = 0;
+        return 0;
+    }
+    double f64() {
+        uint64_t x = (uint64_t) u32() << 32;
+        x |= u32();
+        double d;
+        memcpy(&d, &x, sizeof(d));
+        return d;
+    }
+    // Glyph indexes and similar: -1 <= x < limit.
+    int index(int limit) {
+        int32_t x = (int32_t) u32();
+        if (x < -1 || x >= limit)
+            _s = 0;
+        return _s ? x : -1;
+    }
+    PermString permstring() {
+        uint32_t len = u32();
+        if (_s && len <= (uint32_t) (_end - _s)) {
+            PermString x(reinterpret_cast<const char *>(_s), len);
+            _s += len;
+            return x;
+        }
+        _s = 0;
+        return PermString();
+    }
+    bool string_equals(const String &str) {
+        uint32_t len = u32();
+        if (_s && len <= (uint32_t) (_end - _s)
+            && str.equals(reinterpret_cast<const char *>(_s), len)) {
+            _s += len;
+            return true;
+        }
+        _s = 0;
+        return false;
+    }
+    // Guards counts against the remaining data so a corrupt file cannot
+    // cause huge allocations.
+    uint32_t count(int min_size) {
+        uint32_t n = u32();
+        if (_s && n > (uint32_t) (_end - _s) / min_size)
+            _s = 0;
+        return _s ? n : 0;
+    }
+
+  private:
+
+    const unsigned char *_s;
+    const unsigned char *_end;
+
+};
+}
+
+String
+PersistentMetricsFinder::compile(const Metrics *m, const String &source_key)
+{
+    StringAccum sa;
+    append_u32(sa, MAGIC);
+    append_u32(sa, FORMAT_VERSION);
+    append_string(sa, source_key.data(), source_key.length());
+    append_string(sa, m->_font_name);
+    append_string(sa, m->_family);
+    append_string(sa, m->_full_name);
+    append_string(sa, m->_weight);
+    append_string(sa, m->_version);
+    append_double(sa, m->_scale);
+
+    append_u32(sa, m->_fdv.size());
+    for (int i = 0; i < m->_fdv.size(); i++)
+        append_double(sa, m->_fdv[i]);
+
+    int nglyphs = m->nglyphs();
+    append_u32(sa, nglyphs);
+    for (int gi = 0; gi < nglyphs; gi++)
+        append_string(sa, m->_names[gi]);
+    const Vector<double> *dimens[] = {
+        &m->_wdv, &m->_lfv, &m->_rtv, &m->_tpv, &m->_btv
+    };
+    for (int d = 0; d < 5; d++)
+        for (int gi = 0; gi < nglyphs; gi++)
+            append_double(sa, (*dimens[d])[gi]);
+    for (int gi = 0; gi < nglyphs; gi++)
+        append_u32(sa, m->code(gi));
+
+    append_u32(sa, m->_kernv.size());
+    for (int i = 0; i < m->_kernv.size(); i++)
+        append_double(sa, m->_kernv[i]);
+
+    const PairProgram &pp = m->_pairp;
+    append_u32(sa, pp._reversed);
+    append_u32(sa, pp._op.size());
+    for (const PairOp *op = pp._op.begin(); op != pp._op.end(); ++op) {
+        append_u32(sa, op->left());
+        append_u32(sa, op->right());
+        append_u32(sa, op->is_lig() ? op->result() : 0);
+        append_u32(sa, op->value());
+        append_u32(sa, op->next_left());
+    }
+    for (int gi = 0; gi < nglyphs; gi++)
+        append_u32(sa, pp.find_left(gi));
+
+    if (AfmMetricsXt *xt = static_cast<AfmMetricsXt *>(m->find_xt("AFM"))) {
+        append_u32(sa, 1);
+        append_string(sa, xt->notice);
+        append_string(sa, xt->encoding_scheme);
+        append_u32(sa, xt->opening_comments.size());
+        for (int i = 0; i < xt->opening_comments.size(); i++)
+            append_string(sa, xt->opening_comments[i]);
+    } else
+        append_u32(sa, 0);
+
+    return sa.take_string();
+}
+
+Metrics *
+PersistentMetricsFinder::load(const String &data, const String &source_key)
+{
+    CompiledReader r(data);
+    if (r.u32() != MAGIC || r.u32() != FORMAT_VERSION
+        || !r.string_equals(source_key))
+        return 0;
+
+    Metrics *m = new Metrics;
+    m->_font_name = r.permstring();
+    m->_family = r.permstring();
+    m->_full_name = r.permstring();
+    m->_weight = r.permstring();
+    m->_version = r.permstring();
+    m->_scale = r.f64();
+
+    uint32_t nfd = r.count(8);
+    m->_fdv.resize(nfd, 0);
+    for (uint32_t i = 0; i < nfd; i++)
+        m->_fdv[i] = r.f64();
+
+    // Size every per-glyph array once; the loops below only fill them.
+    int nglyphs = r.count(4 + 5 * 8 + 4 + 4);
+    m->reserve_glyphs(nglyphs);
+    m->_names.reserve(nglyphs);
+    m->_name_map.reserve(nglyphs);
+    for (int gi = 0; gi < nglyphs; gi++) {
+        PermString name = r.permstring();
+        m->_names.push_back(name);
+        m->_name_map.insert(name, gi);
+    }
+    Vector<double> *dimens[] = {
+        &m->_wdv, &m->_lfv, &m->_rtv, &m->_tpv, &m->_btv
+    };
+    for (int d = 0; d < 5; d++)
+        for (int gi = 0; gi < nglyphs; gi++)
+            (*dimens[d])[gi] = r.f64();
+    for (int gi = 0; gi < nglyphs; gi++) {
+        int c = r.index(256);
+        if (c >= 0)
+            m->set_code(gi, c);
+    }
+
+    uint32_t nkv = r.count(8);
+    m->_kernv.resize(nkv, 0);
+    for (uint32_t i = 0; i < nkv; i++)
+        m->_kernv[i] = r.f64();
+
+    PairProgram &pp = m->_pairp;
+    pp._reversed = r.u32() != 0;
+    int nops = r.count(20);
+    pp._op.reserve(nops);
+    for (int i = 0; i < nops; i++) {
+        GlyphIndex left = r.index(nglyphs), right = r.index(nglyphs),
+            result = r.index(nglyphs);
+        int value = (int32_t) r.u32();
+        PairOpIndex next_left = r.index(nops);
+        if (value >= (int) nkv)
+            r.fail();
+        if (value <= opLigature)
+            pp._op.push_back(PairOp(left, right, result, opLigature - value, next_left));
+        else
+            pp._op.push_back(PairOp(left, right, value, next_left));
+    }
+    for (int gi = 0; gi < nglyphs; gi++)
+        pp._left_map[gi] = r.index(nops);
+
+    if (r.u32()) {
+        AfmMetricsXt *xt = new AfmMetricsXt;
+        m->add_xt(xt);
+        xt->notice = r.permstring();
+        xt->encoding_scheme = r.permstring();
+        uint32_t ncomments = r.count(4);
+        for (uint32_t i = 0; i < ncomments && r.ok(); i++)
+            xt->opening_comments.push_back(r.permstring());
+    }
+
+    if (!r.ok() || !r.at_end()) {
+        delete m;
+        return 0;
+    }
+    return m;
+}
+
+
+static String
+map_compiled_file(const String &filename, void *&map, size_t &map_len)
+{
+    map = 0;
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return String();
+    struct stat st;
+    String data;
+    if (fstat(fd, &st) >= 0 && st.st_size > 0 && st.st_size < 0x7FFFFFFF) {
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+        void *m = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m != MAP_FAILED) {
+            map = m;
+            map_len = st.st_size;
+            data = String::make_stable((const char *) m, st.st_size);
+        }
+#endif
+        if (!map) {
+            StringAccum sa;
+            char *x = sa.extend(st.st_size);
+            if (x && read(fd, x, st.st_size) == st.st_size)
+                data = sa.take_string();
+        }
+    }
+    close(fd);
+    return data;
+}
+
+PersistentMetricsFinder::PersistentMetricsFinder(const String &directory)
+    : _directory(directory)
+{
+}
+
+bool
+PersistentMetricsFinder::read_metrics_file_x(const Filename &fn, Metrics *&m,
+                                             ErrorHandler *errh)
+{
+    struct stat st;
+    if (!_directory || fn.fake() || stat(fn.path().c_str(), &st) < 0
+        || !S_ISREG(st.st_mode))
+        return false;
+
+    StringAccum sa;
+    sa << fn.path() << '\0' << (unsigned long) st.st_dev
+       << ':' << (unsigned long) st.st_ino
+       << ':' << (unsigned long) st.st_size
+       << ':' << (long) st.st_mtime;
+    String source_key = sa.take_string();
+    sa.snprintf(20, "/%08x.afmc", (unsigned) hashcode(fn.path()));
+    String filename = _directory + sa.take_string();
+
+    void *map;
+    size_t map_len;
+    String data = map_compiled_file(filename, map, map_len);
+    m = data ? load(data, source_key) : 0;
+    data = String();
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+    if (map)
+        munmap(map, map_len);
+#endif
+    if (m)
+        return true;
+
+    m = AfmReader::read(fn, errh);
+    if (m) {
+        // replace_file() uses a unique temporary name, so programs sharing
+        // the directory cannot write over each other; a cache file that
+        // cannot be written is only a warning
+        int r = replace_file(filename, compile(m, source_key));
+        if (r < 0 && errh)
+            errh->warning("%s: %s", filename.c_str(), strerror(-r));
+    }
+    return true;
+}
+
+
 /*****
  * InstanceMetricsFinder
  **/
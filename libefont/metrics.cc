@@ -117,6 +117,91 @@ Metrics::interpolate_dimens(const Metrics &m, double scale, bool increment)
 }
 
 
+namespace {
+// An instance's nonzero master weights, in master order.
+struct DimenBlend {
+  Vector<int> master;
+  Vector<double> weight;
+  bool copy_first;              // set_dimen copies weights near 1
+};
+}
+
+// Set dest[i][j], for j < n, to the blend of src arrays given by blends[i].
+// The arrays are processed in blocks, so every instance reads a block of
+// master data while it is in cache; the inner loops are simple enough for
+// the compiler to vectorize.  The arithmetic is done in the same order as
+// set_dimen, so results are identical.
+static void
+blend_dimens(const Vector<double *> &dest, const Vector<const double *> &src,
+             const Vector<DimenBlend> &blends, int n)
+{
+  enum { block = 512 };
+  for (int j0 = 0; j0 < n; j0 += block) {
+    int j1 = (n - j0 < block ? n : j0 + block);
+    for (int i = 0; i < blends.size(); i++) {
+      const DimenBlend &b = blends[i];
+      double *d = dest[i];
+      const double *s = src[b.master[0]];
+      double w = b.weight[0];
+      if (b.copy_first)
+        for (int j = j0; j < j1; j++)
+          d[j] = s[j];
+      else
+        for (int j = j0; j < j1; j++)
+          d[j] = s[j] * w;
+      for (int k = 1; k < b.master.size(); k++) {
+        s = src[b.master[k]];
+        w = b.weight[k];
+        for (int j = j0; j < j1; j++)
+          d[j] += s[j] * w;
+      }
+    }
+  }
+}
+
+void
+Metrics::interpolate_dimens(const Vector<Metrics *> &instances,
+                            const Vector<Metrics *> &masters,
+                            const Vector<Vector<double> > &weights)
+{
+  Vector<DimenBlend> blends(instances.size(), DimenBlend());
+  const Metrics *proto = 0;
+  for (int i = 0; i < instances.size(); i++) {
+    DimenBlend &b = blends[i];
+    for (int m = 0; m < masters.size(); m++)
+      if (weights[i][m]) {
+        b.master.push_back(m);
+        b.weight.push_back(weights[i][m]);
+        if (!proto)
+          proto = masters[m];
+      }
+    assert(b.master.size());
+    b.copy_first = b.weight[0] >= 0.9999 && b.weight[0] <= 1.0001;
+  }
+  if (!proto)
+    return;
+
+  Vector<double> Metrics::*dimens[] = {
+    &Metrics::_fdv, &Metrics::_wdv, &Metrics::_lfv, &Metrics::_rtv,
+    &Metrics::_tpv, &Metrics::_btv, &Metrics::_kernv
+  };
+  Vector<double *> dest(instances.size(), 0);
+  Vector<const double *> src(masters.size(), 0);
+  for (int d = 0; d < (int) (sizeof(dimens) / sizeof(dimens[0])); d++) {
+    int n = (proto->*dimens[d]).size();
+    for (int i = 0; i < instances.size(); i++) {
+      Vector<double> &v = instances[i]->*dimens[d];
+      if (v.size() < n)
+        v.resize(n, UNKDOUBLE);
+      dest[i] = v.begin();
+    }
+    for (int m = 0; m < masters.size(); m++)
+      src[m] = masters[m] ? (masters[m]->*dimens[d]).begin() : 0;
+    blend_dimens(dest, src, blends, n);
+  }
+}
+
+
 void
 Metrics::add_xt(MetricsXt *mxt)
 {
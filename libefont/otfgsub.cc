@@ -120,7 +120,8 @@ Substitution::Substitution(const Substitution &o)
 }
 
 Substitution::Substitution(Glyph in, Glyph out)
-    : _left_is(T_NONE), _in_is(T_GLYPH), _out_is(T_GLYPH), _right_is(T_NONE)
+    : _left_is(T_NONE), _in_is(T_GLYPH), _out_is(T_GLYPH), _right_is(T_NONE),
+      _alternate(false)
 {
     _in.gid = in;
     _out.gid = out;
@@ -136,7 +137,8 @@ Substitution::Substitution(Glyph in, const Vector<Glyph> &out, bool is_alternate
 }
 
 Substitution::Substitution(Glyph in1, Glyph in2, Glyph out)
-    : _left_is(T_NONE), _in_is(T_GLYPHS), _out_is(T_GLYPH), _right_is(T_NONE)
+    : _left_is(T_NONE), _in_is(T_GLYPHS), _out_is(T_GLYPH), _right_is(T_NONE),
+      _alternate(false)
 {
     _in.gids = new Glyph[3];
     _in.gids[0] = 2;
@@ -146,7 +148,8 @@ Substitution::Substitution(Glyph in1, Glyph in2, Glyph out)
 }
 
 Substitution::Substitution(const Vector<Glyph> &in, Glyph out)
-    : _left_is(T_NONE), _in_is(T_NONE), _out_is(T_GLYPH), _right_is(T_NONE)
+    : _left_is(T_NONE), _in_is(T_NONE), _out_is(T_GLYPH), _right_is(T_NONE),
+      _alternate(false)
 {
     assert(in.size() > 0);
     assign(_in, _in_is, in.size(), &in[0]);
@@ -154,7 +157,8 @@ Substitution::Substitution(const Vector<Glyph> &in, Glyph out)
 }
 
 Substitution::Substitution(int nin, const Glyph *in, Glyph out)
-    : _left_is(T_NONE), _in_is(T_NONE), _out_is(T_GLYPH), _right_is(T_NONE)
+    : _left_is(T_NONE), _in_is(T_NONE), _out_is(T_GLYPH), _right_is(T_NONE),
+      _alternate(false)
 {
     assert(nin > 0);
     assign(_in, _in_is, nin, in);
@@ -162,7 +166,8 @@ Substitution::Substitution(int nin, const Glyph *in, Glyph out)
 }
 
 Substitution::Substitution(int nleft, int nin, int nout, int nright)
-    : _left_is(T_NONE), _in_is(T_NONE), _out_is(T_NONE), _right_is(T_NONE)
+    : _left_is(T_NONE), _in_is(T_NONE), _out_is(T_NONE), _right_is(T_NONE),
+      _alternate(false)
 {
     if (nleft)
         assign_space(_left, _left_is, nleft);
@@ -193,6 +198,25 @@ Substitution::operator=(const Substitution &o)
     return *this;
 }
 
+#if __cplusplus >= 201103L
+Substitution &
+Substitution::operator=(Substitution &&o) noexcept
+{
+    if (&o != this) {
+        std::swap(_left, o._left);
+        std::swap(_in, o._in);
+        std::swap(_out, o._out);
+        std::swap(_right, o._right);
+        std::swap(_left_is, o._left_is);
+        std::swap(_in_is, o._in_is);
+        std::swap(_out_is, o._out_is);
+        std::swap(_right_is, o._right_is);
+        _alternate = o._alternate;
+    }
+    return *this;
+}
+#endif
+
 bool
 Substitution::substitute_in(const Substitute &s, uint8_t t, const Coverage &c)
 {
@@ -581,6 +605,10 @@ Gsub::Gsub(const Data &d, const Font *otf, ErrorHandler *errh)
     if (_feature_list.assign(d.offset_subtable(6), errh) < 0)
         throw Format("GSUB feature list");
     _lookup_list = d.offset_subtable(8);
+    if (_lookup_list.length() >= 2) {
+        _ligature_tries.resize(nlookups());
+        _ligature_trie_state.resize(nlookups(), 0);
+    }
 
     if (!otf)
         return;
@@ -590,7 +618,7 @@ Gsub::Gsub(const Data &d, const Font *otf, ErrorHandler *errh)
     try {
         Name nametable(otf->table("name"), ErrorHandler::silent_handler());
         _chaincontext_reverse_backtrack = nametable.version_chaincontext_reverse_backtrack();
-    } catch (Error) {
+    } catch (const Error &) {
     }
 }
 
@@ -609,6 +637,285 @@ Gsub::lookup(unsigned i) const
         return GsubLookup(_lookup_list.offset_subtable(2 + i*2));
 }
 
+bool
+Gsub::apply(int i, const Glyph *g, int pos, int n, Substitution &s) const
+{
+    GsubLookup l = lookup(i);
+    if (l.type() != GsubLookup::L_LIGATURE)
+        return l.apply(g, pos, n, s);
+
+    // contextual lookups apply the same ligature lookups many times, so
+    // compile them once
+    const Vector<GsubLigatureTrie> *tries = ligature_tries(i, l);
+    if (!tries)
+        return l.apply(g, pos, n, s);
+    for (const GsubLigatureTrie *t = tries->begin(); t != tries->end(); ++t)
+        if (t->apply(g, pos, n, s))
+            return true;
+    return false;
+}
+
+const Vector<GsubLigatureTrie> *
+Gsub::ligature_tries(int i, const GsubLookup &l) const
+{
+#if HAVE_ATOMIC_BUILTINS
+    int *state = &_ligature_trie_state[i];
+    int unclaimed = 0;
+    if (__atomic_load_n(state, __ATOMIC_ACQUIRE) == 2)
+        return &_ligature_tries[i];
+    else if (!__atomic_compare_exchange_n(state, &unclaimed, 1, false,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        return 0;
+
+    Vector<GsubLigatureTrie> &tries = _ligature_tries[i];
+    try {
+        for (int j = 0; j < l.nsubtables(); ++j)
+            tries.push_back(GsubLigatureTrie(GsubLigature(l.subtable(j))));
+    } catch (...) {
+        tries.clear();
+        __atomic_store_n(state, 0, __ATOMIC_RELEASE);
+        throw;
+    }
+    __atomic_store_n(state, 2, __ATOMIC_RELEASE);
+    return &tries;
+#else
+    // without atomic builtins, compiled lookups cannot be published safely
+    (void) i, (void) l;
+    return 0;
+#endif
+}
+
+namespace {
+struct ClosureLookup {
+    int type;
+    bool active;
+    int done;                   // number of reached glyphs considered
+    Vector<Data> subtables;
+    Vector<Coverage> coverages;
+    Vector<bool> triggered;     // contextual subtables already triggered
+    Vector<Glyph> pending;      // ligatures missing components:
+                                // output, ncomponents, components...
+    ClosureLookup()
+        : type(0), active(false), done(0) {
+    }
+};
+
+struct GsubClosure {
+    const Gsub &gsub;
+    Vector<bool> &glyphs;
+    Vector<Glyph> reached;
+    Vector<ClosureLookup> lookups;
+    Vector<int> active;
+
+    GsubClosure(const Gsub &gsub_, Vector<bool> &glyphs_)
+        : gsub(gsub_), glyphs(glyphs_), lookups(gsub_.nlookups(), ClosureLookup()) {
+    }
+    void reach(Glyph g) {
+        if (g >= 0 && g < glyphs.size() && !glyphs[g]) {
+            glyphs[g] = true;
+            reached.push_back(g);
+        }
+    }
+    bool all_reached(const Glyph *g, int n) const {
+        for (int i = 0; i < n; ++i)
+            if (g[i] < 0 || g[i] >= glyphs.size() || !glyphs[g[i]])
+                return false;
+        return true;
+    }
+    void activate(int lookup);
+    void add_records(const Data &d, int offset, int nrecords);
+    void trigger(ClosureLookup &cl, int subtable);
+    void process(ClosureLookup &cl, Glyph g);
+    void check_pending(ClosureLookup &cl);
+};
+
+void
+GsubClosure::activate(int lookup)
+{
+    if (lookup < 0 || lookup >= lookups.size() || lookups[lookup].active)
+        return;
+    ClosureLookup &cl = lookups[lookup];
+    GsubLookup l = gsub.lookup(lookup);
+    cl.type = l.type();
+    cl.active = true;
+    for (int j = 0; j < l.nsubtables(); ++j) {
+        Data d = l.subtable(j);
+        if (!d)
+            continue;
+        // find the coverage of the first input glyph
+        int coverage_offset = 2;
+        if (cl.type == GsubLookup::L_CONTEXT && d.u16(0) == 3)
+            coverage_offset = GsubContext::F3_HSIZE;
+        else if (cl.type == GsubLookup::L_CHAIN && d.u16(0) == 3)
+            coverage_offset = GsubChainContext::F3_HSIZE + d.u16(2)*2 + GsubChainContext::F3_INPUT_HSIZE;
+        cl.subtables.push_back(d);
+        cl.coverages.push_back(Coverage(d.offset_subtable(coverage_offset)));
+        cl.triggered.push_back(false);
+    }
+    active.push_back(lookup);
+}
+
+void
+GsubClosure::add_records(const Data &d, int offset, int nrecords)
+{
+    for (int i = 0; i < nrecords; ++i)
+        activate(d.u16(offset + i*GsubContext::SUBRECSIZE + 2));
+}
+
+void
+GsubClosure::trigger(ClosureLookup &cl, int j)
+{
+    // Once a contextual subtable can match, treat its nested lookups as
+    // applying to every reached glyph.  This over-approximates the
+    // context, but never misses a glyph.
+    cl.triggered[j] = true;
+    const Data &d = cl.subtables[j];
+    int format = d.u16(0);
+    if (cl.type == GsubLookup::L_CONTEXT && format == 3) {
+        int nglyph = d.u16(2);
+        add_records(d, GsubContext::F3_HSIZE + nglyph*2, d.u16(4));
+    } else if (cl.type == GsubLookup::L_CHAIN && format == 3) {
+        int nbacktrack = d.u16(2);
+        int input_offset = GsubChainContext::F3_HSIZE + nbacktrack*2;
+        int ninput = d.u16(input_offset);
+        int lookahead_offset = input_offset + GsubChainContext::F3_INPUT_HSIZE + ninput*2;
+        int nlookahead = d.u16(lookahead_offset);
+        int subst_offset = lookahead_offset + GsubChainContext::F3_LOOKAHEAD_HSIZE + nlookahead*2;
+        add_records(d, subst_offset + GsubChainContext::F3_SUBST_HSIZE, d.u16(subst_offset));
+    } else if (format == 1 || format == 2) {
+        // rule sets follow the coverage (and class definitions)
+        int set_offset;
+        if (format == 1)
+            set_offset = 6;
+        else
+            set_offset = (cl.type == GsubLookup::L_CONTEXT ? 8 : 12);
+        int nsets = d.u16(set_offset - 2);
+        for (int i = 0; i < nsets; ++i) {
+            if (!d.u16(set_offset + i*2))
+                continue;
+            Data ruleset = d.offset_subtable(set_offset + i*2);
+            for (int r = 0; r < ruleset.u16(0); ++r) {
+                Data rule = ruleset.offset_subtable(2 + r*2);
+                if (cl.type == GsubLookup::L_CONTEXT) {
+                    int nglyph = rule.u16(0);
+                    if (nglyph > 0)
+                        add_records(rule, 4 + (nglyph - 1)*2, rule.u16(2));
+                } else {
+                    int input_offset = 2 + rule.u16(0)*2;
+                    int ninput = rule.u16(input_offset);
+                    if (ninput < 1)
+                        continue;
+                    int lookahead_offset = input_offset + 2 + (ninput - 1)*2;
+                    int subst_offset = lookahead_offset + 2 + rule.u16(lookahead_offset)*2;
+                    add_records(rule, subst_offset + 2, rule.u16(subst_offset));
+                }
+            }
+        }
+    }
+}
+
+void
+GsubClosure::process(ClosureLookup &cl, Glyph g)
+{
+    for (int j = 0; j < cl.subtables.size(); ++j) {
+        int ci = cl.coverages[j].coverage_index(g);
+        if (ci < 0)
+            continue;
+        const Data &d = cl.subtables[j];
+        switch (cl.type) {
+          case GsubLookup::L_SINGLE:
+            if (d.u16(0) == 1)
+                reach((g + d.s16(4)) & 0xFFFF);
+            else
+                reach(d.u16(GsubSingle::HEADERSIZE + ci*GsubSingle::FORMAT2_RECSIZE));
+            break;
+          case GsubLookup::L_MULTIPLE:
+          case GsubLookup::L_ALTERNATE: {
+              Data seq = d.offset_subtable(GsubMultiple::HEADERSIZE + ci*GsubMultiple::RECSIZE);
+              for (int k = 0; k < seq.u16(0); ++k)
+                  reach(seq.u16(GsubMultiple::SEQ_HEADERSIZE + k*GsubMultiple::SEQ_RECSIZE));
+              break;
+          }
+          case GsubLookup::L_LIGATURE: {
+              Data ligset = d.offset_subtable(GsubLigature::HEADERSIZE + ci*GsubLigature::RECSIZE);
+              for (int k = 0; k < ligset.u16(0); ++k) {
+                  Data lig = ligset.offset_subtable(GsubLigature::SET_HEADERSIZE + k*GsubLigature::SET_RECSIZE);
+                  int ncomp = lig.u16(2) - 1;
+                  int pending_pos = cl.pending.size();
+                  cl.pending.push_back(lig.u16(0));
+                  cl.pending.push_back(ncomp);
+                  for (int c = 0; c < ncomp; ++c)
+                      cl.pending.push_back(lig.u16(GsubLigature::LIG_HEADERSIZE + c*GsubLigature::LIG_RECSIZE));
+                  if (all_reached(cl.pending.begin() + pending_pos + 2, ncomp)) {
+                      reach(cl.pending[pending_pos]);
+                      cl.pending.resize(pending_pos);
+                  }
+              }
+              break;
+          }
+          case GsubLookup::L_CONTEXT:
+          case GsubLookup::L_CHAIN:
+            if (!cl.triggered[j])
+                trigger(cl, j);
+            break;
+          case GsubLookup::L_REVCHAIN: {
+              int lookahead_offset = 6 + d.u16(4)*2;
+              int subst_offset = lookahead_offset + 2 + d.u16(lookahead_offset)*2;
+              if (ci < d.u16(subst_offset))
+                  reach(d.u16(subst_offset + 2 + ci*2));
+              break;
+          }
+        }
+    }
+}
+
+void
+GsubClosure::check_pending(ClosureLookup &cl)
+{
+    Glyph *out = cl.pending.begin();
+    for (Glyph *p = cl.pending.begin(); p != cl.pending.end(); ) {
+        int n = p[1] + 2;
+        if (all_reached(p + 2, p[1]))
+            reach(p[0]);
+        else {
+            if (out != p)
+                memmove(out, p, n * sizeof(Glyph));
+            out += n;
+        }
+        p += n;
+    }
+    cl.pending.resize(out - cl.pending.begin());
+}
+}
+
+void
+Gsub::closure(Vector<bool> &glyphs, const Vector<int> &lookups) const
+{
+    GsubClosure c(*this, glyphs);
+    for (int g = 0; g < glyphs.size(); ++g)
+        if (glyphs[g])
+            c.reached.push_back(g);
+    for (const int *l = lookups.begin(); l != lookups.end(); ++l)
+        c.activate(*l);
+
+    // each lookup examines only the glyphs reached since its last visit
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        for (int i = 0; i < c.active.size(); ++i) {
+            ClosureLookup &cl = c.lookups[c.active[i]];
+            int end = c.reached.size();
+            if (cl.done == end)
+                continue;
+            progress = true;
+            for (int k = cl.done; k < end; ++k)
+                cl.done = k + 1, c.process(cl, c.reached[k]);
+            if (cl.pending.size())
+                c.check_pending(cl);
+        }
+    }
+}
+
 
 /**************************
  * GsubLookup             *
@@ -773,6 +1080,15 @@ GsubLookup::apply(const Glyph *g, int pos, int n, Substitution &s) const
     }
 }
 
+int
+GsubLookup::mark_filtering_set() const
+{
+    if (flags() & F_USE_MARK_FILTERING_SET)
+        return _d.u16(HEADERSIZE + nsubtables()*RECSIZE);
+    else
+        return -1;
+}
+
 
 /**************************
  * GsubSingle             *
@@ -1035,6 +1351,124 @@ GsubLigature::apply(const Glyph *g, int pos, int n, Substitution &s) const
 }
 
 
+/**************************
+ * GsubLigatureTrie       *
+ *                        *
+ **************************/
+
+namespace {
+struct LigatureEntryCompare {
+    const Vector<Glyph> &components;
+    const Vector<int> &starts;
+    LigatureEntryCompare(const Vector<Glyph> &c, const Vector<int> &s)
+        : components(c), starts(s) {
+    }
+    bool operator()(int a, int b) const {
+        const Glyph *ap = components.begin() + starts[a], *ae = components.begin() + starts[a + 1];
+        const Glyph *bp = components.begin() + starts[b], *be = components.begin() + starts[b + 1];
+        for (; ap != ae && bp != be; ++ap, ++bp)
+            if (*ap != *bp)
+                return *ap < *bp;
+        if (ap != ae || bp != be)
+            return ap == ae;
+        return a < b;
+    }
+};
+
+struct LigatureTrieWork {
+    int node;
+    int first;
+    int last;
+    int depth;
+    LigatureTrieWork(int n, int f, int l, int d)
+        : node(n), first(f), last(l), depth(d) {
+    }
+};
+}
+
+GsubLigatureTrie::GsubLigatureTrie(const GsubLigature &lig)
+    : _nligatures(0)
+{
+    // collect ligatures in subtable order
+    Vector<Glyph> components;
+    Vector<int> starts;
+    Vector<Glyph> outputs;
+    for (Coverage::iterator i = lig.coverage().begin(); i; i++) {
+        Data ligset = lig._d.offset_subtable(GsubLigature::HEADERSIZE + i.coverage_index()*GsubLigature::RECSIZE);
+        int nligset = ligset.u16(0);
+        for (int j = 0; j < nligset; j++) {
+            Data l = ligset.offset_subtable(GsubLigature::SET_HEADERSIZE + j*GsubLigature::SET_RECSIZE);
+            int nlig = l.u16(2);
+            if (nlig < 1)
+                continue;
+            starts.push_back(components.size());
+            components.push_back(*i);
+            for (int k = 0; k < nlig - 1; k++)
+                components.push_back(l.u16(GsubLigature::LIG_HEADERSIZE + k*GsubLigature::LIG_RECSIZE));
+            outputs.push_back(l.u16(0));
+        }
+    }
+    _nligatures = outputs.size();
+    starts.push_back(components.size());
+
+    // sort them by components, then by order, and build the trie breadth
+    // first so each node's children are contiguous and sorted
+    Vector<int> order;
+    for (int i = 0; i < _nligatures; ++i)
+        order.push_back(i);
+    std::sort(order.begin(), order.end(), LigatureEntryCompare(components, starts));
+
+    Node root = { 0, 0, 0, 0, -1 };
+    _nodes.push_back(root);
+    Vector<LigatureTrieWork> work;
+    work.push_back(LigatureTrieWork(0, 0, _nligatures, 0));
+    for (int w = 0; w < work.size(); ++w) {
+        LigatureTrieWork x = work[w];
+        int a = x.first;
+        // entries that end here sort first; the first one wins
+        if (a < x.last && starts[order[a] + 1] - starts[order[a]] == x.depth) {
+            _nodes[x.node].output = outputs[order[a]];
+            _nodes[x.node].order = order[a];
+            while (a < x.last && starts[order[a] + 1] - starts[order[a]] == x.depth)
+                ++a;
+        }
+        _nodes[x.node].child_begin = _nodes.size();
+        while (a < x.last) {
+            Glyph g = components[starts[order[a]] + x.depth];
+            int b = a + 1;
+            while (b < x.last && components[starts[order[b]] + x.depth] == g)
+                ++b;
+            Node child = { g, 0, 0, 0, -1 };
+            work.push_back(LigatureTrieWork(_nodes.size(), a, b, x.depth + 1));
+            _nodes.push_back(child);
+            a = b;
+        }
+        _nodes[x.node].child_end = _nodes.size();
+    }
+}
+
+bool
+GsubLigatureTrie::apply(const Glyph *g, int pos, int n, Substitution &s) const
+{
+    // among the ligatures matching at pos, the subtable lists the preferred
+    // one first
+    int best = -1, best_length = 0;
+    if (pos < n)
+        for (int node = start(g[pos]), k = pos + 1; node >= 0; ++k) {
+            if (_nodes[node].order >= 0
+                && (best < 0 || _nodes[node].order < _nodes[best].order))
+                best = node, best_length = k - pos;
+            if (k >= n)
+                break;
+            node = next(node, g[k]);
+        }
+    if (best < 0)
+        return false;
+    s = Substitution(best_length, &g[pos], _nodes[best].output);
+    return true;
+}
+
+
 /**************************
  * GsubContext            *
  *                        *
@@ -1102,7 +1536,7 @@ GsubContext::f1_unparse(const Data& data,
         int seq_index = data.u16(subtab_offset + SUBRECSIZE*j);
         int lookup_index = data.u16(subtab_offset + SUBRECSIZE*j + 2);
         // XXX check seq_index against size of output glyphs?
-        if (gsub.lookup(lookup_index).apply(s.out_glyphptr(), seq_index, s.out_nglyphs(), subtab_sub)) {
+        if (gsub.apply(lookup_index, s.out_glyphptr(), seq_index, s.out_nglyphs(), subtab_sub)) {
             napplied++;
             s.out_alter(subtab_sub, seq_index);
         }
@@ -1142,7 +1576,7 @@ GsubContext::f3_unparse(const Data &data,
             int seq_index = data.u16(subtab_offset + SUBRECSIZE*j);
             int lookup_index = data.u16(subtab_offset + SUBRECSIZE*j + 2);
             // XXX check seq_index against size of output glyphs?
-            if (gsub.lookup(lookup_index).apply(s.out_glyphptr(), seq_index, s.out_nglyphs(), subtab_sub)) {
+            if (gsub.apply(lookup_index, s.out_glyphptr(), seq_index, s.out_nglyphs(), subtab_sub)) {
                 napplied++;
                 s.out_alter(subtab_sub, seq_index);
             }
@@ -1339,6 +1773,8 @@ GsubChainContext::f3_unparse(const Gsub &gsub, Vector<Substitution> &v, const Co
         n *= (Coverage(_d.offset_subtable(input_offset + F3_INPUT_HSIZE + i*2)) & limit).size();
     if (n > 1000000)            // arbitrary cutoff
         return false;
+    else if (n == 0)            // no context glyph is within limit
+        return true;
 
     Vector<Coverage::iterator> backtracki;
     Vector<Coverage::iterator> lookaheadi;
@@ -1395,4 +1831,480 @@ GsubChainContext::unparse(const Gsub &gsub, Vector<Substitution> &v, const Cover
 }
 
 
+
+/**************************
+ * GsubShaper             *
+ *                        *
+ **************************/
+
+GsubShaper::Subtable::Subtable(int type, const Data &d_)
+    : d(d_), format(d_.u16(0)), backtrack_class(String()),
+      input_class(String()), lookahead_class(String()),
+      records_offset(0), nrecords(0)
+{
+    if (type == GsubLookup::L_CONTEXT && format == 3) {
+        int nglyph = d.u16(2);
+        for (int i = 0; i < nglyph; ++i)
+            input.push_back(Coverage(d.offset_subtable(GsubContext::F3_HSIZE + i*2)));
+        nrecords = d.u16(4);
+        records_offset = GsubContext::F3_HSIZE + nglyph*2;
+        if (nglyph)
+            coverage = input[0];
+    } else if (type == GsubLookup::L_CHAIN && format == 3) {
+        int nbacktrack = d.u16(2);
+        int input_offset = GsubChainContext::F3_HSIZE + nbacktrack*2;
+        int ninput = d.u16(input_offset);
+        int lookahead_offset = input_offset + GsubChainContext::F3_INPUT_HSIZE + ninput*2;
+        int nlookahead = d.u16(lookahead_offset);
+        int subst_offset = lookahead_offset + GsubChainContext::F3_LOOKAHEAD_HSIZE + nlookahead*2;
+        for (int i = 0; i < nbacktrack; ++i)
+            backtrack.push_back(Coverage(d.offset_subtable(GsubChainContext::F3_HSIZE + i*2)));
+        for (int i = 0; i < ninput; ++i)
+            input.push_back(Coverage(d.offset_subtable(input_offset + GsubChainContext::F3_INPUT_HSIZE + i*2)));
+        for (int i = 0; i < nlookahead; ++i)
+            lookahead.push_back(Coverage(d.offset_subtable(lookahead_offset + GsubChainContext::F3_LOOKAHEAD_HSIZE + i*2)));
+        nrecords = d.u16(subst_offset);
+        records_offset = subst_offset + GsubChainContext::F3_SUBST_HSIZE;
+        if (ninput)
+            coverage = input[0];
+    } else if (type == GsubLookup::L_REVCHAIN && format == 1) {
+        // Reverse chaining 1: u16 format, offset coverage, u16 nbacktrack,
+        // offset backtrack[], u16 nlookahead, offset lookahead[],
+        // u16 count, glyph substitutes[]
+        coverage = Coverage(d.offset_subtable(2));
+        int nbacktrack = d.u16(4);
+        int lookahead_offset = 6 + nbacktrack*2;
+        int nlookahead = d.u16(lookahead_offset);
+        for (int i = 0; i < nbacktrack; ++i)
+            backtrack.push_back(Coverage(d.offset_subtable(6 + i*2)));
+        for (int i = 0; i < nlookahead; ++i)
+            lookahead.push_back(Coverage(d.offset_subtable(lookahead_offset + 2 + i*2)));
+        records_offset = lookahead_offset + 2 + nlookahead*2;
+        nrecords = d.u16(records_offset);
+    } else if (type == GsubLookup::L_LIGATURE) {
+        GsubLigature lig(d);
+        coverage = lig.coverage();
+        ligatures = GsubLigatureTrie(lig);
+    } else if (type != GsubLookup::L_CONTEXT && type != GsubLookup::L_CHAIN) {
+        coverage = Coverage(d.offset_subtable(2));
+    } else if (format == 1 || format == 2) {
+        coverage = Coverage(d.offset_subtable(2));
+        if (type == GsubLookup::L_CONTEXT && format == 2)
+            input_class = ClassDef(d.offset_subtable(4));
+        else if (format == 2) {
+            backtrack_class = ClassDef(d.offset_subtable(4));
+            input_class = ClassDef(d.offset_subtable(6));
+            lookahead_class = ClassDef(d.offset_subtable(8));
+        }
+    }
+}
+
+inline bool
+GsubShaper::Matcher::match(int i, Glyph g) const
+{
+    if (coverages)
+        return (*coverages)[i].covers(g);
+    int value = d->u16(offset + i*2);
+    if (classes)
+        return std::max(classes->lookup(g), 0) == value;
+    else
+        return g == value;
+}
+
+GsubShaper::GsubShaper(const Gsub &gsub, const Font &otf, ErrorHandler *errh)
+    : _glyph_class(String()), _mark_class(String()),
+      _reverse_backtrack(gsub.chaincontext_reverse_backtrack()), _alternate(0)
+{
+    // GDEF supplies the glyph classes that lookup flags refer to:
+    // Fixed version, offset GlyphClassDef, offset AttachList,
+    // offset LigCaretList, offset MarkAttachClassDef,
+    // [version 1.2] offset MarkGlyphSetsDef
+    try {
+        Data gdef(otf.table("GDEF"));
+        if (gdef.length() >= 12 && gdef.u16(0) == 1) {
+            if (gdef.u16(4))
+                _glyph_class = ClassDef(gdef.offset_subtable(4), errh);
+            if (gdef.u16(10))
+                _mark_class = ClassDef(gdef.offset_subtable(10), errh);
+            if (gdef.u16(2) >= 2 && gdef.length() >= 14 && gdef.u16(12)) {
+                Data sets = gdef.offset_subtable(12);
+                for (int i = 0; i < sets.u16(2); ++i)
+                    _mark_sets.push_back(Coverage(sets.subtable(sets.u32(4 + i*4)), errh));
+            }
+        }
+    } catch (Error e) {
+        if (errh)
+            errh->warning("GDEF %<%s%> error, ignoring glyph classes", e.description.c_str());
+    }
+
+    for (int i = 0; i < gsub.nlookups(); ++i) {
+        GsubLookup l = gsub.lookup(i);
+        _lookups.push_back(LookupInfo());
+        LookupInfo &li = _lookups.back();
+        li.type = l.type();
+        li.flags = l.flags();
+        li.mark_set = l.mark_filtering_set();
+        for (int j = 0; j < l.nsubtables(); ++j)
+            if (Data d = l.subtable(j))
+                li.subtables.push_back(Subtable(li.type, d));
+    }
+}
+
+bool
+GsubShaper::skip(const LookupInfo &li, Glyph g) const
+{
+    if (!(li.flags & (GsubLookup::F_IGNORE_BASE_GLYPHS | GsubLookup::F_IGNORE_LIGATURES | GsubLookup::F_IGNORE_MARKS | GsubLookup::F_USE_MARK_FILTERING_SET | GsubLookup::F_MARK_ATTACHMENT_TYPE)))
+        return false;
+    int gc = _glyph_class.lookup(g);
+    if (gc == GC_BASE)
+        return (li.flags & GsubLookup::F_IGNORE_BASE_GLYPHS) != 0;
+    else if (gc == GC_LIGATURE)
+        return (li.flags & GsubLookup::F_IGNORE_LIGATURES) != 0;
+    else if (gc != GC_MARK)
+        return false;
+    else if (li.flags & GsubLookup::F_IGNORE_MARKS)
+        return true;
+    else if (li.flags & GsubLookup::F_USE_MARK_FILTERING_SET)
+        return li.mark_set >= _mark_sets.size()
+            || !_mark_sets[li.mark_set].covers(g);
+    else if (li.flags & GsubLookup::F_MARK_ATTACHMENT_TYPE)
+        return _mark_class.lookup(g) != (li.flags >> 8);
+    else
+        return false;
+}
+
+int
+GsubShaper::next_position(const LookupInfo &li, const Vector<Glyph> &g, int pos) const
+{
+    for (++pos; pos < g.size(); ++pos)
+        if (!skip(li, g[pos]))
+            return pos;
+    return -1;
+}
+
+int
+GsubShaper::prev_position(const LookupInfo &li, const Vector<Glyph> &g, int pos) const
+{
+    for (--pos; pos >= 0; --pos)
+        if (!skip(li, g[pos]))
+            return pos;
+    return -1;
+}
+
+void
+GsubShaper::replace(Vector<Glyph> &g, Vector<int> &clusters, int pos,
+                    const Glyph *out, int nout)
+{
+    int cluster = clusters[pos];
+    if (nout == 0) {
+        g.erase(g.begin() + pos);
+        clusters.erase(clusters.begin() + pos);
+        return;
+    }
+    if (nout > 1) {
+        int old_size = g.size();
+        g.resize(old_size + nout - 1);
+        clusters.resize(old_size + nout - 1);
+        for (int i = old_size - 1; i > pos; --i) {
+            g[i + nout - 1] = g[i];
+            clusters[i + nout - 1] = clusters[i];
+        }
+    }
+    for (int i = 0; i < nout; ++i) {
+        g[pos + i] = out[i];
+        clusters[pos + i] = cluster;
+    }
+}
+
+bool
+GsubShaper::apply_ligature(const LookupInfo &li, const Subtable &st,
+                           Vector<Glyph> &g, Vector<int> &clusters, int pos) const
+{
+    // walk the trie over the unskipped glyphs; the subtable lists the
+    // preferred ligature first
+    Vector<int> positions;
+    positions.push_back(pos);
+    int best = -1, best_length = 0;
+    for (int node = st.ligatures.start(g[pos]); node >= 0; ) {
+        if (st.ligatures.order(node) >= 0
+            && (best < 0 || st.ligatures.order(node) < st.ligatures.order(best)))
+            best = node, best_length = positions.size();
+        int p = next_position(li, g, positions.back());
+        if (p < 0)
+            break;
+        node = st.ligatures.next(node, g[p]);
+        positions.push_back(p);
+    }
+    if (best < 0)
+        return false;
+
+    // replace the first component with the ligature and remove the others;
+    // glyphs skipped between components end up after the ligature
+    for (int k = best_length - 1; k > 0; --k) {
+        clusters[pos] = std::min(clusters[pos], clusters[positions[k]]);
+        g.erase(g.begin() + positions[k]);
+        clusters.erase(clusters.begin() + positions[k]);
+    }
+    g[pos] = st.ligatures.output(best);
+    return true;
+}
+
+bool
+GsubShaper::apply_rule(const LookupInfo &li, Vector<Glyph> &g, Vector<int> &clusters,
+                       int pos, int nbacktrack, const Matcher &backtrack,
+                       int ninput, const Matcher &input,
+                       int nlookahead, const Matcher &lookahead,
+                       const Data &records, int records_offset, int nrecords,
+                       int &next, int depth) const
+{
+    // the first input glyph has already been matched
+    Vector<int> positions;
+    positions.push_back(pos);
+    for (int i = 1; i < ninput; ++i) {
+        int p = next_position(li, g, positions.back());
+        if (p < 0 || !input.match(i, g[p]))
+            return false;
+        positions.push_back(p);
+    }
+    for (int i = 0, p = positions.back(); i < nlookahead; ++i) {
+        p = next_position(li, g, p);
+        if (p < 0 || !lookahead.match(i, g[p]))
+            return false;
+    }
+    for (int i = 0, p = pos; i < nbacktrack; ++i) {
+        p = prev_position(li, g, p);
+        if (p < 0 || !backtrack.match(_reverse_backtrack ? nbacktrack - 1 - i : i, g[p]))
+            return false;
+    }
+
+    // apply the nested lookups, tracking how they move the input
+    int end = positions.back() + 1;
+    for (int j = 0; j < nrecords; ++j) {
+        int seq_index = records.u16(records_offset + GsubContext::SUBRECSIZE*j);
+        int lookup_index = records.u16(records_offset + GsubContext::SUBRECSIZE*j + 2);
+        if (seq_index >= positions.size() || positions[seq_index] >= g.size())
+            continue;
+        int p = positions[seq_index], old_size = g.size(), nested_next;
+        if (apply_at(lookup_index, g, clusters, p, nested_next, depth + 1)) {
+            int delta = g.size() - old_size;
+            if (delta) {
+                for (int k = 0; k < positions.size(); ++k)
+                    if (positions[k] > p)
+                        positions[k] = std::max(positions[k] + delta, p);
+                end += delta;
+            }
+        }
+    }
+    next = std::max(end, pos + 1);
+    return true;
+}
+
+bool
+GsubShaper::apply_context(const LookupInfo &li, const Subtable &st, int ci,
+                          Vector<Glyph> &g, Vector<int> &clusters, int pos,
+                          int &next, int depth) const
+{
+    const Data &d = st.d;
+    Matcher none(d, 0);
+    if (st.format == 3)
+        return apply_rule(li, g, clusters, pos, 0, none,
+                          st.input.size(), Matcher(st.input), 0, none,
+                          d, st.records_offset, st.nrecords, next, depth);
+
+    // Context 1: u16 format, offset coverage, u16 count, offset rulesets[]
+    //   indexed by coverage index
+    // Context 2: u16 format, offset coverage, offset classdef, u16 count,
+    //   offset rulesets[] indexed by class of the first glyph
+    // rule: u16 nglyph, u16 nsubst, u16 input[nglyph-1], records[nsubst]
+    int set_index, set_offset;
+    if (st.format == 1)
+        set_index = ci, set_offset = 6;
+    else if (st.format == 2)
+        set_index = std::max(st.input_class.lookup(g[pos]), 0), set_offset = 8;
+    else
+        return false;
+    if (set_index >= d.u16(set_offset - 2) || !d.u16(set_offset + set_index*2))
+        return false;
+    Data ruleset = d.offset_subtable(set_offset + set_index*2);
+    const ClassDef *classes = (st.format == 2 ? &st.input_class : 0);
+    for (int r = 0; r < ruleset.u16(0); ++r) {
+        Data rule = ruleset.offset_subtable(2 + r*2);
+        int nglyph = rule.u16(0);
+        int nsubst = rule.u16(2);
+        if (apply_rule(li, g, clusters, pos, 0, none,
+                       nglyph, Matcher(rule, 2, classes), 0, none,
+                       rule, 4 + (nglyph - 1)*2, nsubst, next, depth))
+            return true;
+    }
+    return false;
+}
+
+bool
+GsubShaper::apply_chain(const LookupInfo &li, const Subtable &st, int ci,
+                        Vector<Glyph> &g, Vector<int> &clusters, int pos,
+                        int &next, int depth) const
+{
+    const Data &d = st.d;
+    if (st.format == 3)
+        return apply_rule(li, g, clusters, pos,
+                          st.backtrack.size(), Matcher(st.backtrack),
+                          st.input.size(), Matcher(st.input),
+                          st.lookahead.size(), Matcher(st.lookahead),
+                          d, st.records_offset, st.nrecords, next, depth);
+
+    // ChainContext 1: u16 format, offset coverage, u16 count,
+    //   offset rulesets[] indexed by coverage index
+    // ChainContext 2: u16 format, offset coverage, offset backtrack classdef,
+    //   offset input classdef, offset lookahead classdef, u16 count,
+    //   offset rulesets[] indexed by input class of the first glyph
+    // rule: u16 nbacktrack, backtrack[], u16 ninput, input[ninput-1],
+    //   u16 nlookahead, lookahead[], u16 nsubst, records[nsubst]
+    int set_index, set_offset;
+    if (st.format == 1)
+        set_index = ci, set_offset = 6;
+    else if (st.format == 2)
+        set_index = std::max(st.input_class.lookup(g[pos]), 0), set_offset = 12;
+    else
+        return false;
+    if (set_index >= d.u16(set_offset - 2) || !d.u16(set_offset + set_index*2))
+        return false;
+    Data ruleset = d.offset_subtable(set_offset + set_index*2);
+    bool classes = (st.format == 2);
+    for (int r = 0; r < ruleset.u16(0); ++r) {
+        Data rule = ruleset.offset_subtable(2 + r*2);
+        int nbacktrack = rule.u16(0);
+        int input_offset = 2 + nbacktrack*2;
+        int ninput = rule.u16(input_offset);
+        int lookahead_offset = input_offset + 2 + (ninput - 1)*2;
+        int nlookahead = rule.u16(lookahead_offset);
+        int subst_offset = lookahead_offset + 2 + nlookahead*2;
+        if (apply_rule(li, g, clusters, pos,
+                       nbacktrack, Matcher(rule, 2, classes ? &st.backtrack_class : 0),
+                       ninput, Matcher(rule, input_offset, classes ? &st.input_class : 0),
+                       nlookahead, Matcher(rule, lookahead_offset + 2, classes ? &st.lookahead_class : 0),
+                       rule, subst_offset + 2, rule.u16(subst_offset),
+                       next, depth))
+            return true;
+    }
+    return false;
+}
+
+bool
+GsubShaper::apply_at(int lookup, Vector<Glyph> &g, Vector<int> &clusters,
+                     int pos, int &next, int depth) const
+{
+    if (depth > MAX_NESTING || lookup < 0 || lookup >= _lookups.size())
+        return false;
+    const LookupInfo &li = _lookups[lookup];
+    Glyph glyph = g[pos];
+    for (const Subtable *st = li.subtables.begin(); st != li.subtables.end(); ++st) {
+        int ci = st->coverage.coverage_index(glyph);
+        if (ci < 0)
+            continue;
+        switch (li.type) {
+          case GsubLookup::L_SINGLE:
+            if (st->format == 1)
+                g[pos] = (glyph + st->d.s16(4)) & 0xFFFF;
+            else
+                g[pos] = st->d.u16(GsubSingle::HEADERSIZE + ci*GsubSingle::FORMAT2_RECSIZE);
+            next = pos + 1;
+            return true;
+          case GsubLookup::L_MULTIPLE:
+          case GsubLookup::L_ALTERNATE: {
+              Data seq = st->d.offset_subtable(GsubMultiple::HEADERSIZE + ci*GsubMultiple::RECSIZE);
+              int n = seq.u16(0);
+              if (li.type == GsubLookup::L_ALTERNATE) {
+                  if (_alternate < n)
+                      g[pos] = seq.u16(GsubMultiple::SEQ_HEADERSIZE + _alternate*GsubMultiple::SEQ_RECSIZE);
+                  next = pos + 1;
+              } else if (n <= 1 || g.size() + n <= MAX_LENGTH) {
+                  Glyph out[16];
+                  Vector<Glyph> outv;
+                  Glyph *op = (n <= 16 ? out : (outv.resize(n), outv.begin()));
+                  for (int i = 0; i < n; ++i)
+                      op[i] = seq.u16(GsubMultiple::SEQ_HEADERSIZE + i*GsubMultiple::SEQ_RECSIZE);
+                  replace(g, clusters, pos, op, n);
+                  next = pos + n;
+              } else
+                  return false;
+              return true;
+          }
+          case GsubLookup::L_LIGATURE:
+            if (apply_ligature(li, *st, g, clusters, pos)) {
+                next = pos + 1;
+                return true;
+            }
+            break;
+          case GsubLookup::L_CONTEXT:
+            if (apply_context(li, *st, ci, g, clusters, pos, next, depth))
+                return true;
+            break;
+          case GsubLookup::L_CHAIN:
+            if (apply_chain(li, *st, ci, g, clusters, pos, next, depth))
+                return true;
+            break;
+          default:
+            return false;
+        }
+    }
+    return false;
+}
+
+void
+GsubShaper::apply_reverse(const LookupInfo &li, Vector<Glyph> &g) const
+{
+    for (int pos = g.size() - 1; pos >= 0; --pos) {
+        if (skip(li, g[pos]))
+            continue;
+        for (const Subtable *st = li.subtables.begin(); st != li.subtables.end(); ++st) {
+            int ci = st->coverage.coverage_index(g[pos]);
+            if (ci < 0 || ci >= st->nrecords)
+                continue;
+            int p = pos;
+            for (int i = 0; i < st->backtrack.size(); ++i)
+                if ((p = prev_position(li, g, p)) < 0 || !st->backtrack[i].covers(g[p]))
+                    goto failed;
+            p = pos;
+            for (int i = 0; i < st->lookahead.size(); ++i)
+                if ((p = next_position(li, g, p)) < 0 || !st->lookahead[i].covers(g[p]))
+                    goto failed;
+            g[pos] = st->d.u16(st->records_offset + 2 + ci*2);
+            break;
+          failed: ;
+        }
+    }
+}
+
+void
+GsubShaper::apply_lookup(int lookup, Vector<Glyph> &g, Vector<int> &clusters) const
+{
+    if (lookup < 0 || lookup >= _lookups.size())
+        return;
+    const LookupInfo &li = _lookups[lookup];
+    if (li.type == GsubLookup::L_REVCHAIN) {
+        apply_reverse(li, g);
+        return;
+    }
+    int pos = 0;
+    while (pos < g.size()) {
+        int next;
+        if (!skip(li, g[pos]) && apply_at(lookup, g, clusters, pos, next, 0))
+            pos = next;
+        else
+            ++pos;
+    }
+}
+
+void
+GsubShaper::shape(Vector<Glyph> &g, Vector<int> &clusters, const Vector<int> &lookups) const
+{
+    if (clusters.size() != g.size()) {
+        clusters.resize(g.size());
+        for (int i = 0; i < g.size(); ++i)
+            clusters[i] = i;
+    }
+    for (const int *l = lookups.begin(); l != lookups.end(); ++l)
+        apply_lookup(*l, g, clusters);
+}
+
 }}
@@ -0,0 +1,488 @@
+// -*- related-file-name: "../include/efont/otflayout.hh" -*-
+
+/* otflayout.{cc,hh} -- snapshots of decoded OpenType layout tables
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/otflayout.hh>
+#include <lcdf/error.hh>
+#include <lcdf/straccum.hh>
+#include <lcdf/md5.h>
+#include <string.h>
+#include <algorithm>
+
+namespace Efont { namespace OpenType {
+
+// SNAPSHOT FORMAT (all offsets are from the start of the snapshot):
+// ULONG    magic ('OTLS')
+// USHORT   version
+// USHORT   tableCount (GSUB, GPOS)
+// 16bytes  MD5 digest of the font's table directory
+// ULONG    snapshotLength
+// ULONG    checksum of the bytes after the header, computed as for
+//          OpenType tables
+// ULONG    tableOffset[tableCount] (0 if the font lacks the table)
+//
+// Table:
+// ULONG    scriptListOffset
+// ULONG    scriptListLength
+// ULONG    featureListOffset
+// ULONG    featureListLength
+// USHORT   lookupCount
+// 12bytes  lookupRecord[lookupCount]: USHORT type, USHORT flags,
+//          ULONG entriesOffset, ULONG entryCount
+//
+// GSUB entry: USHORT inCount, USHORT outCount, USHORT glyphs[in + out]
+// GPOS entry: USHORT entryFlags (EF_PAIR for a pair positioning), then
+//          left and right Positions, each USHORT glyph, SHORT pdx,
+//          SHORT pdy, SHORT adx, SHORT ady; a single positioning's right
+//          Position is zero
+//
+// The ScriptList and FeatureList are rewritten in OpenType format, minus
+// feature parameters.
+
+static void
+append_u16(StringAccum &sa, int x)
+{
+    sa << (char) ((x >> 8) & 0xFF) << (char) (x & 0xFF);
+}
+
+static void
+append_u32(StringAccum &sa, uint32_t x)
+{
+    append_u16(sa, x >> 16);
+    append_u16(sa, x);
+}
+
+static void
+patch_u16(StringAccum &sa, int pos, int x)
+{
+    sa.data()[pos] = (x >> 8) & 0xFF;
+    sa.data()[pos + 1] = x & 0xFF;
+}
+
+static void
+patch_u32(StringAccum &sa, int pos, uint32_t x)
+{
+    patch_u16(sa, pos, x >> 16);
+    patch_u16(sa, pos + 2, x);
+}
+
+static void
+append_langsys(StringAccum &sa, const Data &langsys)
+{
+    int nfeatures = langsys.u16(4);
+    append_u16(sa, 0);
+    append_u16(sa, langsys.u16(2));
+    append_u16(sa, nfeatures);
+    for (int i = 0; i < nfeatures; i++)
+        append_u16(sa, langsys.u16(6 + i*2));
+}
+
+static String
+flatten_script_list(const Data &d)
+{
+    StringAccum sa;
+    int nscripts = d.u16(0);
+    append_u16(sa, nscripts);
+    for (int i = 0; i < nscripts; i++) {
+        append_u32(sa, d.u32(2 + i*6));
+        append_u16(sa, 0);
+    }
+    for (int i = 0; i < nscripts; i++) {
+        int script_pos = sa.length();
+        patch_u16(sa, 2 + i*6 + 4, script_pos);
+        Data script = d.offset_subtable(2 + i*6 + 4);
+        int nlangsys = script.u16(2);
+        append_u16(sa, 0);
+        append_u16(sa, nlangsys);
+        for (int j = 0; j < nlangsys; j++) {
+            append_u32(sa, script.u32(4 + j*6));
+            append_u16(sa, 0);
+        }
+        if (script.u16(0)) {
+            patch_u16(sa, script_pos, sa.length() - script_pos);
+            append_langsys(sa, script.offset_subtable(0));
+        }
+        for (int j = 0; j < nlangsys; j++) {
+            patch_u16(sa, script_pos + 4 + j*6 + 4, sa.length() - script_pos);
+            append_langsys(sa, script.offset_subtable(4 + j*6 + 4));
+        }
+    }
+    return sa.take_string();
+}
+
+static String
+flatten_feature_list(const Data &d)
+{
+    StringAccum sa;
+    int nfeatures = d.u16(0);
+    append_u16(sa, nfeatures);
+    for (int i = 0; i < nfeatures; i++) {
+        append_u32(sa, d.u32(2 + i*6));
+        append_u16(sa, 0);
+    }
+    for (int i = 0; i < nfeatures; i++) {
+        patch_u16(sa, 2 + i*6 + 4, sa.length());
+        Data feature = d.offset_subtable(2 + i*6 + 4);
+        int nlookups = feature.u16(2);
+        append_u16(sa, 0);
+        append_u16(sa, nlookups);
+        for (int j = 0; j < nlookups; j++)
+            append_u16(sa, feature.u16(4 + j*2));
+    }
+    return sa.take_string();
+}
+
+namespace {
+// Counts messages so that lookups that warn can be left to the font.
+class CountingErrorHandler : public ErrorHandler { public:
+    CountingErrorHandler() : nmessages(0) { }
+    String decorate(const String &) {
+        ++nmessages;
+        return String();
+    }
+    int nmessages;
+};
+}
+
+static void
+append_table_header(StringAccum &sa, const Data &table, int nlookups,
+                    int &lookup_pos)
+{
+    int header_pos = sa.length();
+    for (int i = 0; i < 4; i++)
+        append_u32(sa, 0);
+    append_u16(sa, nlookups);
+    lookup_pos = sa.length();
+    for (int i = 0; i < nlookups; i++) {
+        append_u32(sa, 0);
+        append_u32(sa, 0);
+        append_u32(sa, 0);
+    }
+
+    String lists[2];
+    try {
+        lists[0] = flatten_script_list(table.offset_subtable(4));
+        lists[1] = flatten_feature_list(table.offset_subtable(6));
+    } catch (Error) {
+        lists[0] = lists[1] = String();
+    }
+    for (int i = 0; i < 2; i++) {
+        patch_u32(sa, header_pos + i*8, sa.length());
+        patch_u32(sa, header_pos + i*8 + 4, lists[i].length());
+        sa << lists[i];
+    }
+}
+
+static void
+finish_lookup(StringAccum &sa, int record_pos, int type, int flags,
+              int entries_pos, int nentries)
+{
+    patch_u16(sa, record_pos, type);
+    patch_u16(sa, record_pos + 2, flags);
+    patch_u32(sa, record_pos + 4, entries_pos);
+    patch_u32(sa, record_pos + 8, nentries);
+}
+
+static void
+make_gsub(StringAccum &sa, const Font &otf)
+{
+    Gsub gsub(otf.table("GSUB"), &otf);
+    int nlookups = gsub.nlookups(), lookup_pos;
+    append_table_header(sa, otf.table("GSUB"), nlookups, lookup_pos);
+
+    Coverage all_glyphs(0, 0xFFFF);
+    Vector<Substitution> subs;
+    Vector<Glyph> in, out;
+    for (int i = 0; i < nlookups; i++) {
+        int record_pos = lookup_pos + i*LayoutSnapshot::LOOKUP_RECSIZE;
+        int type = 0, flags = 0, entries_pos = sa.length();
+        subs.clear();
+        try {
+            GsubLookup l = gsub.lookup(i);
+            type = l.type();
+            if (type == GsubLookup::L_SINGLE || type == GsubLookup::L_MULTIPLE
+                || type == GsubLookup::L_ALTERNATE
+                || type == GsubLookup::L_LIGATURE) {
+                flags = LayoutSnapshot::LF_FLATTENED;
+                if (l.unparse_automatics(gsub, subs, all_glyphs))
+                    flags |= LayoutSnapshot::LF_UNDERSTOOD;
+            }
+        } catch (Error) {
+            flags = 0;
+        }
+
+        for (int j = 0; j < subs.size() && flags; j++) {
+            in.clear();
+            out.clear();
+            subs[j].in_glyphs(in);
+            subs[j].out_glyphs(out);
+            append_u16(sa, in.size());
+            append_u16(sa, out.size());
+            for (int k = 0; k < in.size(); k++)
+                append_u16(sa, in[k]);
+            for (int k = 0; k < out.size(); k++) {
+                // single substitutions may compute out-of-range glyphs
+                if (out[k] < 0 || out[k] > 0xFFFF)
+                    flags = 0;
+                append_u16(sa, out[k]);
+            }
+        }
+        if (!flags)
+            sa.set_length(entries_pos);
+        finish_lookup(sa, record_pos, type, flags, entries_pos, flags ? subs.size() : 0);
+    }
+}
+
+static void
+append_position(StringAccum &sa, const Position &p)
+{
+    append_u16(sa, p.g);
+    append_u16(sa, p.pdx);
+    append_u16(sa, p.pdy);
+    append_u16(sa, p.adx);
+    append_u16(sa, p.ady);
+}
+
+static void
+make_gpos(StringAccum &sa, const Font &otf)
+{
+    Gpos gpos(otf.table("GPOS"));
+    int nlookups = gpos.nlookups(), lookup_pos;
+    append_table_header(sa, otf.table("GPOS"), nlookups, lookup_pos);
+
+    Vector<Positioning> poss;
+    for (int i = 0; i < nlookups; i++) {
+        int record_pos = lookup_pos + i*LayoutSnapshot::LOOKUP_RECSIZE;
+        int type = 0, flags = 0, entries_pos = sa.length();
+        poss.clear();
+        try {
+            GposLookup l = gpos.lookup(i);
+            CountingErrorHandler cerrh;
+            type = l.type();
+            bool understood = l.unparse_automatics(poss, &cerrh);
+            if (cerrh.nmessages == 0)
+                flags = LayoutSnapshot::LF_FLATTENED
+                    | (understood ? LayoutSnapshot::LF_UNDERSTOOD : 0);
+        } catch (Error) {
+            flags = 0;
+        }
+
+        for (int j = 0; j < poss.size() && flags; j++) {
+            bool pair = !poss[j].is_single();
+            append_u16(sa, pair ? LayoutSnapshot::EF_PAIR : 0);
+            append_position(sa, poss[j].left());
+            append_position(sa, pair ? poss[j].right() : Position());
+        }
+        finish_lookup(sa, record_pos, type, flags, entries_pos, flags ? poss.size() : 0);
+    }
+}
+
+static uint32_t
+body_checksum(const uint8_t *data, int length)
+{
+    return Font::checksum(data + LayoutSnapshot::HEADERSIZE, data + length);
+}
+
+String
+LayoutSnapshot::font_key(const Font &otf)
+{
+    MD5_CONTEXT md5;
+    unsigned char digest[MD5_DIGEST_SIZE];
+    md5_init(&md5);
+    // The table directory records every table's checksum, offset, and
+    // length, so digesting it is enough to recognize a changed font.
+    int dirlen = otf.length();
+    if (dirlen >= 12)
+        dirlen = std::min(dirlen, 12 + 16 * ((otf.data()[4] << 8) | otf.data()[5]));
+    md5_update(&md5, otf.data(), dirlen);
+    md5_final(digest, &md5);
+    return String(reinterpret_cast<const char *>(digest), MD5_DIGEST_SIZE);
+}
+
+String
+LayoutSnapshot::key_text(const String &font_key)
+{
+    static const char hex[] = "0123456789abcdef";
+    StringAccum sa;
+    for (const unsigned char *s = font_key.udata(); s != font_key.uend(); ++s)
+        sa << hex[*s >> 4] << hex[*s & 15];
+    return sa.take_string();
+}
+
+String
+LayoutSnapshot::make(const Font &otf, ErrorHandler *errh)
+{
+    StringAccum sa;
+    append_u32(sa, MAGIC);
+    append_u16(sa, FORMAT_VERSION);
+    append_u16(sa, NTABLES);
+    sa << font_key(otf);
+    append_u32(sa, 0);
+    append_u32(sa, 0);
+    for (int t = 0; t < NTABLES; t++)
+        append_u32(sa, 0);
+
+    for (int t = 0; t < NTABLES; t++) {
+        int table_pos = sa.length();
+        try {
+            patch_u32(sa, HEADERSIZE + t*TABLE_RECSIZE, table_pos);
+            if (t == T_GSUB)
+                make_gsub(sa, otf);
+            else
+                make_gpos(sa, otf);
+        } catch (BlankTable) {
+            patch_u32(sa, HEADERSIZE + t*TABLE_RECSIZE, 0);
+            sa.set_length(table_pos);
+        } catch (Error e) {
+            if (errh)
+                errh->warning("%s, not saved in layout snapshot", e.description.c_str());
+            patch_u32(sa, HEADERSIZE + t*TABLE_RECSIZE, 0);
+            sa.set_length(table_pos);
+        }
+    }
+
+    patch_u32(sa, LENGTH_OFFSET, sa.length());
+    patch_u32(sa, CHECKSUM_OFFSET, body_checksum(sa.udata(), sa.length()));
+    return sa.take_string();
+}
+
+LayoutSnapshot::LayoutSnapshot(const String &str, const String &font_key)
+    : _str(str)
+{
+    _str.align(2);
+    Data d(_str);
+    // A truncated or damaged snapshot, such as one left by a crash
+    // mid-write, fails the length or checksum test and is ignored.
+    if (d.length() < HEADERSIZE + NTABLES*TABLE_RECSIZE
+        || d.u32(0) != MAGIC || d.u16(4) != FORMAT_VERSION || d.u16(6) != NTABLES
+        || font_key.length() != MD5_DIGEST_SIZE
+        || memcmp(d.udata() + 8, font_key.data(), MD5_DIGEST_SIZE) != 0
+        || d.u32(LENGTH_OFFSET) != (uint32_t) d.length()
+        || d.u32(CHECKSUM_OFFSET) != body_checksum(d.udata(), d.length()))
+        _str = String();
+}
+
+Data
+LayoutSnapshot::table(int t) const
+{
+    if (t < 0 || t >= NTABLES || !_str.length())
+        return Data();
+    Data d(_str);
+    uint32_t offset = d.u32(HEADERSIZE + t*TABLE_RECSIZE);
+    return offset ? d.subtable(offset) : Data();
+}
+
+bool
+LayoutSnapshot::has_table(int t) const
+{
+    return table(t).length() > 0;
+}
+
+ScriptList
+LayoutSnapshot::script_list(int t) const
+{
+    Data d(_str), tab = table(t);
+    if (!tab.length())
+        return ScriptList();
+    return ScriptList(d.substring(tab.u32(0), tab.u32(4)).string());
+}
+
+FeatureList
+LayoutSnapshot::feature_list(int t) const
+{
+    Data d(_str), tab = table(t);
+    if (!tab.length())
+        return FeatureList();
+    return FeatureList(d.substring(tab.u32(8), tab.u32(12)).string());
+}
+
+int
+LayoutSnapshot::nlookups(int t) const
+{
+    Data tab = table(t);
+    return tab.length() ? tab.u16(16) : 0;
+}
+
+Data
+LayoutSnapshot::lookup_record(int t, int lookup) const
+{
+    Data tab = table(t);
+    if (!tab.length() || lookup < 0 || lookup >= tab.u16(16))
+        return Data();
+    return tab.substring(TABLE_HEADERSIZE + lookup*LOOKUP_RECSIZE, LOOKUP_RECSIZE);
+}
+
+bool
+LayoutSnapshot::unparse(int lookup, Vector<Substitution> &v, const Coverage &limit, bool &understood) const
+{
+    Data rec = lookup_record(T_GSUB, lookup);
+    if (!rec.length() || !(rec.u16(2) & LF_FLATTENED))
+        return false;
+
+    int type = rec.u16(0);
+    Data d(_str);
+    uint32_t pos = rec.u32(4), nentries = rec.u32(8);
+    Vector<Glyph> in, out;
+    for (uint32_t i = 0; i < nentries; i++) {
+        int nin = d.u16(pos), nout = d.u16(pos + 2);
+        pos += 4;
+        in.resize(nin);
+        out.resize(nout);
+        for (int k = 0; k < nin; k++, pos += 2)
+            in[k] = d.u16(pos);
+        for (int k = 0; k < nout; k++, pos += 2)
+            out[k] = d.u16(pos);
+        if (type == GsubLookup::L_SINGLE) {
+            if (nin == 1 && nout == 1 && limit.covers(in[0]))
+                v.push_back(Substitution(in[0], out[0]));
+        } else if (type == GsubLookup::L_LIGATURE)
+            v.push_back(Substitution(in, nout ? out[0] : 0));
+        else if (nin == 1)
+            v.push_back(Substitution(in[0], out, type == GsubLookup::L_ALTERNATE));
+    }
+    understood = (rec.u16(2) & LF_UNDERSTOOD) != 0;
+    return true;
+}
+
+static inline Position
+read_position(const Data &d, uint32_t pos)
+{
+    return Position(d.u16(pos), d.s16(pos + 2), d.s16(pos + 4),
+                    d.s16(pos + 6), d.s16(pos + 8));
+}
+
+bool
+LayoutSnapshot::unparse(int lookup, Vector<Positioning> &v, bool &understood) const
+{
+    Data rec = lookup_record(T_GPOS, lookup);
+    if (!rec.length() || !(rec.u16(2) & LF_FLATTENED))
+        return false;
+
+    Data d(_str);
+    uint32_t pos = rec.u32(4), nentries = rec.u32(8);
+    for (uint32_t i = 0; i < nentries; i++, pos += POSITIONING_SIZE) {
+        Position left = read_position(d, pos + 2);
+        if (d.u16(pos) & EF_PAIR)
+            v.push_back(Positioning(left, read_position(d, pos + 2 + POSITION_SIZE)));
+        else
+            v.push_back(Positioning(left));
+    }
+    understood = (rec.u16(2) & LF_UNDERSTOOD) != 0;
+    return true;
+}
+
+}}
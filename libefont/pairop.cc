@@ -23,7 +23,9 @@ namespace Efont {
 PairProgram::PairProgram(const PairProgram &o)
   : _reversed(o._reversed),
     _left_map(o._left_map),
-    _op(o._op)
+    _op(o._op),
+    _index(-1),
+    _index_valid(false)
 {
 }
 
@@ -36,30 +38,54 @@ PairProgram::reserve_glyphs(int e)
 }
 
 
+void
+PairProgram::make_index() const
+{
+  _index.clear();
+  _index.reserve(_op.size());
+  for (GlyphIndex gi = 0; gi < _left_map.size(); gi++)
+    for (PairOpIndex opi = _left_map[gi]; opi >= 0; opi = _op[opi].next_left()) {
+      PairOpIndex &first = _index.find_force(Key(gi, _op[opi].right()));
+      if (first < 0)
+        first = opi;
+    }
+  _index_valid = true;
+}
+
+
 PairOpIndex
 PairProgram::find(GlyphIndex leftgi, GlyphIndex rightgi) const
 {
+  // Most left glyphs have a few ops, which are faster to scan than to hash.
   PairOpIndex opi = find_left(leftgi);
-  while (opi >= 0) {
-    if (op(opi).right() == rightgi)
+  for (int n = 0; opi >= 0 && n < 8; n++, opi = _op[opi].next_left())
+    if (_op[opi].right() == rightgi)
       return opi;
-    opi = op(opi).next_left();
-  }
-  return -1;
+  if (opi < 0)
+    return -1;
+
+  if (!_index_valid)
+    make_index();
+  return _index[Key(leftgi, rightgi)];
 }
 
 
-bool
-PairProgram::add_kern(GlyphIndex left, GlyphIndex right, int ki)
+void
+PairProgram::add_op(const PairOp &newop)
 {
-  PairOp newop(left, right, ki, _left_map[left]);
   int newopi = _op.size();
   _op.push_back(newop);
-  _left_map[left] = newopi;
+  _op.back().set_next(_left_map[newop.left()]);
+  _left_map[newop.left()] = newopi;
+  if (_index_valid)
+    _index.insert(Key(newop.left(), newop.right()), newopi);
+}
 
-  //PairOpIndex duplicate = map[newop];
-  //map.add(newop, newopi);
 
+bool
+PairProgram::add_kern(GlyphIndex left, GlyphIndex right, int ki)
+{
+  add_op(PairOp(left, right, ki, -1));
   return false;
 }
 
@@ -68,15 +94,59 @@ bool
 PairProgram::add_lig(GlyphIndex left, GlyphIndex right, GlyphIndex result,
                      int kind)
 {
-  PairOp newop(left, right, result, kind, _left_map[left]);
-  int newopi = _op.size();
-  _op.push_back(newop);
-  _left_map[left] = newopi;
+  add_op(PairOp(left, right, result, kind, -1));
+  return false;
+}
 
-  //PairOpIndex duplicate = map[newop];
-  //map.add(newop, newopi);
 
-  return false;
+void
+PairProgram::add_ops(const Vector<PairOp> &ops)
+{
+  int nglyphs = _left_map.size();
+  int nold = _op.size();
+
+  // Order the old ops, then the new ones, by left glyph with a stable
+  // counting sort.  Ops with the same left glyph keep their relative
+  // order, which is what unreverse() depends on.
+  Vector<int> start(nglyphs + 1, 0);
+  for (const PairOp *o = _op.begin(); o != _op.end(); ++o)
+    start[o->left() + 1]++;
+  for (const PairOp *o = ops.begin(); o != ops.end(); ++o)
+    start[o->left() + 1]++;
+  for (int gi = 0; gi < nglyphs; gi++)
+    start[gi + 1] += start[gi];
+  Vector<int> fill(start);
+  Vector<int> order(nold + ops.size(), -1);
+  Vector<PairOpIndex> newpos(nold, -1);
+  for (int i = 0; i < nold; i++) {
+    newpos[i] = fill[_op[i].left()]++;
+    order[newpos[i]] = i;
+  }
+  for (int i = 0; i < ops.size(); i++)
+    order[fill[ops[i].left()]++] = nold + i;
+
+  Vector<PairOp> out;
+  out.reserve(order.size());
+  for (int pos = 0; pos < order.size(); pos++)
+    out.push_back(order[pos] < nold ? _op[order[pos]] : ops[order[pos] - nold]);
+
+  // Link each left glyph's ops as add_kern() would have: the new ops,
+  // last first, then the old list.
+  for (GlyphIndex gi = 0; gi < nglyphs; gi++) {
+    PairOpIndex head = _left_map[gi] >= 0 ? newpos[_left_map[gi]] : -1;
+    for (int pos = start[gi]; pos < start[gi + 1]; pos++)
+      if (order[pos] < nold) {
+        PairOpIndex next = _op[order[pos]].next_left();
+        out[pos].set_next(next >= 0 ? newpos[next] : -1);
+      } else {
+        out[pos].set_next(head);
+        head = pos;
+      }
+    _left_map[gi] = head;
+  }
+
+  _op.swap(out);
+  _index_valid = false;
 }
 
 
@@ -101,14 +171,9 @@ PairProgram::unreverse()
 void
 PairProgram::optimize()
 {
-  /*  PairOpIndex opi;
-
-      // Get rid of 0-valued kerns.
-      for (opi = 0; opi < opcount(); opi++) {
-      PairOp &o = op(opi);
-      if (o.is_kern() && o.value() == 0)
-      o.noopify();
-      }*/
+  // Store each left glyph's ops contiguously, so walking an unreversed
+  // program reads _op in order.
+  add_ops(Vector<PairOp>());
 }
 
 
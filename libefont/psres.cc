@@ -17,7 +17,10 @@
 # include <config.h>
 #endif
 #include <efont/psres.hh>
+#include <efont/otfdata.hh>
+#include <lcdf/filename.hh>
 #include <lcdf/slurper.hh>
+#include <lcdf/straccum.hh>
 /* Get the correct functions for directory searching */
 #if HAVE_DIRENT_H
 # include <dirent.h>
@@ -36,23 +39,40 @@
 # endif
 #endif
 #include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+# include <sys/mman.h>
+#endif
 namespace Efont {
 
 PsresDatabase::PsresDatabase()
-  : _section_map(0)
+  : _section_map(0), _cache_map(0), _cache_map_len(0)
 {
   _sections.push_back((PsresDatabaseSection *)0);
+  _section_pos.push_back(0);
 }
 
 PsresDatabase::~PsresDatabase()
 {
   for (int i = 1; i < _sections.size(); i++)
     delete _sections[i];
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+  if (_cache_map) {
+    _cache_data = String();
+    munmap(_cache_map, _cache_map_len);
+  }
+#endif
 }
 
 
 PsresDatabaseSection::PsresDatabaseSection(PermString section_name)
-  : _section_name(section_name), _map(0)
+  : _section_name(section_name), _map(0), _cache_pos(0)
 {
   _directories.push_back(PermString());
   _values.push_back(String());
@@ -140,6 +160,7 @@ PsresDatabaseSection::add_psres_file_section
 {
   int equals_pos;
   bool first_line = true;
+  load_all();
 
   while (read_psres_line(slurper, &equals_pos)) {
     char *s = slurper.cur_line();
@@ -194,11 +215,12 @@ PsresDatabaseSection *
 PsresDatabase::force_section(PermString name)
 {
   if (_section_map[name] > 0)
-    return _sections[_section_map[name]];
+    return section(name);
   else {
     PsresDatabaseSection *s = new PsresDatabaseSection(name);
     int index = _sections.size();
     _sections.push_back(s);
+    _section_pos.push_back(0);
     _section_map.insert(name, index);
     return s;
   }
@@ -237,6 +259,8 @@ PsresDatabase::add_one_psres_file(Slurper &slurper, bool override)
 bool
 PsresDatabase::add_psres_file(Filename &filename, bool override)
 {
+  if (_cache_directory)
+    add_dependency(filename.path());
   Slurper slurpy(filename);
   return add_one_psres_file(slurpy, override);
 }
@@ -305,13 +329,35 @@ PsresDatabase::add_psres_path(const char *path, const char *default_path,
     default_path = 0;
   }
 
-  if (override && _sections.size() > 1) {
+  if ((override || _cache_directory) && _sections.size() > 1) {
     PsresDatabase new_db;
+    new_db._cache_directory = _cache_directory;
     new_db.add_psres_path(path, default_path, false);
-    add_database(&new_db, true);
+    add_database(&new_db, override);
+    return;
+  }
+
+  if (!_cache_directory) {
+    read_psres_path(path, default_path);
     return;
   }
 
+  StringAccum sa;
+  sa << path << '\0' << (default_path ? default_path : "");
+  String key = sa.take_string();
+  sa.snprintf(20, "/%08x.psrc", (unsigned) hashcode(key));
+  String filename = _cache_directory + sa.take_string();
+
+  if (!read_cache(filename, key)) {
+    _dependencies.clear();
+    read_psres_path(path, default_path);
+    write_cache(filename, key);
+  }
+}
+
+void
+PsresDatabase::read_psres_path(const char *path, const char *default_path)
+{
   while (*path) {
     const char *epath = path;
     while (*epath && *epath != ':') epath++;
@@ -319,10 +365,17 @@ PsresDatabase::add_psres_path(const char *path, const char *default_path,
     PermString directory(path, epath - path);
     Filename filename(directory, "PSres.upr");
     if (epath == path) {
-      add_psres_path(default_path, 0, false);
+      if (default_path)
+        read_psres_path(default_path, 0);
       default_path = 0; // don't use default path twice
-    } else if (!filename.readable() || !add_psres_file(filename, false))
-      add_psres_directory(directory);
+    } else {
+      // A directory's modification time changes when PSres.upr or another
+      // .upr file is added or removed.
+      if (_cache_directory)
+        add_dependency(directory.c_str());
+      if (!filename.readable() || !add_psres_file(filename, false))
+        add_psres_directory(directory);
+    }
 
     path = (*epath ? epath+1 : epath);
   }
@@ -333,15 +386,18 @@ void
 PsresDatabase::add_database(PsresDatabase *db, bool override)
 {
   for (int i = 1; i < db->_sections.size(); i++) {
-    PermString section_name = db->_sections[i]->section_name();
-    PsresDatabaseSection *section = force_section(section_name);
-    section->add_section(db->_sections[i], override);
+    PsresDatabaseSection *s = db->_sections[i] ? db->_sections[i] : db->load_section(i);
+    PsresDatabaseSection *section = force_section(s->section_name());
+    section->add_section(s, override);
   }
 }
 
+
 void
 PsresDatabaseSection::add_section(PsresDatabaseSection *s, bool override)
 {
+    load_all();
+    s->load_all();
     for (HashMap<PermString, int>::const_iterator i = s->_map.begin(); i; i++) {
         int value = i.value();
         if (_map[i.key()] <= 0) {
@@ -377,7 +433,7 @@ PsresDatabaseSection::value(int index)
 Filename
 PsresDatabaseSection::filename_value(PermString key)
 {
-  int index = _map[key];
+  int index = find(key);
   if (!index)
     return Filename();
   else if (!_directories[index])
@@ -416,4 +472,358 @@ PsresDatabase::filename_value(PermString sec, PermString key) const
     return Filename();
 }
 
+
+// PSRES CACHE FORMAT (all integers big-endian):
+// ULONG    magic ('LFPR')
+// ULONG    version
+// ULONG    length (of the whole file)
+// string   key (the PSRESOURCEPATH and default path)
+// ULONG    dependencyCount, Dependency[dependencyCount]
+// ULONG    sectionCount, SectionRecord[sectionCount]
+// Section  sections[sectionCount]
+// Dependency: string path, ULONG exists, ULONG mtimeHi, mtimeLo,
+//          mtimeNsec, sizeHi, sizeLo
+// SectionRecord: string name, ULONG offset (of Section from file start)
+// Section: string name, ULONG entryCount, ULONG bucketCount,
+//          ULONG buckets[bucketCount], Entry entries[entryCount]
+//          Each bucket holds the offset of an Entry from file start, or 0.
+//          An entry's key is in the first free bucket at or after
+//          bucket (hash(key) & (bucketCount - 1)), where hash is
+//          String::hashcode truncated to 32 bits.
+// Entry:   string key, directory, value; ULONG escaped
+// string:  ULONG length, BYTE data[length]
+
+static void
+append_u32(StringAccum &sa, uint32_t x)
+{
+    sa << (char) (x >> 24) << (char) (x >> 16) << (char) (x >> 8) << (char) x;
+}
+
+static void
+append_string(StringAccum &sa, const char *s, int len)
+{
+    append_u32(sa, len);
+    sa.append(s, len);
+}
+
+static void
+set_u32(char *x, uint32_t v)
+{
+    x[0] = v >> 24, x[1] = v >> 16, x[2] = v >> 8, x[3] = v;
+}
+
+static inline uint32_t
+cache_hash(const char *s, int len)
+{
+    return String::hashcode(s, s + len);
+}
+
+static String
+stat_record(const String &path)
+{
+    StringAccum sa;
+    append_string(sa, path.data(), path.length());
+    struct stat st;
+    if (stat(path.c_str(), &st) >= 0) {
+        uint64_t mtime = st.st_mtime, size = st.st_size;
+        append_u32(sa, 1);
+        append_u32(sa, mtime >> 32);
+        append_u32(sa, mtime);
+#if HAVE_STRUCT_STAT_ST_MTIM
+        append_u32(sa, st.st_mtim.tv_nsec);
+#else
+        append_u32(sa, 0);
+#endif
+        append_u32(sa, size >> 32);
+        append_u32(sa, size);
+    } else
+        for (int i = 0; i < 6; i++)
+            append_u32(sa, 0);
+    return sa.take_string();
+}
+
+namespace {
+class PsresCacheReader { public:
+
+    PsresCacheReader(const String &str, uint32_t pos = 0)
+        : _begin(str.udata()), _s(str.udata() + pos), _end(str.uend()) {
+        if (pos > (uint32_t) str.length())
+            _s = 0;
+    }
+
+    bool ok() const                     { return _s != 0; }
+    uint32_t position() const           { return _s - _begin; }
+
+    uint32_t u32() {
+        if (_s && _end - _s >= 4) {
+            uint32_t x = OpenType::Data::u32(_s);
+            _s += 4;
+            return x;
+        }
+        _s = 0;
+        return 0;
+    }
+    String string() {
+        uint32_t len = u32();
+        if (_s && len <= (uint32_t) (_end - _s)) {
+            String x(reinterpret_cast<const char *>(_s), len);
+            _s += len;
+            return x;
+        }
+        _s = 0;
+        return String();
+    }
+    PermString permstring() {
+        uint32_t len = u32();
+        if (_s && len <= (uint32_t) (_end - _s)) {
+            PermString x(reinterpret_cast<const char *>(_s), len);
+            _s += len;
+            return x;
+        }
+        _s = 0;
+        return PermString();
+    }
+    bool string_equals(PermString str) {
+        uint32_t len = u32();
+        if (_s && len <= (uint32_t) (_end - _s)) {
+            bool eq = len == (uint32_t) str.length()
+                && memcmp(_s, str.c_str(), len) == 0;
+            _s += len;
+            return eq;
+        }
+        _s = 0;
+        return false;
+    }
+    // A dependency matches if the file is still as it was recorded.
+    bool dependency_matches() {
+        String path = string();
+        if (!_s || _end - _s < 24) {
+            _s = 0;
+            return false;
+        }
+        String record = stat_record(path);
+        bool match = memcmp(record.end() - 24, _s, 24) == 0;
+        _s += 24;
+        return match;
+    }
+    uint32_t count(int min_size) {
+        uint32_t n = u32();
+        if (_s && n > (uint32_t) (_end - _s) / min_size)
+            _s = 0;
+        return _s ? n : 0;
+    }
+
+  private:
+
+    const unsigned char *_begin;
+    const unsigned char *_s;
+    const unsigned char *_end;
+
+};
+}
+
+void
+PsresDatabase::add_dependency(const String &path)
+{
+    _dependencies.push_back(stat_record(path));
+}
+
+bool
+PsresDatabase::read_cache(const String &filename, const String &key)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size <= 0 || st.st_size >= 0x7FFFFFFF) {
+        close(fd);
+        return false;
+    }
+    String data;
+    void *map = 0;
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+    map = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED)
+        data = String::make_stable((const char *) map, st.st_size);
+    else
+        map = 0;
+#endif
+    if (!map) {
+        StringAccum sa;
+        char *x = sa.extend(st.st_size);
+        if (x && read(fd, x, st.st_size) == st.st_size)
+            data = sa.take_string();
+    }
+    close(fd);
+
+    PsresCacheReader r(data);
+    bool ok = r.u32() == MAGIC && r.u32() == FORMAT_VERSION
+        && r.u32() == (uint32_t) data.length() && r.string() == key;
+    for (uint32_t n = ok ? r.count(32) : 0; n > 0 && ok; n--)
+        ok = r.dependency_matches();
+    uint32_t nsections = ok ? r.count(8) : 0;
+    Vector<PermString> names;
+    Vector<uint32_t> positions;
+    for (uint32_t i = 0; i < nsections && r.ok(); i++) {
+        names.push_back(r.permstring());
+        positions.push_back(r.u32());
+    }
+
+    if (!ok || !r.ok()) {
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+        if (map)
+            munmap(map, st.st_size);
+#endif
+        return false;
+    }
+
+    // This database is empty (see add_psres_path), so it takes over the
+    // cache data.
+    assert(_sections.size() == 1 && !_cache_map);
+    _cache_data = data;
+    _cache_map = map;
+    _cache_map_len = st.st_size;
+    for (int i = 0; i < names.size(); i++) {
+        _section_map.insert(names[i], _sections.size());
+        _sections.push_back(0);
+        _section_pos.push_back(positions[i]);
+    }
+    return true;
+}
+
+PsresDatabaseSection *
+PsresDatabase::load_section(int i) const
+{
+    PsresCacheReader r(_cache_data, _section_pos[i]);
+    PsresDatabaseSection *s = new PsresDatabaseSection(r.permstring());
+    if (r.ok()) {
+        s->_cache = _cache_data;
+        s->_cache_pos = r.position();
+    }
+    _sections[i] = s;
+    return s;
+}
+
+int
+PsresDatabaseSection::find(PermString key)
+{
+    int index = _map[key];
+    if (index || !_cache)
+        return index;
+
+    PsresCacheReader r(_cache, _cache_pos + 4);
+    uint32_t nbuckets = r.u32();
+    if (!r.ok() || (nbuckets & (nbuckets - 1)))
+        return 0;
+    uint32_t bucket_pos = r.position();
+    for (uint32_t i = cache_hash(key.c_str(), key.length()), n = 0;
+         n < nbuckets; i++, n++) {
+        PsresCacheReader br(_cache, bucket_pos + 4 * (i & (nbuckets - 1)));
+        uint32_t entry_pos = br.u32();
+        if (!entry_pos)
+            break;
+        PsresCacheReader er(_cache, entry_pos);
+        if (er.string_equals(key)) {
+            PermString directory = er.permstring();
+            String value = er.string();
+            bool escaped = er.u32() != 0;
+            if (!er.ok())
+                break;
+            index = _directories.size();
+            _directories.push_back(directory);
+            _values.push_back(value);
+            _value_escaped.push_back(escaped);
+            _map.insert(key, index);
+            return index;
+        }
+    }
+    return 0;
+}
+
+void
+PsresDatabaseSection::load_all()
+{
+    if (!_cache)
+        return;
+    PsresCacheReader r(_cache, _cache_pos);
+    uint32_t nentries = r.count(16);
+    uint32_t nbuckets = r.count(4);
+    for (uint32_t i = 0; i < nbuckets; i++)
+        r.u32();
+    for (uint32_t i = 0; i < nentries && r.ok(); i++) {
+        PermString key = r.permstring();
+        PermString directory = r.permstring();
+        String value = r.string();
+        bool escaped = r.u32() != 0;
+        if (r.ok() && !_map[key]) {
+            _map.insert(key, _directories.size());
+            _directories.push_back(directory);
+            _values.push_back(value);
+            _value_escaped.push_back(escaped);
+        }
+    }
+    _cache = String();
+}
+
+void
+PsresDatabase::write_cache(const String &filename, const String &key)
+{
+    StringAccum sa;
+    append_u32(sa, MAGIC);
+    append_u32(sa, FORMAT_VERSION);
+    append_u32(sa, 0);
+    append_string(sa, key.data(), key.length());
+    append_u32(sa, _dependencies.size());
+    for (int i = 0; i < _dependencies.size(); i++)
+        sa << _dependencies[i];
+
+    append_u32(sa, _sections.size() - 1);
+    Vector<int> offset_pos;
+    for (int i = 1; i < _sections.size(); i++) {
+        PermString name = _sections[i]->section_name();
+        append_string(sa, name.c_str(), name.length());
+        offset_pos.push_back(sa.length());
+        append_u32(sa, 0);
+    }
+
+    for (int i = 1; i < _sections.size(); i++) {
+        set_u32(sa.data() + offset_pos[i - 1], sa.length());
+        PsresDatabaseSection *s = _sections[i];
+        append_string(sa, s->section_name().c_str(), s->section_name().length());
+        append_u32(sa, s->_map.size());
+
+        // Keep the table at most half full.
+        uint32_t nbuckets = 1;
+        while (nbuckets < 2 * (uint32_t) s->_map.size())
+            nbuckets *= 2;
+        append_u32(sa, nbuckets);
+        int bucket_pos = sa.length();
+        for (uint32_t b = 0; b < nbuckets; b++)
+            append_u32(sa, 0);
+
+        for (HashMap<PermString, int>::const_iterator it = s->_map.begin(); it; it++) {
+            PermString k = it.key();
+            uint32_t b = cache_hash(k.c_str(), k.length()) & (nbuckets - 1);
+            while (OpenType::Data::u32(sa.udata() + bucket_pos + 4 * b))
+                b = (b + 1) & (nbuckets - 1);
+            set_u32(sa.data() + bucket_pos + 4 * b, sa.length());
+
+            int index = it.value();
+            PermString dir = s->_directories[index];
+            append_string(sa, k.c_str(), k.length());
+            append_string(sa, dir.c_str(), dir.length());
+            append_string(sa, s->_values[index].data(), s->_values[index].length());
+            append_u32(sa, s->_value_escaped[index]);
+        }
+    }
+
+    set_u32(sa.data() + 8, sa.length());
+
+    // replace_file() uses a unique temporary name, so programs sharing
+    // the directory cannot write over each other.  A cache that cannot be
+    // written is not an error.
+    replace_file(filename, sa.take_string());
+    _dependencies.clear();
+}
+
 }
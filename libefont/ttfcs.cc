@@ -102,6 +102,7 @@ TrueTypeBoundsCharstringProgram::glyph_name(int gi) const
         if (post.ok())
             post.glyph_names(_glyph_names);
         HashMap<PermString, int> name2glyph(-1);
+        name2glyph.reserve(_glyph_names.size());
         // some 'post' tables are bogus, reject multiply-encoded names
         for (int gi = 0; gi < _glyph_names.size(); ++gi) {
             int& xgi = name2glyph.find_force(_glyph_names[gi]);
@@ -931,8 +931,13 @@ ErrorHandler::emit(const String &, void *user_data, bool)
 void
 ErrorHandler::account(int level)
 {
-    if (level <= el_error)
+    if (level <= el_error) {
+#if HAVE_ATOMIC_BUILTINS
+        __atomic_add_fetch(&_nerrors, 1, __ATOMIC_RELAXED);
+#else
         ++_nerrors;
+#endif
+    }
 #ifndef __KERNEL__
     if (level <= el_abort)
         abort();
@@ -19,10 +19,21 @@
 #include <lcdf/filename.hh>
 #include <lcdf/landmark.hh>
 #include <stdarg.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+#ifdef HAVE_FCNTL_H
+# include <fcntl.h>
+#endif
+#ifndef O_BINARY
+# define O_BINARY 0
+#endif
 #ifndef PATHNAME_SEPARATOR
 # define PATHNAME_SEPARATOR '/'
 #endif
@@ -128,3 +139,50 @@ Filename::open_write(bool binary) const
     else
 	return fopen(_path.c_str(), binary ? "wb" : "w");
 }
+
+
+/** @brief Replace @a filename's contents with @a data.
+ *
+ * Writes a uniquely named temporary file in @a filename's directory, then
+ * renames it into place, so readers never see a partial file and writers
+ * sharing the directory never write over each other's temporary files.
+ * The file gets permissions @a mode, or, if @a mode is negative, 0666 less
+ * the umask, as fopen() would give it.  Returns 0 on success and a
+ * negative errno value on failure; the temporary file is removed on
+ * failure. */
+int
+replace_file(const String &filename, const String &data, int mode)
+{
+#if HAVE_MKSTEMP && !defined(WIN32)
+    String tmp = filename + ".XXXXXX";
+    int fd = mkstemp(tmp.mutable_c_str());
+    if (fd < 0)
+	return -errno;
+    // mkstemp() creates the file 0600
+    if (mode < 0) {
+	mode_t mask = umask(0);
+	umask(mask);
+	mode = 0666 & ~mask;
+    }
+    int r = (fchmod(fd, mode) < 0 ? -errno : 0);
+#else
+    String tmp = filename + ".tmp";
+    int fd = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_BINARY,
+		  mode < 0 ? 0666 : mode);
+    if (fd < 0)
+	return -errno;
+    int r = 0;
+#endif
+    if (r >= 0) {
+	ssize_t w = write(fd, data.data(), data.length());
+	if (w != (ssize_t) data.length())
+	    r = (w < 0 ? -errno : -ENOSPC);
+    }
+    if (close(fd) < 0 && r >= 0)
+	r = -errno;
+    if (r >= 0 && rename(tmp.c_str(), filename.c_str()) < 0)
+	r = -errno;
+    if (r < 0)
+	unlink(tmp.c_str());
+    return r;
+}
@@ -0,0 +1,135 @@
+// -*- related-file-name: "../include/lcdf/parallel.hh" -*-
+
+/* parallel.{cc,hh} -- run independent work items on a thread pool
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <lcdf/parallel.hh>
+#if HAVE_PTHREADS
+# include <pthread.h>
+#endif
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+
+int parallel_jobs = 0;
+
+enum { MAX_JOBS = 64 };
+
+int
+default_parallel_jobs()
+{
+#if HAVE_PTHREADS && defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n > MAX_JOBS)
+        return MAX_JOBS;
+    return n > 1 ? (int) n : 1;
+#else
+    return 1;
+#endif
+}
+
+String
+DeferredErrorHandler::decorate(const String &str)
+{
+    _messages.push_back(str);
+    return str;
+}
+
+void
+DeferredErrorHandler::account(int level)
+{
+    ErrorHandler::account(level < el_error ? el_error : level);
+}
+
+void
+DeferredErrorHandler::replay(ErrorHandler *errh) const
+{
+    if (errh)
+        for (const String *m = _messages.begin(); m != _messages.end(); ++m)
+            errh->xmessage(*m);
+}
+
+#if HAVE_PTHREADS && HAVE_ATOMIC_BUILTINS
+namespace {
+struct Pool {
+    ParallelTask *task;
+    int next;
+    int n;
+    pthread_mutex_t lock;
+};
+}
+
+extern "C" {
+static void *
+pool_worker(void *arg)
+{
+    Pool *pool = static_cast<Pool *>(arg);
+    void *thread = pool->task->thread_begin(true);
+    while (1) {
+        pthread_mutex_lock(&pool->lock);
+        int item = pool->next;
+        if (item < pool->n)
+            ++pool->next;
+        pthread_mutex_unlock(&pool->lock);
+        if (item >= pool->n)
+            break;
+        pool->task->run(item, thread);
+    }
+    pool->task->thread_end(thread);
+    return 0;
+}
+}
+#endif
+
+void
+run_parallel(ParallelTask &task, int n, int min_items)
+{
+    // threads cost more than they save on typical fonts, so only use them
+    // when asked
+    int jobs = (parallel_jobs > 0 ? parallel_jobs : 1);
+    if (min_items < 1)
+        min_items = 1;
+    if (jobs > n / min_items)
+        jobs = n / min_items;
+    if (jobs > MAX_JOBS)
+        jobs = MAX_JOBS;
+#if HAVE_PTHREADS && HAVE_ATOMIC_BUILTINS
+    if (jobs > 1) {
+        Pool pool;
+        pool.task = &task;
+        pool.next = 0;
+        pool.n = n;
+        pthread_mutex_init(&pool.lock, 0);
+
+        pthread_t threads[MAX_JOBS];
+        int nthreads = 0;
+        for (; nthreads < jobs; ++nthreads)
+            if (pthread_create(&threads[nthreads], 0, pool_worker, &pool) != 0)
+                break;
+        if (nthreads == 0)
+            pool_worker(&pool);
+        for (int i = 0; i < nthreads; ++i)
+            pthread_join(threads[i], 0);
+
+        pthread_mutex_destroy(&pool.lock);
+        return;
+    }
+#endif
+    void *thread = task.thread_begin(false);
+    for (int i = 0; i < n; ++i)
+        task.run(i, thread);
+    task.thread_end(thread);
+}
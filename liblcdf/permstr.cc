@@ -130,62 +130,89 @@ PermString::initialize(const char* s, int length)
 	hash = (hash << 1) + scatter[*mm];
     hash &= (NHASH - 1);
 
-    Doodad *buck;
-    for (buck = buckets[hash]; buck; buck = buck->next)
-	if (length == buck->length && memcmp(s, buck->data, length) == 0) {
-	    _rep = buck->data;
-	    return;
+    // Doodads are never removed, and are immutable once they are linked
+    // into a bucket. With HAVE_ATOMIC_BUILTINS, a new doodad is pushed with
+    // compare-and-swap, so lookups and insertions on different threads need
+    // no locks. If another thread pushed first, check its doodads too.
+#if HAVE_ATOMIC_BUILTINS
+    Doodad *head = __atomic_load_n(&buckets[hash], __ATOMIC_ACQUIRE);
+#else
+    Doodad *head = buckets[hash];
+#endif
+    Doodad *checked = 0, *buck = 0;
+    while (1) {
+	for (Doodad *d = head; d != checked; d = d->next)
+	    if (length == d->length && memcmp(s, d->data, length) == 0) {
+		free(buck);
+		_rep = d->data;
+		return;
+	    }
+
+	if (!buck) {
+	    // CANNOT USE new because the structure has variable size.
+	    buck = (Doodad *)malloc(sizeof(Doodad) + length - 1);
+	    buck->length = length;
+	    memcpy(buck->data, s, length);
+	    buck->data[length] = 0;
 	}
+	buck->next = checked = head;
 
-    // CANNOT USE new because the structure has variable size.
-    buck = (Doodad *)malloc(sizeof(Doodad) + length - 1);
-    buck->next = buckets[hash];
-    buckets[hash] = buck;
-    buck->length = length;
-    memcpy(buck->data, s, length);
-    buck->data[length] = 0;
+#if HAVE_ATOMIC_BUILTINS
+	if (__atomic_compare_exchange_n(&buckets[hash], &head, buck, false,
+					__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+	    break;
+#else
+	buckets[hash] = buck;
+	break;
+#endif
+    }
 
     _rep = buck->data;
 }
 
-static int pspos;
-static int pscap = 64;
-static char *psc = (char *)malloc(pscap);
+namespace {
+struct PermBuffer {
+    char *s;
+    int pos;
+    int cap;
+    PermBuffer()			: s((char *)malloc(64)), pos(0), cap(64) { }
+    ~PermBuffer()			{ free(s); }
+    inline void append(const char *x, int len);
+    inline void extend(int len);
+};
+}
 
-static void
-append(const char *s, int len)
+inline void
+PermBuffer::append(const char *x, int len)
 {
-    if (pspos + len >= pscap) {
-	pscap *= 2;
-	psc = (char *)realloc(psc, pscap);
-    }
-    memcpy(psc + pspos, s, len);
-    pspos += len;
+    extend(len);
+    memcpy(s + pos, x, len);
+    pos += len;
 }
 
-inline static void
-extend(int len)
+inline void
+PermBuffer::extend(int len)
 {
-    while (pspos + len >= pscap) {
-	pscap *= 2;
-	psc = (char *)realloc(psc, pscap);
+    while (pos + len >= cap) {
+	cap *= 2;
+	s = (char *)realloc(s, cap);
     }
 }
 
 PermString
 vpermprintf(const char *s, va_list val)
 {
-    pspos = 0;
+    PermBuffer b;
     while (1) {
 
 	const char *pct = strchr(s, '%');
 	if (!pct) {
 	    if (*s)
-		append(s, strlen(s));
+		b.append(s, strlen(s));
 	    break;
 	}
 	if (pct != s) {
-	    append(s, pct - s);
+	    b.append(s, pct - s);
 	    s = pct;
 	}
 
@@ -216,16 +243,16 @@ vpermprintf(const char *s, va_list val)
 		  const char *x = va_arg(val, const char *);
 		  if (x) {
 		      if (iflag < 0)
-			  append(x, strlen(x));
+			  b.append(x, strlen(x));
 		      else
-			  append(x, iflag);
+			  b.append(x, iflag);
 		  }
 		  goto pctdone;
 	      }
 
 	      case 'c': {
 		  char c = (char)(va_arg(val, int) & 0xFF);
-		  append(&c, 1);
+		  b.append(&c, 1);
 		  goto pctdone;
 	      }
 
@@ -235,22 +262,22 @@ vpermprintf(const char *s, va_list val)
 		  if (x)
 		      px = PermString::decapsule(x);
 		  if (iflag < 0 || iflag > px.length())
-		      append(px.c_str(), px.length());
+		      b.append(px.c_str(), px.length());
 		  else
-		      append(px.c_str(), iflag);
+		      b.append(px.c_str(), iflag);
 		  goto pctdone;
 	      }
 
 	      case 'd': {
 		  // FIXME FIXME rewrite for sense
 		  int x = va_arg(val, int);
-		  if (pspos == pscap)
-		      extend(1);
+		  if (b.pos == b.cap)
+		      b.extend(1);
 
 		  // FIXME -2^31
 		  unsigned int ux = x;
 		  if (x < 0) {
-		      psc[pspos++] = '-';
+		      b.s[b.pos++] = '-';
 		      ux = -x;
 		  }
 
@@ -258,14 +285,14 @@ vpermprintf(const char *s, va_list val)
 		  for (unsigned digcountx = ux; digcountx > 9; digcountx /= 10)
 		      numdigits++;
 
-		  extend(numdigits + 1);
+		  b.extend(numdigits + 1);
 		  int digit = numdigits;
 		  do {
-		      psc[pspos + digit] = (ux % 10) + '0';
+		      b.s[b.pos + digit] = (ux % 10) + '0';
 		      ux /= 10;
 		      digit--;
 		  } while (ux);
-		  pspos += numdigits + 1;
+		  b.pos += numdigits + 1;
 
 		  goto pctdone;
 	      }
@@ -276,9 +303,9 @@ vpermprintf(const char *s, va_list val)
 		  char buffer[1000];
 		  int len;
 		  sprintf(buffer, "%.10g%n", x, &len);
-		  extend(len);
-		  strcpy(psc + pspos, buffer);
-		  pspos += len;
+		  b.extend(len);
+		  strcpy(b.s + b.pos, buffer);
+		  b.pos += len;
 		  goto pctdone;
 	      }
 
@@ -292,7 +319,7 @@ vpermprintf(const char *s, va_list val)
 	s++;
     }
 
-    return PermString(psc, pspos);
+    return PermString(b.s, b.pos);
 }
 
 PermString permprintf(const char *s, ...)
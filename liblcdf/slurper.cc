@@ -18,6 +18,12 @@
 #endif
 #include <lcdf/slurper.hh>
 #include <string.h>
+#if HAVE_MMAP && HAVE_SYS_MMAN_H && HAVE_SYS_STAT_H
+# include <sys/types.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# define LCDF_SLURPER_MMAP 1
+#endif
 
 static const int DefChunkCap	= 2048;
 static const int WorthMoving	= 256;
@@ -27,7 +33,8 @@ Slurper::Slurper(const Filename &filename, FILE *f)
   : _filename(filename), _lineno(0),
     _data(new unsigned char[DefChunkCap]), _cap(DefChunkCap),
     _pos(0), _len(0), _line(0), _line_len(0),
-    _saved_line(false), _at_eof(false)
+    _saved_line(false), _at_eof(false), _line_is_view(false),
+    _map(0), _map_len(0)
 {
   if (f) {
     _f = f;
@@ -35,16 +42,45 @@ Slurper::Slurper(const Filename &filename, FILE *f)
   } else {
     _f = _filename.open_read();
     _own_f = true;
+    if (_f && !_filename.fake())
+      map_file();
   }
 }
 
 Slurper::~Slurper()
 {
   delete[] _data;
+#if LCDF_SLURPER_MMAP
+  if (_map)
+    munmap((void *)_map, _map_len);
+#endif
   if (_f && _own_f) fclose(_f);
 }
 
 
+void
+Slurper::map_file()
+{
+#if LCDF_SLURPER_MMAP
+  // Map regular files that we opened ourselves; read everything else
+  // (pipes, terminals, FILEs our caller may have read from) through stdio.
+  struct stat st;
+  int fd = fileno(_f);
+  if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+      || st.st_size <= 0 || (off_t)(unsigned) st.st_size != st.st_size)
+    return;
+  void *m = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (m != MAP_FAILED) {
+    _map = (const unsigned char *)m;
+    _map_len = _len = st.st_size;
+# ifdef MADV_SEQUENTIAL
+    madvise(m, st.st_size, MADV_SEQUENTIAL);
+# endif
+  }
+#endif
+}
+
+
 void
 Slurper::grow_buffer()
 {
@@ -147,17 +183,100 @@ Slurper::get_line_at(unsigned pos)
   return (char *)_line;
 }
 
+// Mapped files: lines are views into _map, from _pos up to _len, and are
+// copied into _data only when someone asks for a null-terminated line.
+
+const char *
+Slurper::get_view()
+{
+  const unsigned char *s = _map + _pos, *end = _map + _len;
+  const unsigned char *nl = (const unsigned char *)memchr(s, '\n', end - s);
+  const unsigned char *lend = (nl ? nl : end);
+  if (const unsigned char *cr = (const unsigned char *)memchr(s, '\r', lend - s))
+    lend = cr;
+
+  if (lend == end) {
+    _at_eof = true;
+    if (lend != s)
+      _lineno++;
+    _pos = _len;
+  } else {
+    _lineno++;
+    if (*lend == '\r' && lend + 1 < end && lend[1] == '\n')
+      _pos = lend + 2 - _map;
+    else
+      _pos = lend + 1 - _map;
+  }
+
+  _line = (unsigned char *)s;
+  _line_len = lend - s;
+  _line_is_view = true;
+  return (const char *)s;
+}
+
+void
+Slurper::reserve_data(unsigned n)
+{
+  if (n > _cap) {
+    unsigned new_cap = _cap;
+    while (new_cap < n)
+      new_cap *= 2;
+    unsigned char *new_data = new unsigned char[new_cap];
+    if (!_line_is_view && _line == _data)
+      memcpy(new_data, _data, _line_len);
+    if (_line == _data)
+      _line = new_data;
+    delete[] _data;
+    _data = new_data;
+    _cap = new_cap;
+  }
+}
+
+void
+Slurper::copy_view()
+{
+  assert(_line_is_view);
+  _line_is_view = false;
+  const unsigned char *view = _line;
+  _line = 0;
+  reserve_data(_line_len + 1);
+  memcpy(_data, view, _line_len);
+  _data[_line_len] = 0;
+  _line = _data;
+}
+
+const char *
+Slurper::next_line_view()
+{
+  if (!_map)
+    return next_line();
+  if (_saved_line) {
+    _saved_line = false;
+    return (const char *)_line;
+  }
+  get_view();
+  if (_line_len == 0 && _at_eof) {
+    _line = 0;
+    _line_is_view = false;
+  }
+  return (const char *)_line;
+}
+
 char *
 Slurper::next_line()
 {
   if (_saved_line) {
     _saved_line = false;
-    return (char *)_line;
+    return cur_line();
   }
-  get_line_at(_pos);
-  if (_line_len == 0 && _at_eof)
-    _line = 0;
-  return (char *)_line;
+  if (_map)
+    next_line_view();
+  else {
+    get_line_at(_pos);
+    if (_line_len == 0 && _at_eof)
+      _line = 0;
+  }
+  return cur_line();
 }
 
 char *
@@ -171,6 +290,34 @@ Slurper::peek_line()
 char *
 Slurper::append_next_line()
 {
+  if (_map) {
+    if (!_line)
+      return next_line();
+    if (_line_is_view)
+      copy_view();
+    unsigned old_len = _line_len;
+    get_view();
+    if (_line_len == 0 && _at_eof) {
+      // count the missing line, as get_line_at() does
+      if (old_len)
+	_lineno++;
+      _line_is_view = false;
+      _line = _data;
+      _line_len = old_len;
+    } else {
+      const unsigned char *view = _line;
+      unsigned view_len = _line_len;
+      _line_is_view = false;
+      _line = _data;
+      _line_len = old_len;
+      reserve_data(old_len + view_len + 1);
+      memcpy(_data + old_len, view, view_len);
+      _line_len = old_len + view_len;
+      _data[_line_len] = 0;
+    }
+    return (char *)_line;
+  }
+
   unsigned delta = (_data + _pos) - (_line + _line_len);
   if (_len - _pos > _line_len) {
     memmove(_line + delta, _line, _line_len);
@@ -66,6 +66,19 @@
  * different from the data() of any other string.  See
  * String::out_of_memory_data().  The String::make_out_of_memory() function
  * returns an out-of-memory string.
+ *
+ * <h3>Threads</h3>
+ *
+ * When built with HAVE_ATOMIC_BUILTINS (the default; see configure's
+ * --disable-threads option), Strings on different threads may share data:
+ * copying, destroying, appending to, and calling c_str() on different
+ * String objects is safe even when they share a memo.  Appends claim
+ * unused memo space atomically, and c_str() on a String whose memo is
+ * shared never trusts the bytes past its own data, since another String
+ * may have claimed them but not yet written them; instead it terminates
+ * the string in newly claimed or newly allocated space.  A single String
+ * object must not be used on one thread while another thread modifies it;
+ * c_str() can modify.  String profiling counters are not thread-safe.
  */
 
 const char String::null_data = '\0';
@@ -341,14 +354,23 @@ String::append_uninitialized(int len)
     // If we can, append into unused space. First, we check that there's
     // enough unused space for 'len' characters to fit; then, we check
     // that the unused space immediately follows the data in '*this'.
+    // With HAVE_ATOMIC_BUILTINS, other Strings sharing the memo may be
+    // appending on other threads, so claim the space atomically.
     uint32_t dirty;
     if (_r.memo
-	&& ((dirty = _r.memo->dirty), _r.memo->capacity > dirty + len)) {
+	&& ((dirty = memo_dirty(_r.memo)), _r.memo->capacity > dirty + len)) {
 	char *real_dirty = _r.memo->real_data + dirty;
-	if (real_dirty == _r.data + _r.length) {
+	if (real_dirty == _r.data + _r.length
+#if HAVE_ATOMIC_BUILTINS
+	    && __atomic_compare_exchange_n(&_r.memo->dirty, &dirty, dirty + len,
+					   false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+#endif
+	    ) {
+#if !HAVE_ATOMIC_BUILTINS
 	    _r.memo->dirty = dirty + len;
+#endif
 	    _r.length += len;
-	    assert(_r.memo->dirty < _r.memo->capacity);
+	    assert(dirty + len < _r.memo->capacity);
 #if HAVE_STRING_PROFILING
 	    profile_update_memo_dirty(_r.memo, dirty, dirty + len, _r.memo->capacity);
 #endif
@@ -431,12 +453,12 @@ String::mutable_data()
 {
     // If _memo has a capacity (it's not one of the special strings) and it's
     // uniquely referenced, return _data right away.
-    if (_r.memo && _r.memo->refcount == 1)
+    if (_r.memo && memo_refcount(_r.memo) == 1)
 	return const_cast<char *>(_r.data);
 
     // Otherwise, make a copy of it. Rely on: deref() doesn't change _data or
     // _length; and if _capacity == 0, then deref() doesn't free _real_data.
-    assert(!_r.memo || _r.memo->refcount > 1);
+    assert(!_r.memo || memo_refcount(_r.memo) > 1);
     // But in multithreaded situations we must hold a local copy of memo!
     String do_not_delete_underlying_memo(*this);
     deref();
@@ -75,6 +75,21 @@ Vector<void*>::reserve(int want)
     return true;
 }
 
+void
+Vector<void*>::shrink_to_fit()
+{
+    if (_capacity > _n) {
+        void **new_l = 0;
+        if (_n) {
+            new_l = new void*[_n];
+            memcpy(new_l, _l, sizeof(void*) * _n);
+        }
+        delete[] _l;
+        _l = new_l;
+        _capacity = _n;
+    }
+}
+
 Vector<void*>::iterator
 Vector<void*>::erase(iterator a, iterator b)
 {
@@ -2,14 +2,11 @@
 use bytes;
 
 sub P_Cn () { 0; }
-sub P_Lu () { 31; }
-sub P_Ll () { 32; }
-sub P_Lul () { 33; }
 
 my(%propmap) = ('Cn' => P_Cn, 'Co' => 1, 'Cs' => 2, 'Cf' => 3, 'Cc' => 4,
                 'Zs' => 10, 'Zl' => 11, 'Zp' => 12,
                 'Mn' => 20, 'Mc' => 21, 'Me' => 22,
-                'Lo' => 30, 'Lu' => P_Lu, 'Ll' => P_Ll, 'Lul' => P_Lul, 'Lt' => 34, 'Lm' => 35,
+                'Lo' => 30, 'Lu' => 31, 'Ll' => 32, 'Lt' => 34, 'Lm' => 35,
                 'No' => 40, 'Nd' => 41, 'Nl' => 42,
                 'Po' => 50, 'Pc' => 51, 'Pd' => 52, 'Ps' => 53, 'Pe' => 54, 'Pi' => 55, 'Pf' => 56,
                 'So' => 60, 'Sm' => 61, 'Sc' => 62, 'Sk' => 63,
@@ -23,69 +20,43 @@ my(@propinvmap);
     }
 }
 
-open(F, "UnicodeData.txt") || die;
+my($block_shift) = 8;		# keep in sync with uniprop.hh
+my($block_size) = 1 << $block_shift;
+my($maxuni) = 0x110000;
 
-my($last_val, @arr);
-my(%compressed_hash);
-my($all_compressed) = chr(0) . chr(P_Cn);
-$compressed_hash{$all_compressed} = [0, length($all_compressed)];
-my(@offsets);
+# read general categories for every code point, including ranges given as
+# "<..., First>" and "<..., Last>" pairs
+open(F, "UnicodeData.txt") || die;
 
-sub compress () {
-    my($t) = '';
-    my($v) = -100;
-    for (my $i = 0; $i < 256; $i++) {
-        if ($v != $arr[$i]) {
-            $v = $arr[$i];
-            if ($v == P_Lu && $i < 255 && $arr[$i+1] == P_Ll) {
-                $v = P_Lul;
-                $t .= chr($i) . chr($v);
-                while ($i <= 254 && $arr[$i] == P_Lu && $arr[$i+1] == P_Ll) {
-                    $i += 2;
-                }
-                $i--;
-            } else {
-                $t .= chr($i) . chr($v);
-            }
-        }
+my(@prop) = (P_Cn) x $maxuni;
+my($range_first);
+while (<F>) {
+    my(@x) = split(/;/, $_);
+    my($val) = hex($x[0]);
+    die "prop $x[2]" if !exists($propmap{$x[2]});
+    if ($x[1] =~ /, First>$/) {
+        $range_first = $val;
+    } elsif ($x[1] =~ /, Last>$/ && defined($range_first)) {
+        @prop[$range_first..$val] = ($propmap{$x[2]}) x ($val - $range_first + 1);
+        undef $range_first;
+    } else {
+        $prop[$val] = $propmap{$x[2]};
     }
-    $t;
 }
-
-sub out ($$) {
-    my($val, $prop) = @_;
-    if (defined($last_val) && ($val & ~255) != ($last_val & ~255)) {
-        $text = compress();
-        if (!exists($compressed_hash{$text})) {
-            $compressed_hash{$text} = [length($all_compressed), length($all_compressed) + length($text)];
-            $all_compressed .= $text;
-            print "   ";
-            foreach my $short (unpack('n*', $text)) {
-                die "X" . ($short&255) if !defined($propinvmap[int($short&255)]);
-                print " ", int($short>>8), ", P_", $propinvmap[int($short&255)], ",";
-            }
-            print "\n";
-        }
-
-        # now add offsets
-        my($off1, $off2) = @{$compressed_hash{$text}};
-        if (!@offsets || $offsets[-2] != $off1 || $offsets[-1] != $off2) {
-            push(@offsets, ($last_val & ~255), $off1, $off2);
-        }
-        if ($val >= 0 && ($val & ~255) != (($last_val & ~255) + 256)) {
-            push(@offsets, ($last_val & ~255)+256, 0, 2);
-        }
-
-        undef $last_val;
-    }
-
-    if (!defined($last_val)) {
-        @arr = (0) x 256;
+close(F);
+
+# two-stage table: property_blocks maps (u >> $block_shift) to a block
+# number, property_data holds the shared, deduplicated blocks
+my(%block_hash, @blocks, @block_index);
+for (my $u = 0; $u < $maxuni; $u += $block_size) {
+    my($key) = join(",", @prop[$u..($u + $block_size - 1)]);
+    if (!exists($block_hash{$key})) {
+        $block_hash{$key} = scalar(@blocks);
+        push(@blocks, [@prop[$u..($u + $block_size - 1)]]);
     }
-    die "prop $prop" if !exists($propmap{$prop});
-    $arr[$val & 255] = $propmap{$prop};
-    $last_val = $val;
+    push(@block_index, $block_hash{$key});
 }
+die "too many distinct blocks; increase \$block_shift" if @blocks > 256;
 
 print <<"EOD;";
 /* uniprop.{cc,hh} -- code for Unicode character properties
@@ -105,83 +76,30 @@ print <<"EOD;";
 #include "uniprop.hh"
 #include <lcdf/string.hh>
 
-const unsigned char UnicodeProperty::property_pages[] = {
-    0, P_Cn,
+const unsigned char UnicodeProperty::property_blocks[] = {
 EOD;
 
-while (<F>) {
-    my(@x) = split(/;/, $_);
-    my($val) = hex($x[0]);
-    out($val, $x[2]);
+for (my $i = 0; $i < @block_index; $i += 16) {
+    my($e) = $i + 15 < $#block_index ? $i + 15 : $#block_index;
+    print "    ", join(", ", @block_index[$i..$e]), ",\n";
 }
 
-out(0xFFFF, 'Cc');
-
-print "};\nconst unsigned int UnicodeProperty::property_offsets[] = {\n";
+print "};\nconst unsigned char UnicodeProperty::property_data[] = {\n";
 
-for (my $i = 0; $i < @offsets; $i += 3) {
-    printf("    0x%X, %d, %d,\n", $offsets[$i], $offsets[$i+1], $offsets[$i+2]);
+for (my $b = 0; $b < @blocks; $b++) {
+    my(@data) = @{$blocks[$b]};
+    for (my $i = 0; $i < @data; $i += 16) {
+        print "   ";
+        foreach my $p (@data[$i..($i + 15)]) {
+            print " P_", $propinvmap[$p], ",";
+        }
+        print "\n";
+    }
 }
 
 print "};\n";
 
 print <<"EOD;";
-const int UnicodeProperty::nproperty_offsets = (sizeof(UnicodeProperty::property_offsets) / (3*sizeof(unsigned int)));
-
-inline const unsigned int *
-UnicodeProperty::find_offset(uint32_t u)
-{
-    // Up to U+1A00 each page has its own definition.
-    if (u < 0x1A00)
-        return &property_offsets[3*(u >> 8)];
-    // At or after U+1A00, binary search.
-    int l = 0x1A, r = nproperty_offsets - 2;
-    while (l <= r) {
-        int m = (l + r) / 2;
-        const unsigned int *ptr = &property_offsets[3*m];
-        if (u < ptr[0])
-            r = m - 1;
-        else if (u >= ptr[3])
-            l = m + 1;
-        else
-            return ptr;
-    }
-    // If search fails, return last record, which will be all-unassigned.
-    return &property_offsets[3*(nproperty_offsets - 1)];
-}
-
-int
-UnicodeProperty::property(uint32_t u)
-{
-    const unsigned int *offsets = find_offset(u);
-
-    // Now we only care about the last byte.
-    u &= 255;
-
-    // Binary search within record.
-    int l = offsets[1], r = offsets[2] - 4;
-    const unsigned char *the_ptr;
-    while (l <= r) {
-        int m = ((l + r) / 2) & ~1;
-        const unsigned char *ptr = &property_pages[m];
-        if (u < ptr[0])
-            r = m - 2;
-        else if (u >= ptr[2])
-            l = m + 2;
-        else {
-            the_ptr = ptr;
-            goto found_ptr;
-        }
-    }
-    the_ptr = &property_pages[l];
-
-  found_ptr:
-    // Found right block.
-    if (the_ptr[1] == P_Lul)
-        return ((u - the_ptr[0]) % 2 ? P_Ll : P_Lu);
-    else
-        return the_ptr[1];
-}
 
 static const char property_names[] =
     "Cn\\0Co\\0Cs\\0Cf\\0Cc\\0\\0\\0\\0\\0\\0\\0\\0\\0\\0"
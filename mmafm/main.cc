@@ -26,6 +26,8 @@
 #include <string.h>
 #include <errno.h>
 #include <math.h>
+#include <ctype.h>
+#include <stdlib.h>
 #ifdef HAVE_CTIME
 # include <time.h>
 #endif
@@ -43,6 +45,9 @@
 #define OUTPUT_OPT	310
 #define PRECISION_OPT	311
 #define KERN_PREC_OPT	312
+#define METRICS_CACHE_OPT	313
+#define BATCH_OPT	314
+#define OUTPUT_DIR_OPT	315
 
 const Clp_Option options[] = {
   { "1", '1', N1_OPT, Clp_ValDouble, 0 },
@@ -59,6 +64,9 @@ const Clp_Option options[] = {
   { "minimum-kern", 'k', KERN_PREC_OPT, Clp_ValDouble, 0 },
   { "kern-precision", 'k', KERN_PREC_OPT, Clp_ValDouble, 0 },
   { "output", 'o', OUTPUT_OPT, Clp_ValString, 0 },
+  { "batch", 0, BATCH_OPT, Clp_ValString, 0 },
+  { "output-directory", 0, OUTPUT_DIR_OPT, Clp_ValString, 0 },
+  { "metrics-cache", 0, METRICS_CACHE_OPT, Clp_ValString, 0 },
   { "precision", 'p', PRECISION_OPT, Clp_ValInt, 0 },
   { "version", 'v', VERSION_OPT, 0, 0 },
   { "help", 'h', HELP_OPT, 0, 0 },
@@ -146,6 +154,38 @@ apply_kern_precision(Metrics *m, double kern_precision)
 }
 
 
+static void
+prepare_output(Metrics *m, int precision, double kern_precision)
+{
+  // Add a comment identifying this as interpolated by mmafm
+  if (MetricsXt *xt = m->find_xt("AFM")) {
+    AfmMetricsXt *afm_xt = (AfmMetricsXt *)xt;
+
+#if HAVE_CTIME
+    time_t cur_time = time(0);
+    char *time_str = ctime(&cur_time);
+    int time_len = strlen(time_str) - 1;
+    char *buf = new char[strlen(VERSION) + time_len + 100];
+    sprintf(buf, "Interpolated by mmafm-%s on %.*s.", VERSION,
+	    time_len, time_str);
+#else
+    char *buf = new char[strlen(VERSION) + 100];
+    sprintf(buf, "Interpolated by mmafm-%s.", VERSION);
+#endif
+
+    afm_xt->opening_comments.push_back(buf);
+    afm_xt->opening_comments.push_back("Mmafm is free software.  See <http://www.lcdf.org/type/>.");
+    delete[] buf;
+  }
+
+  // round numbers if necessary
+  if (precision >= 0)
+    apply_precision(m, precision);
+  if (kern_precision > 0)
+    apply_kern_precision(m, kern_precision);
+}
+
+
 static void
 read_file(const char *fn, MetricsFinder *finder)
 {
@@ -205,6 +245,76 @@ read_file(const char *fn, MetricsFinder *finder)
 }
 
 
+// Read design vectors, one per line, from a batch file. Coordinates are
+// separated by whitespace or commas; axes left off the end of a line take
+// their values from default_design. Blank lines and lines starting with `#'
+// are ignored.
+static void
+read_batch(const char *fn, const Vector<double> &default_design,
+	   Vector<Vector<double> > &designs, Vector<String> &landmarks)
+{
+  Filename filename;
+  FILE *file;
+  if (strcmp(fn, "-") == 0) {
+    filename = Filename("<stdin>");
+    file = stdin;
+  } else {
+    filename = Filename(fn);
+    file = filename.open_read();
+  }
+  if (!file)
+    errh->fatal("%s: %s", fn, strerror(errno));
+
+  Slurper slurper(filename, file);
+  while (char *line = slurper.next_line()) {
+    while (isspace((unsigned char) *line))
+      line++;
+    if (!*line || *line == '#')
+      continue;
+
+    Vector<double> design(default_design);
+    int a = 0;
+    while (*line) {
+      char *end;
+      double x = strtod(line, &end);
+      if (end == line) {
+	errh->lerror(slurper.landmark(), "bad design coordinate");
+	goto next_line;
+      } else if (a >= design.size()) {
+	errh->lerror(slurper.landmark(), "too many design coordinates (this font has %d axes)", design.size());
+	goto next_line;
+      }
+      design[a++] = x;
+      for (line = end; isspace((unsigned char) *line) || *line == ','; line++)
+	/* nada */;
+    }
+
+    for (a = 0; a < design.size(); a++)
+      if (!KNOWN(design[a])) {
+	errh->lerror(slurper.landmark(), "missing %s coordinate", amfm->mmspace()->axis_type(a).c_str());
+	goto next_line;
+      }
+    designs.push_back(design);
+    landmarks.push_back(slurper.landmark());
+
+  next_line: ;
+  }
+}
+
+static void
+weight_vector_failure(MultipleMasterSpace *mmspace)
+{
+  if (!mmspace->check_intermediate()) {
+    errh->message("(I can%,t interpolate font programs with intermediate masters on my own.");
+#if MMAFM_RUN_MMPFB
+    errh->message("I tried to run %<mmpfb --amcp-info %s%>, but it didn't work.", amfm->font_name().c_str());
+    errh->message("Maybe your PSRESOURCEPATH environment variable is not set?");
+#endif
+    errh->fatal("See the manual page for more information.)");
+  }
+}
+
+
 static void
 usage_error(const char *error_message, ...)
 {
@@ -235,6 +345,9 @@ the PSRESOURCEPATH environment variable.\n\
 \n\
 General options:\n\
   -o, --output=FILE             Write output to FILE.\n\
+      --batch=FILE              Interpolate one instance per line of FILE.\n\
+      --output-directory=DIR    Write batch instances to DIR (default .).\n\
+      --metrics-cache=DIR       Keep compiled master AFM files in DIR.\n\
   -h, --help                    Print this message and exit.\n\
   -v, --version                 Print version number and warranty and exit.\n\
 \n\
@@ -257,6 +370,7 @@ main(int argc, char *argv[])
   MetricsFinder *finder = new CacheMetricsFinder;
 
   PsresDatabase *psres = new PsresDatabase;
+  psres->set_cache_directory(getenv("PSRESOURCECACHE"));
   psres->add_psres_path(getenv("PSRESOURCEPATH"), 0, false);
   PsresMetricsFinder *psres_finder = new PsresMetricsFinder(psres);
   finder->add_finder(psres_finder);
@@ -268,6 +382,8 @@ main(int argc, char *argv[])
   errh = ErrorHandler::static_initialize(new FileErrorHandler(stderr, String(program_name) + ": "));
 
   FILE *output_file = 0;
+  const char *batch_file = 0;
+  String output_directory = ".";
   int precision = 3;
   double kern_precision = 2.0;
   while (1) {
@@ -316,6 +432,19 @@ main(int argc, char *argv[])
       }
       break;
 
+     case BATCH_OPT:
+      if (batch_file) errh->fatal("batch file already specified");
+      batch_file = clp->vstr;
+      break;
+
+     case OUTPUT_DIR_OPT:
+      output_directory = clp->vstr;
+      break;
+
+     case METRICS_CACHE_OPT:
+      finder->add_finder(new PersistentMetricsFinder(clp->vstr));
+      break;
+
      case HELP_OPT:
       usage();
       exit(0);
@@ -346,6 +475,8 @@ particular purpose.\n");
 
  done:
   if (!amfm) usage_error("missing font argument");
+  if (batch_file && output_file)
+    usage_error("%<--batch%> and %<--output%> are mutually exclusive");
 
   MultipleMasterSpace *mmspace = amfm->mmspace();
 #if MMAFM_RUN_MMPFB
@@ -372,17 +503,53 @@ particular purpose.\n");
     else
       mmspace->set_design(design, ax_nums[i], values[i], errh);
 
+  if (batch_file) {
+    Vector<Vector<double> > designs;
+    Vector<String> landmarks;
+    read_batch(batch_file, design, designs, landmarks);
+
+    // Compute every weight vector first, so the masters are loaded once
+    // and blended into all the instances together.
+    Vector<Vector<double> > good_designs, weights;
+    Vector<String> good_landmarks;
+    for (int i = 0; i < designs.size(); i++) {
+      Vector<double> weight;
+      if (!mmspace->design_to_weight(designs[i], weight, errh)) {
+	weight_vector_failure(mmspace);
+	errh->lerror(landmarks[i], "can%,t create weight vector");
+	continue;
+      }
+      good_designs.push_back(designs[i]);
+      weights.push_back(weight);
+      good_landmarks.push_back(landmarks[i]);
+    }
+
+    Vector<Metrics *> instances;
+    amfm->interpolate(good_designs, weights, instances, errh);
+
+    for (int i = 0; i < instances.size(); i++)
+      if (Metrics *m = instances[i]) {
+	prepare_output(m, precision, kern_precision);
+	String fn = output_directory + "/" + m->font_name() + ".afm";
+	FILE *f = fopen(fn.c_str(), "wb");
+	if (!f)
+	  errh->error("%s: %s", fn.c_str(), strerror(errno));
+	else {
+	  AfmWriter::write(m, f);
+	  if (fclose(f) != 0)
+	    errh->error("%s: %s", fn.c_str(), strerror(errno));
+	}
+	delete m;
+      } else
+	errh->lerror(good_landmarks[i], "can%,t interpolate instance");
+
+    return errh->nerrors() ? 1 : 0;
+  }
+
   Vector<double> weight;
   if (!mmspace->design_to_weight(design, weight, errh)) {
-    if (!mmspace->check_intermediate()) {
-      errh->message("(I can%,t interpolate font programs with intermediate masters on my own.");
-#if MMAFM_RUN_MMPFB
-      errh->message("I tried to run %<mmpfb --amcp-info %s%>, but it didn't work.", amfm->font_name().c_str());
-      errh->message("Maybe your PSRESOURCEPATH environment variable is not set?");
-#endif
-      errh->fatal("See the manual page for more information.)");
-    } else
-      errh->fatal("can%,t create weight vector");
+    weight_vector_failure(mmspace);
+    errh->fatal("can%,t create weight vector");
   }
 
   // Need to check for case when all design coordinates are unspecified. The
@@ -396,33 +563,7 @@ particular purpose.\n");
 
   Metrics *m = amfm->interpolate(design, weight, errh);
   if (m) {
-
-    // Add a comment identifying this as interpolated by mmafm
-    if (MetricsXt *xt = m->find_xt("AFM")) {
-      AfmMetricsXt *afm_xt = (AfmMetricsXt *)xt;
-
-#if HAVE_CTIME
-      time_t cur_time = time(0);
-      char *time_str = ctime(&cur_time);
-      int time_len = strlen(time_str) - 1;
-      char *buf = new char[strlen(VERSION) + time_len + 100];
-      sprintf(buf, "Interpolated by mmafm-%s on %.*s.", VERSION,
-	      time_len, time_str);
-#else
-      char *buf = new char[strlen(VERSION) + 100];
-      sprintf(buf, "Interpolated by mmafm-%s.", VERSION);
-#endif
-
-      afm_xt->opening_comments.push_back(buf);
-      afm_xt->opening_comments.push_back("Mmafm is free software.  See <http://www.lcdf.org/type/>.");
-      delete[] buf;
-    }
-
-    // round numbers if necessary
-    if (precision >= 0)
-      apply_precision(m, precision);
-    if (kern_precision > 0)
-      apply_kern_precision(m, kern_precision);
+    prepare_output(m, precision, kern_precision);
 
     // write the output file
     if (!output_file)
@@ -22,6 +22,8 @@
 #include "t1minimize.hh"
 #include <lcdf/clp.h>
 #include <lcdf/error.hh>
+#include <lcdf/parallel.hh>
+#include <lcdf/slurper.hh>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -54,6 +56,9 @@
 #define PRECISION_OPT	315
 #define SUBRS_OPT	316
 #define MINIMIZE_OPT	317
+#define BATCH_OPT	318
+#define OUTPUT_DIR_OPT	319
+#define JOBS_OPT	320
 
 const Clp_Option options[] = {
   { "1", '1', N1_OPT, Clp_ValDouble, 0 },
@@ -61,10 +66,13 @@ const Clp_Option options[] = {
   { "3", '3', N3_OPT, Clp_ValDouble, 0 },
   { "4", '4', N4_OPT, Clp_ValDouble, 0 },
   { "amcp-info", 0, AMCP_INFO_OPT, 0, 0 },
+  { "batch", 0, BATCH_OPT, Clp_ValString, 0 },
   { "help", 'h', HELP_OPT, 0, 0 },
+  { "jobs", 0, JOBS_OPT, Clp_ValInt, 0 },
   { "minimize", 'm', MINIMIZE_OPT, 0, Clp_Negate },
   { "optical-size", 'O', OPSIZE_OPT, Clp_ValDouble, 0 },
   { "output", 'o', OUTPUT_OPT, Clp_ValString, 0 },
+  { "output-directory", 0, OUTPUT_DIR_OPT, Clp_ValString, 0 },
   { "pfa", 'a', PFA_OPT, 0, 0 },
   { "pfb", 'b', PFB_OPT, 0, 0 },
   { "precision", 'p', PRECISION_OPT, Clp_ValUnsigned, 0 },
@@ -84,6 +92,7 @@ static const char *program_name;
 static ErrorHandler *errh;
 static MyFont *font;
 static MultipleMasterSpace *mmspace;
+static String font_path;	// empty if the font came from stdin
 
 static Vector<PermString> ax_names;
 static Vector<int> ax_nums;
@@ -124,6 +133,9 @@ General options:\n\
   -a, --pfa                    Output PFA font.\n\
   -b, --pfb                    Output PFB font. This is the default.\n\
   -o, --output=FILE            Write output to FILE.\n\
+      --batch=FILE             Interpolate one instance per line of FILE.\n\
+      --output-directory=DIR   Write batch instances to DIR (default .).\n\
+      --jobs=N                 Use up to N threads for --batch.\n\
   -p, --precision=N            Set precision to N (larger means more precise).\n\
       --subrs=N                Limit output font to at most N subroutines.\n\
       --no-minimize            Do not replace original font%,s PostScript code.\n\
@@ -158,6 +170,33 @@ set_design(int a, double v)
   values.push_back(v);
 }
 
+static MyFont *
+read_font(FILE *f, const char *filename, ErrorHandler *errh)
+{
+  Type1Reader *reader;
+  int c = getc(f);
+  ungetc(c, f);
+  if (c == EOF) {
+    errh->error("%s: empty file", filename);
+    return 0;
+  }
+  if (c == 128)
+    reader = new Type1PFBReader(f);
+  else
+    reader = new Type1PFAReader(f);
+
+  MyFont *font = new MyFont(*reader);
+  delete reader;
+  if (!font->ok())
+      errh->error("%s: invalid font", filename);
+  else if (font->nglyphs() == 0)
+      errh->error("%s: font contains no characters", filename);
+  else
+      return font;
+  delete font;
+  return 0;
+}
+
 void
 do_file(const char *filename, PsresDatabase *psres)
 {
@@ -168,8 +207,10 @@ do_file(const char *filename, PsresDatabase *psres)
 #if defined(_MSDOS) || defined(_WIN32)
     _setmode(_fileno(f), _O_BINARY);
 #endif
-  } else
+  } else {
     f = fopen(filename, "rb");
+    font_path = filename;
+  }
 
   if (!f) {
     // check for PostScript or instance name
@@ -186,27 +227,15 @@ do_file(const char *filename, PsresDatabase *psres)
       }
     }
     f = fn.open_read();
+    font_path = fn.path();
   }
 
   if (!f)
     errh->fatal("%s: %s", filename, strerror(errno));
 
-  Type1Reader *reader;
-  int c = getc(f);
-  ungetc(c, f);
-  if (c == EOF)
-    errh->fatal("%s: empty file", filename);
-  if (c == 128)
-    reader = new Type1PFBReader(f);
-  else
-    reader = new Type1PFAReader(f);
-
-  font = new MyFont(*reader);
-  delete reader;
-  if (!font->ok())
-      errh->fatal("%s: invalid font", filename);
-  else if (font->nglyphs() == 0)
-      errh->fatal("%s: font contains no characters", filename);
+  font = read_font(f, filename, errh);
+  if (!font)
+    exit(1);
 
   mmspace = font->create_mmspace(errh);
   if (!mmspace)
@@ -254,10 +283,247 @@ print_amcp_info(MultipleMasterSpace *mmspace, FILE *f)
 }
 
 
+struct InstanceOptions {
+  bool minimize;
+  int precision;
+  int subr_count;
+  bool write_pfb;
+  const Vector<int> *hint_replacement_subrs;
+};
+
+// Interpolate font at design. Returns the font to write, which replaces
+// font when minimizing, or null on error.
+static Type1Font *
+interpolate_instance(MyFont *font, MultipleMasterSpace *mmspace,
+		     const Vector<double> &design,
+		     const InstanceOptions &opt, ErrorHandler *errh)
+{
+  if (!font->set_design_vector(mmspace, design, errh))
+    return 0;
+
+  font->interpolate_dicts(opt.minimize, errh);
+  font->interpolate_charstrings(opt.precision, errh, opt.hint_replacement_subrs);
+
+  if (opt.subr_count >= 0) {
+      Type1SubrRemover sr(font, errh);
+      sr.run(opt.subr_count);
+  }
+
+  font->fill_in_subrs();
+
+  Type1Font *t1font;
+  if (opt.minimize) {
+      t1font = ::minimize(font);
+      delete font;
+  } else
+      t1font = font;
+
+  { // Add an identifying comment.
+#if HAVE_CTIME
+    time_t cur_time = time(0);
+    char *time_str = ctime(&cur_time);
+    int time_len = strlen(time_str) - 1;
+    char *buf = new char[strlen(VERSION) + time_len + 100];
+    sprintf(buf, "%%%% Interpolated by mmpfb-%s on %.*s.", VERSION,
+	    time_len, time_str);
+#else
+    char *buf = new char[strlen(VERSION) + 100];
+    sprintf(buf, "%%%% Interpolated by mmpfb-%s.", VERSION);
+#endif
+
+    t1font->add_header_comment(buf);
+    t1font->add_header_comment("%% Mmpfb is free software.  See <http://www.lcdf.org/type/>.");
+    delete[] buf;
+  }
+
+  return t1font;
+}
+
+static void
+write_instance(Type1Font *t1font, FILE *outfile, bool write_pfb)
+{
+  if (write_pfb) {
+#if defined(_MSDOS) || defined(_WIN32)
+    _setmode(_fileno(outfile), _O_BINARY);
+#endif
+    Type1PFBWriter w(outfile);
+    t1font->write(w);
+  } else {
+    Type1PFAWriter w(outfile);
+    t1font->write(w);
+  }
+}
+
+
+// Read design vectors, one per line, from a batch file. Coordinates are
+// separated by whitespace or commas; axes left off the end of a line take
+// their values from default_design. Blank lines and lines starting with `#'
+// are ignored.
+static void
+read_batch(const char *fn, const Vector<double> &default_design,
+	   Vector<Vector<double> > &designs, Vector<String> &landmarks)
+{
+  Filename filename;
+  FILE *file;
+  if (strcmp(fn, "-") == 0) {
+    filename = Filename("<stdin>");
+    file = stdin;
+  } else {
+    filename = Filename(fn);
+    file = filename.open_read();
+  }
+  if (!file)
+    errh->fatal("%s: %s", fn, strerror(errno));
+
+  Slurper slurper(filename, file);
+  while (char *line = slurper.next_line()) {
+    while (isspace((unsigned char) *line))
+      line++;
+    if (!*line || *line == '#')
+      continue;
+
+    Vector<double> design(default_design);
+    int a = 0;
+    while (*line) {
+      char *end;
+      double x = strtod(line, &end);
+      if (end == line) {
+	errh->lerror(slurper.landmark(), "bad design coordinate");
+	goto next_line;
+      } else if (a >= design.size()) {
+	errh->lerror(slurper.landmark(), "too many design coordinates (this font has %d axes)", design.size());
+	goto next_line;
+      }
+      design[a++] = x;
+      for (line = end; isspace((unsigned char) *line) || *line == ','; line++)
+	/* nada */;
+    }
+
+    for (a = 0; a < design.size(); a++)
+      if (!KNOWN(design[a])) {
+	errh->lerror(slurper.landmark(), "missing %s coordinate", mmspace->axis_type(a).c_str());
+	goto next_line;
+      }
+    designs.push_back(design);
+    landmarks.push_back(slurper.landmark());
+
+  next_line: ;
+  }
+}
+
+// Each batch instance reads its own copy of the font, since interpolation
+// rewrites the font in place.
+class InstanceTask : public ParallelTask { public:
+
+    InstanceTask(const Vector<Vector<double> > &d, const InstanceOptions &o)
+	: designs(d), opt(o) {
+	for (int i = 0; i < designs.size(); ++i)
+	    errhs.push_back(new DeferredErrorHandler);
+    }
+    ~InstanceTask() {
+	for (DeferredErrorHandler **e = errhs.begin(); e != errhs.end(); ++e)
+	    delete *e;
+    }
+
+    void *thread_begin(bool)		{ return 0; }
+    void run(int item, void *);
+    void thread_end(void *)		{ }
+
+    const Vector<Vector<double> > &designs;
+    InstanceOptions opt;
+    const char *font_path;
+    const char *output_directory;
+    Vector<DeferredErrorHandler *> errhs;
+
+};
+
+void
+InstanceTask::run(int item, void *)
+{
+    ErrorHandler *errh = errhs[item];
+    FILE *f = fopen(font_path, "rb");
+    if (!f) {
+	errh->error("%s: %s", font_path, strerror(errno));
+	return;
+    }
+    MyFont *font = read_font(f, font_path, errh);
+    fclose(f);
+    MultipleMasterSpace *mmspace = (font ? font->create_mmspace(errh) : 0);
+    if (!mmspace) {
+	delete font;
+	return;
+    }
+    font->undo_synthetic();
+
+    Type1Font *t1font = interpolate_instance(font, mmspace, designs[item], opt, errh);
+    if (!t1font) {
+	delete font;
+	return;
+    }
+
+    StringAccum sa;
+    sa << output_directory << '/' << t1font->font_name()
+       << (opt.write_pfb ? ".pfb" : ".pfa");
+    FILE *outfile = fopen(sa.c_str(), "wb");
+    if (!outfile)
+	errh->error("%s: %s", sa.c_str(), strerror(errno));
+    else {
+	write_instance(t1font, outfile, opt.write_pfb);
+	if (fclose(outfile) != 0)
+	    errh->error("%s: %s", sa.c_str(), strerror(errno));
+    }
+    delete t1font;
+}
+
+static int
+run_batch(const char *batch_file, const Vector<double> &design,
+	  const char *output_directory, InstanceOptions &opt)
+{
+  if (!font_path.length())
+    errh->fatal("%<--batch%> cannot read the font from standard input");
+
+  Vector<double> default_design = mmspace->default_design_vector();
+  Vector<double> base_design(design);
+  for (int i = 0; i < mmspace->naxes(); i++)
+    if (!KNOWN(base_design[i]))
+      base_design[i] = default_design[i];
+
+  Vector<Vector<double> > designs;
+  Vector<String> landmarks;
+  read_batch(batch_file, base_design, designs, landmarks);
+
+  // Check every design vector before starting.
+  Vector<Vector<double> > good_designs;
+  for (int i = 0; i < designs.size(); i++) {
+    Vector<double> weight;
+    if (mmspace->design_to_weight(designs[i], weight, errh))
+      good_designs.push_back(designs[i]);
+    else
+      errh->lerror(landmarks[i], "can%,t create weight vector");
+  }
+
+  // Hint replacement subroutines usually do not depend on the weight
+  // vector, so find them once for all instances.
+  Vector<int> hint_replacement_subrs;
+  if (Type1MMRemover::find_hint_replacement_subrs(font, mmspace->nmasters(), hint_replacement_subrs))
+    opt.hint_replacement_subrs = &hint_replacement_subrs;
+
+  InstanceTask task(good_designs, opt);
+  task.font_path = font_path.c_str();
+  task.output_directory = output_directory;
+  run_parallel(task, good_designs.size());
+
+  for (int i = 0; i < good_designs.size(); i++)
+    task.errhs[i]->replay(errh);
+  return errh->nerrors() ? 1 : 0;
+}
+
+
 int
 main(int argc, char *argv[])
 {
   PsresDatabase *psres = new PsresDatabase;
+  psres->set_cache_directory(getenv("PSRESOURCECACHE"));
   psres->add_psres_path(getenv("PSRESOURCEPATH"), 0, false);
 
   Clp_Parser *clp =
@@ -270,6 +536,8 @@ main(int argc, char *argv[])
   int precision = 5;
   int subr_count = -1;
   FILE *outfile = 0;
+  const char *batch_file = 0;
+  const char *output_directory = ".";
   ::errh =
       ErrorHandler::static_initialize(new FileErrorHandler(stderr, String(program_name) + ": "));
 
@@ -343,6 +611,21 @@ main(int argc, char *argv[])
 	   errh = new SilentErrorHandler;
        break;
 
+     case BATCH_OPT:
+      if (batch_file) errh->fatal("batch file already specified");
+      batch_file = clp->vstr;
+      break;
+
+     case OUTPUT_DIR_OPT:
+      output_directory = clp->vstr;
+      break;
+
+     case JOBS_OPT:
+      if (clp->val.i < 1)
+	usage_error("bad %<--jobs%> option");
+      parallel_jobs = clp->val.i;
+      break;
+
      case OUTPUT_OPT:
       if (outfile) errh->fatal("output file already specified");
       if (strcmp(clp->vstr, "-") == 0)
@@ -388,6 +671,8 @@ particular purpose.\n");
   }
 
  done:
+  if (batch_file && outfile)
+      usage_error("%<--batch%> and %<--output%> are mutually exclusive");
   if (outfile == 0)
       outfile = stdout;
 
@@ -403,6 +688,16 @@ particular purpose.\n");
     else
       mmspace->set_design(design, ax_nums[i], values[i], errh);
 
+  InstanceOptions opt;
+  opt.minimize = minimize;
+  opt.precision = precision;
+  opt.subr_count = subr_count;
+  opt.write_pfb = write_pfb;
+  opt.hint_replacement_subrs = 0;
+
+  if (batch_file)
+    return run_batch(batch_file, design, output_directory, opt);
+
   Vector<double> default_design = mmspace->default_design_vector();
   for (int i = 0; i < mmspace->naxes(); i++)
     if (!KNOWN(design[i]) && KNOWN(default_design[i])) {
@@ -411,54 +706,10 @@ particular purpose.\n");
       design[i] = default_design[i];
     }
 
-  if (!font->set_design_vector(mmspace, design, errh))
+  Type1Font *t1font = interpolate_instance(font, mmspace, design, opt, errh);
+  if (!t1font)
     exit(1);
 
-  font->interpolate_dicts(minimize, errh);
-  font->interpolate_charstrings(precision, errh);
-
-  if (subr_count >= 0) {
-      Type1SubrRemover sr(font, errh);
-      sr.run(subr_count);
-  }
-
-  font->fill_in_subrs();
-
-  Type1Font *t1font;
-  if (minimize) {
-      t1font = ::minimize(font);
-      delete font;
-  } else
-      t1font = font;
-
-  { // Add an identifying comment.
-#if HAVE_CTIME
-    time_t cur_time = time(0);
-    char *time_str = ctime(&cur_time);
-    int time_len = strlen(time_str) - 1;
-    char *buf = new char[strlen(VERSION) + time_len + 100];
-    sprintf(buf, "%%%% Interpolated by mmpfb-%s on %.*s.", VERSION,
-	    time_len, time_str);
-#else
-    char *buf = new char[strlen(VERSION) + 100];
-    sprintf(buf, "%%%% Interpolated by mmpfb-%s.", VERSION);
-#endif
-
-    t1font->add_header_comment(buf);
-    t1font->add_header_comment("%% Mmpfb is free software.  See <http://www.lcdf.org/type/>.");
-    delete[] buf;
-  }
-
-  if (write_pfb) {
-#if defined(_MSDOS) || defined(_WIN32)
-    _setmode(_fileno(outfile), _O_BINARY);
-#endif
-    Type1PFBWriter w(outfile);
-    t1font->write(w);
-  } else {
-    Type1PFAWriter w(outfile);
-    t1font->write(w);
-  }
-
+  write_instance(t1font, outfile, write_pfb);
   return 0;
 }
@@ -293,8 +293,14 @@ MyFont::interpolate_dicts(bool force_integer, ErrorHandler *errh)
 }
 
 void
-MyFont::interpolate_charstrings(int precision, ErrorHandler *errh)
+MyFont::interpolate_charstrings(int precision, ErrorHandler *errh,
+				const Vector<int> *hint_replacement_subrs)
 {
-    Type1MMRemover remover(this, _weight_vector, precision, errh);
-    remover.run();
+    if (hint_replacement_subrs) {
+	Type1MMRemover remover(this, _weight_vector, precision, *hint_replacement_subrs, errh);
+	remover.run();
+    } else {
+	Type1MMRemover remover(this, _weight_vector, precision, errh);
+	remover.run();
+    }
 }
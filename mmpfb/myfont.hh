@@ -12,7 +12,10 @@ class MyFont : public Efont::Type1Font { public:
     bool set_design_vector(Efont::MultipleMasterSpace *, const Vector<double> &, ErrorHandler * = 0);
 
     void interpolate_dicts(bool force_integers, ErrorHandler *);
-    void interpolate_charstrings(int precision, ErrorHandler * = 0);
+    // If hint_replacement_subrs is nonnull, it must come from
+    // Type1MMRemover::find_hint_replacement_subrs on an identical font.
+    void interpolate_charstrings(int precision, ErrorHandler * = 0,
+				 const Vector<int> *hint_replacement_subrs = 0);
 
   private:
 
@@ -21,19 +21,11 @@
 #include <lcdf/straccum.hh>
 #include <stdio.h>
 #include <math.h>
+#include <limits>
+#include <algorithm>
 
 using namespace Efont;
 
-static bool itc_complained = false;
-static ErrorHandler *itc_errh;
-
-void
-itc_complain()
-{
-    //itc_errh->warning("strange %<callothersubr%>; is this an ITC font?");
-    itc_complained = true;
-}
-
 
 /*****
  * HintReplacementDetector
@@ -46,6 +38,10 @@ class HintReplacementDetector : public CharstringInterp { public:
 
     bool is_hint_replacement(int i) const { return _hint_replacements[i] != 0; }
     int call_count(int i) const		{ return _call_counts[i]; }
+    // True if the detected subroutines might depend on the weight vector.
+    // Only meaningful when the weight vector is unknown (all NaNs), so that
+    // any blended value that steers the interpreter shows up as a NaN.
+    bool weight_sensitive() const	{ return _weight_sensitive; }
 
     bool type1_command(int);
 
@@ -57,20 +53,23 @@ class HintReplacementDetector : public CharstringInterp { public:
     Vector<int> _call_counts;
     int _subr_level;
     int _count_calls_below;
+    bool _weight_sensitive;
+
+    static bool unknown(double d)	{ return d != d; }
 
 };
 
 HintReplacementDetector::HintReplacementDetector(Type1Font *f, int b)
     : CharstringInterp(),
       _hint_replacements(f->nsubrs(), 0), _call_counts(f->nsubrs(), 0),
-      _count_calls_below(b)
+      _count_calls_below(b), _weight_sensitive(false)
 {
 }
 
 HintReplacementDetector::HintReplacementDetector(Type1Font *f, const Vector<double> &wv, int b)
     : CharstringInterp(wv),
       _hint_replacements(f->nsubrs(), 0), _call_counts(f->nsubrs(), 0),
-      _count_calls_below(b)
+      _count_calls_below(b), _weight_sensitive(false)
 {
 }
 
@@ -82,10 +81,18 @@ HintReplacementDetector::type1_command(int cmd)
       case Cs::cCallothersubr: {
 	  if (size() < 2)
 	      goto unknown;
+	  if (unknown(top(0)) || unknown(top(1))) {
+	      _weight_sensitive = true;
+	      return false;
+	  }
 	  int command = (int)top(0);
 	  int n = (int)top(1);
 	  if (command == Cs::othcReplacehints && n == 1) {
 	      pop(2);
+	      if (size() >= 1 && unknown(top())) {
+		  _weight_sensitive = true;
+		  return false;
+	      }
 	      _hint_replacements[(int)top()] = 1;
 	      ps_clear();
 	      ps_push(top());
@@ -96,6 +103,7 @@ HintReplacementDetector::type1_command(int cmd)
 	      return mm_command(command, n);
 	  } else if (command >= Cs::othcITC_load && command <= Cs::othcITC_random) {
 	      pop(2);
+	      _weight_sensitive = true;
 	      return itc_command(command, n);
 	  } else
 	      goto unknown;
@@ -104,6 +112,10 @@ HintReplacementDetector::type1_command(int cmd)
       case Cs::cCallsubr: {
 	  if (size() < 1)
 	      return error(errUnderflow, cmd);
+	  if (unknown(top())) {
+	      _weight_sensitive = true;
+	      return false;
+	  }
 	  int which = (int)pop();
 	  if (!_count_calls_below || _subr_level < _count_calls_below)
 	      _call_counts[which]++;
@@ -126,24 +138,29 @@ HintReplacementDetector::type1_command(int cmd)
 	return CharstringInterp::type1_command(cmd);
 
       case Cs::cBlend:
-      case Cs::cAbs:
-      case Cs::cAdd:
-      case Cs::cSub:
-      case Cs::cDiv:
-      case Cs::cNeg:
       case Cs::cRandom:
-      case Cs::cMul:
       case Cs::cSqrt:
-      case Cs::cDrop:
-      case Cs::cExch:
       case Cs::cIndex:
       case Cs::cRoll:
-      case Cs::cDup:
       case Cs::cAnd:
       case Cs::cOr:
       case Cs::cNot:
       case Cs::cEq:
       case Cs::cIfelse:
+	// These can turn a blended value into a known one, or fail
+	// depending on one.
+	_weight_sensitive = true;
+	return arith_command(cmd);
+
+      case Cs::cAbs:
+      case Cs::cAdd:
+      case Cs::cSub:
+      case Cs::cDiv:
+      case Cs::cNeg:
+      case Cs::cMul:
+      case Cs::cDrop:
+      case Cs::cExch:
+      case Cs::cDup:
 	return arith_command(cmd);
 
       case Cs::cPop:
@@ -365,8 +382,10 @@ Type1OneMMRemover::type1_command(int cmd)
 	  int command = (int)top(0);
 	  int n = (int)top(1);
 	  if (command >= Cs::othcITC_load && command <= Cs::othcITC_random) {
-	      if (!itc_complained)
-		  itc_complain();
+	      if (!_remover->_itc_complained) {
+		  //_remover->_errh->warning("strange %<callothersubr%>; is this an ITC font?");
+		  _remover->_itc_complained = true;
+	      }
 	      if (size() < 2 + n || !itc_command(command, n))
 		  goto partial_othersubr;
 	  } else if (command >= Cs::othcMM1 && command <= Cs::othcMM6) {
@@ -577,10 +596,8 @@ Type1MMRemover::Type1MMRemover(Type1Font *font, const Vector<double> &wv,
       _subr_prefix(_nsubrs, (Type1Charstring *)0),
       _must_expand_subr(_nsubrs, 0),
       _hint_replacement_subr(_nsubrs, 0),
-      _expand_all_subrs(false), _errh(errh)
+      _expand_all_subrs(false), _itc_complained(false), _errh(errh)
 {
-    itc_errh = _errh;
-
     // find subroutines needed for hint replacement
     HintReplacementDetector hr(font, wv, 0);
     for (int i = 0; i < _font->nglyphs(); i++)
@@ -595,6 +612,48 @@ Type1MMRemover::Type1MMRemover(Type1Font *font, const Vector<double> &wv,
 	_subr_done[i] = 1;
 }
 
+Type1MMRemover::Type1MMRemover(Type1Font *font, const Vector<double> &wv,
+			       int precision,
+			       const Vector<int> &hint_replacement_subrs,
+			       ErrorHandler *errh)
+    : _font(font), _weight_vector(wv), _precision(precision),
+      _nsubrs(font->nsubrs()),
+      _subr_done(_nsubrs, 0),
+      _subr_prefix(_nsubrs, (Type1Charstring *)0),
+      _must_expand_subr(_nsubrs, 0),
+      _hint_replacement_subr(hint_replacement_subrs),
+      _expand_all_subrs(false), _itc_complained(false), _errh(errh)
+{
+    assert(_hint_replacement_subr.size() == _nsubrs);
+
+    // don't get rid of first 4 subrs
+    for (int i = 0; i < _nsubrs && i < 4; i++)
+	_subr_done[i] = 1;
+}
+
+bool
+Type1MMRemover::find_hint_replacement_subrs(Type1Font *font, int nmasters,
+					    Vector<int> &result)
+{
+    // Run the detector with unknown weights. If no unknown value decides
+    // which subroutines are called or marked, every weight vector gives
+    // the same answer.
+    Vector<double> unknown_weights(nmasters, std::numeric_limits<double>::quiet_NaN());
+    HintReplacementDetector hr(font, unknown_weights, 0);
+    for (int i = 0; i < font->nglyphs(); i++)
+	if (Type1Subr *g = font->glyph_x(i))
+	    if (!hr.run(font, g->t1cs()) && hr.weight_sensitive())
+		return false;
+    if (hr.weight_sensitive())
+	return false;
+
+    result.assign(font->nsubrs(), 0);
+    for (int i = 0; i < font->nsubrs(); i++)
+	if (hr.is_hint_replacement(i))
+	    result[i] = 1;
+    return true;
+}
+
 Type1MMRemover::~Type1MMRemover()
 {
     for (int i = 0; i < _nsubrs; i++)
@@ -851,16 +910,14 @@ Type1SubrRemover::~Type1SubrRemover()
 {
 }
 
-static Vector<int> *sort_keys;
-
-extern "C" {
-static int CDECL
-sort_permute_compare(const void *v1, const void *v2)
-{
-    const int *i1 = (const int *)v1;
-    const int *i2 = (const int *)v2;
-    return (*sort_keys)[*i1] - (*sort_keys)[*i2];
-}
+namespace {
+struct PermuteCompare {
+    const Vector<int> &keys;
+    PermuteCompare(const Vector<int> &k)	: keys(k) { }
+    bool operator()(int a, int b) const {
+	return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+    }
+};
 }
 
 bool
@@ -882,9 +939,9 @@ Type1SubrRemover::run(int lower_to)
     for (int i = 0; i < _nsubrs; i++)
 	permute.push_back(i);
 
-    // sort them by least frequent use -> most frequent use
-    sort_keys = &_cost;
-    qsort(&permute[0], _nsubrs, sizeof(int), sort_permute_compare);
+    // sort them by least frequent use -> most frequent use, breaking ties
+    // by subroutine number
+    std::sort(permute.begin(), permute.end(), PermuteCompare(_cost));
 
     // mark first portion of `permute' to be removed
     int removed = 0;
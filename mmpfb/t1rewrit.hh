@@ -7,8 +7,16 @@
 class Type1MMRemover { public:
 
     Type1MMRemover(Efont::Type1Font *, const Vector<double> &weight_vec, int, ErrorHandler *);
+    // Use hint replacement subroutines found by find_hint_replacement_subrs.
+    Type1MMRemover(Efont::Type1Font *, const Vector<double> &weight_vec, int,
+		   const Vector<int> &hint_replacement_subrs, ErrorHandler *);
     ~Type1MMRemover();
 
+    // Find the subroutines that glyphs call for hint replacement. Returns
+    // false if the answer might depend on the weight vector.
+    static bool find_hint_replacement_subrs(Efont::Type1Font *, int nmasters,
+					    Vector<int> &);
+
     Efont::CharstringProgram *program() const	{ return _font; }
     const Vector<double> &weight_vector() const { return _weight_vector; }
     int nmasters() const		{ return _weight_vector.size(); }
@@ -31,9 +39,12 @@ class Type1MMRemover { public:
     Vector<int> _must_expand_subr;
     Vector<int> _hint_replacement_subr;
     bool _expand_all_subrs;
+    bool _itc_complained;
 
     ErrorHandler *_errh;
 
+    friend class Type1OneMMRemover;
+
 };
 
 
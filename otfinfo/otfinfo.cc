@@ -22,8 +22,10 @@
 #include <efont/otfos2.hh>
 #include <efont/otfpost.hh>
 #include <efont/cff.hh>
+#include <efont/catalog.hh>
 #include <lcdf/clp.h>
 #include <lcdf/error.hh>
+#include <lcdf/parallel.hh>
 #include <lcdf/straccum.hh>
 #include <stdlib.h>
 #include <string.h>
@@ -36,6 +38,11 @@
 #ifdef HAVE_UNISTD_H
 # include <unistd.h>
 #endif
+#include <sys/types.h>
+#include <sys/stat.h>
+#if HAVE_DIRENT_H
+# include <dirent.h>
+#endif
 #if defined(_MSDOS) || defined(_WIN32)
 # include <fcntl.h>
 # include <io.h>
@@ -48,6 +55,7 @@ using namespace Efont;
 #define QUIET_OPT		303
 #define VERBOSE_OPT		304
 #define SCRIPT_OPT		305
+#define JOBS_OPT		306
 
 #define QUERY_SCRIPTS_OPT	320
 #define QUERY_FEATURES_OPT	321
@@ -60,6 +68,10 @@ using namespace Efont;
 #define INFO_OPT		328
 #define DUMP_TABLE_OPT		329
 #define QUERY_UNICODE_OPT	330
+#define SCAN_OPT		331
+#define CATALOG_OPT		332
+#define HAS_FEATURE_OPT		333
+#define HAS_UNICODE_OPT		334
 
 const Clp_Option options[] = {
     { "script", 0, SCRIPT_OPT, Clp_ValString, 0 },
@@ -77,6 +89,11 @@ const Clp_Option options[] = {
     { "tables", 't', TABLES_OPT, 0, 0 },
     { "dump-table", 'T', DUMP_TABLE_OPT, Clp_ValString, 0 },
     { "unicode", 'u', QUERY_UNICODE_OPT, 0, 0 },
+    { "scan", 0, SCAN_OPT, Clp_ValString, 0 },
+    { "catalog", 0, CATALOG_OPT, Clp_ValString, 0 },
+    { "has-feature", 0, HAS_FEATURE_OPT, Clp_ValString, 0 },
+    { "has-unicode", 0, HAS_UNICODE_OPT, Clp_ValString, 0 },
+    { "jobs", 0, JOBS_OPT, Clp_ValInt, 0 },
     { "help", 'h', HELP_OPT, 0, 0 },
     { "version", 0, VERSION_OPT, 0, 0 },
 };
@@ -126,9 +143,17 @@ Query options:\n\
   -g, --glyphs                 Report font%,s glyph names.\n\
   -t, --tables                 Report font%,s OpenType tables.\n\
   -T, --dump-table NAME        Output font%,s %<NAME%> table.\n\
+      --scan=DIR               Report on every font under DIR as JSON.\n\
+      --catalog=FILE           Report on fonts in catalog FILE as JSON. With\n\
+                               --scan, update FILE from DIR instead.\n\
 \n\
 Other options:\n\
       --script=SCRIPT[.LANG]   Set script used for --features [latn].\n\
+      --jobs=N                 Use up to N threads for --scan.\n\
+      --has-feature=FEAT       With --scan or --catalog, report only fonts\n\
+                               with feature FEAT (for --script, if given).\n\
+      --has-unicode=CODE       With --scan or --catalog, report only fonts\n\
+                               that map hex code point CODE.\n\
   -V, --verbose                Print progress information to standard error.\n\
   -h, --help                   Print this message and exit.\n\
   -q, --quiet                  Do not generate any error messages.\n\
@@ -574,6 +599,225 @@ do_dump_table(const OpenType::Font &otf, OpenType::Tag tag, ErrorHandler *errh)
     }
 }
 
+/*****
+ * --scan and --catalog: report on whole directory trees
+ **/
+
+// Files are read in batches, and each batch's records are printed in order
+// before the next batch starts.
+enum { SCAN_BATCH = 256 };
+
+static Vector<OpenType::Tag> required_features;
+static Vector<uint32_t> required_unicodes;
+static bool script_specified = false;
+
+static void
+collect_scan_files(const String &path, bool top, Vector<String> &files, ErrorHandler *errh)
+{
+    struct stat st;
+    if ((top ? stat(path.c_str(), &st) : lstat(path.c_str(), &st)) < 0) {
+	errh->error("%s: %s", path.c_str(), strerror(errno));
+	return;
+    }
+    if (S_ISREG(st.st_mode)) {
+	files.push_back(path);
+	return;
+    } else if (!S_ISDIR(st.st_mode))
+	return;
+
+#if HAVE_DIRENT_H
+    DIR *dir = opendir(path.c_str());
+    if (!dir) {
+	errh->error("%s: %s", path.c_str(), strerror(errno));
+	return;
+    }
+    Vector<String> entries;
+    while (struct dirent *dirent = readdir(dir)) {
+	const char *name = dirent->d_name;
+	if (name[0] != '.' || (name[1] && (name[1] != '.' || name[2])))
+	    entries.push_back(String(name));
+    }
+    closedir(dir);
+
+    std::sort(entries.begin(), entries.end());
+    String prefix = (path.back() == '/' ? path : path + "/");
+    for (String *e = entries.begin(); e != entries.end(); ++e)
+	collect_scan_files(prefix + *e, false, files, errh);
+#else
+    errh->error("%s: cannot scan directories on this system", path.c_str());
+#endif
+}
+
+static void
+json_string(StringAccum &sa, const String &s)
+{
+    sa << '\"';
+    for (const char *x = s.begin(); x != s.end(); ++x) {
+	unsigned char c = *x;
+	if (c == '\"' || c == '\\')
+	    sa << '\\' << (char) c;
+	else if (c == '\n')
+	    sa << "\\n";
+	else if (c == '\t')
+	    sa << "\\t";
+	else if (c < 32 || c == 127)
+	    sa.snprintf(7, "\\u%04x", c);
+	else
+	    sa << (char) c;
+    }
+    sa << '\"';
+}
+
+static void
+json_strings(StringAccum &sa, const char *key, const Vector<String> &v)
+{
+    sa << ", \"" << key << "\": [";
+    for (const String *s = v.begin(); s != v.end(); ++s) {
+	if (s != v.begin())
+	    sa << ", ";
+	json_string(sa, *s);
+    }
+    sa << ']';
+}
+
+static void
+json_face(StringAccum &sa, const CatalogFile &cfile, const CatalogFace &cf)
+{
+    static const char * const name_keys[] = {
+	"postscript_name", "family", "subfamily", "full_name",
+	"preferred_family", "preferred_subfamily", "version"
+    };
+
+    sa << "{\"file\": ";
+    json_string(sa, cfile.filename);
+    if (cf.face >= 0)
+	sa << ", \"face\": " << cf.face;
+    sa << ", \"outlines\": \"" << CatalogFace::outlines_name(cf.outlines) << '\"';
+    for (int n = 0; n < CatalogFace::NNAMES; ++n)
+	if (cf.names[n]) {
+	    sa << ", \"" << name_keys[n] << "\": ";
+	    json_string(sa, cf.names[n]);
+	}
+
+    Vector<OpenType::Tag> feature_tags;
+    cf.features(feature_tags);
+    Vector<String> features;
+    for (OpenType::Tag *t = feature_tags.begin(); t != feature_tags.end(); ++t)
+	features.push_back(t->text());
+    json_strings(sa, "scripts", cf.scripts);
+    json_strings(sa, "features", features);
+
+    if (cf.design_size) {
+	sa << ", \"optical_size\": {\"design_size\": " << cf.design_size;
+	if (cf.size_subfamily_id) {
+	    sa << ", \"range\": [" << cf.size_range[0] << ", "
+	       << cf.size_range[1] << "], \"subfamily_id\": "
+	       << cf.size_subfamily_id;
+	    if (cf.size_subfamily_name) {
+		sa << ", \"subfamily_name\": ";
+		json_string(sa, cf.size_subfamily_name);
+	    }
+	}
+	sa << '}';
+    } else if (cf.size_range[1])
+	sa << ", \"optical_size\": {\"range\": [" << cf.size_range[0]
+	   << ", " << cf.size_range[1] << "]}";
+
+    if (cf.unicode.count()) {
+	// Unicode coverage is reported as a count and a list of inclusive
+	// code point ranges.
+	Vector<uint32_t> ranges;
+	cf.unicode.ranges(ranges);
+	sa << ", \"unicode\": {\"count\": " << cf.unicode.count()
+	   << ", \"ranges\": [";
+	for (int i = 0; i < ranges.size(); i += 2)
+	    sa << (i ? ", [" : "[") << ranges[i] << ", " << ranges[i + 1] << ']';
+	sa << "]}";
+    }
+    sa << "}\n";
+}
+
+static bool
+face_matches(const CatalogFace &cf)
+{
+    OpenType::Tag feature_script;
+    if (script_specified) {
+	if (!cf.has_script(script, langsys))
+	    return false;
+	feature_script = script;
+    }
+    for (OpenType::Tag *t = required_features.begin(); t != required_features.end(); ++t)
+	if (!cf.has_feature(*t, feature_script))
+	    return false;
+    for (uint32_t *u = required_unicodes.begin(); u != required_unicodes.end(); ++u)
+	if (!cf.unicode.contains(*u))
+	    return false;
+    return true;
+}
+
+static void
+output_catalog(const FontCatalog &catalog, FILE *f)
+{
+    StringAccum sa;
+    for (int i = 0; i < catalog.nfiles(); ++i) {
+	const CatalogFile &cfile = catalog.file(i);
+	for (const CatalogFace *cf = cfile.faces.begin(); cf != cfile.faces.end(); ++cf)
+	    if (face_matches(*cf))
+		json_face(sa, cfile, *cf);
+    }
+    fwrite(sa.data(), 1, sa.length(), f);
+}
+
+static void
+collect_scan_paths(const Vector<const char *> &paths, Vector<String> &files, ErrorHandler *errh)
+{
+    for (const char * const *p = paths.begin(); p != paths.end(); ++p)
+	collect_scan_files(*p, true, files, errh);
+    if (verbose)
+	errh->message("scanning %d files", files.size());
+}
+
+static void
+do_scan(const Vector<const char *> &paths, ErrorHandler *errh)
+{
+    Vector<String> files;
+    collect_scan_paths(paths, files, errh);
+
+    for (int begin = 0; begin < files.size(); begin += SCAN_BATCH) {
+	int end = std::min(begin + SCAN_BATCH, files.size());
+	Vector<String> batch;
+	for (int i = begin; i < end; ++i)
+	    batch.push_back(files[i]);
+	FontCatalog catalog;
+	catalog.refresh(batch, errh);
+	output_catalog(catalog, stdout);
+	fflush(stdout);
+    }
+}
+
+static void
+do_catalog(const String &catalog_file, const Vector<const char *> &paths, ErrorHandler *errh)
+{
+    // When refreshing, a missing or corrupt catalog is rebuilt from scratch.
+    FontCatalog catalog;
+    if (catalog.read(catalog_file, paths.size() ? 0 : errh) < 0
+	&& !paths.size())
+	return;
+
+    if (paths.size()) {
+	Vector<String> files;
+	collect_scan_paths(paths, files, errh);
+	int nread = catalog.refresh(files, errh);
+	if (verbose)
+	    errh->message("%s: %d files, %d read", catalog_file.c_str(), catalog.nfiles(), nread);
+	catalog.write(catalog_file, errh);
+	if (!required_features.size() && !required_unicodes.size() && !script_specified)
+	    return;
+    }
+
+    output_catalog(catalog, stdout);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -583,6 +827,8 @@ main(int argc, char *argv[])
 
     ErrorHandler *errh = ErrorHandler::static_initialize(new FileErrorHandler(stderr, String(program_name) + ": "));
     Vector<const char *> input_files;
+    Vector<const char *> scan_paths;
+    String catalog_file;
     OpenType::Tag dump_table;
     int query = 0;
 
@@ -625,6 +871,47 @@ main(int argc, char *argv[])
 	    query = opt;
 	    break;
 
+	  case SCAN_OPT:
+	    if (query && query != SCAN_OPT && query != CATALOG_OPT)
+		usage_error(errh, "supply exactly one query type option");
+	    scan_paths.push_back(clp->vstr);
+	    if (!query)
+		query = opt;
+	    break;
+
+	  case CATALOG_OPT:
+	    if (query && query != SCAN_OPT)
+		usage_error(errh, "supply exactly one query type option");
+	    catalog_file = clp->vstr;
+	    query = opt;
+	    break;
+
+	  case HAS_FEATURE_OPT: {
+	      OpenType::Tag tag(clp->vstr);
+	      if (!tag.valid())
+		  usage_error(errh, "bad feature tag");
+	      required_features.push_back(tag);
+	      break;
+	  }
+
+	  case HAS_UNICODE_OPT: {
+	      const char *str = clp->vstr;
+	      if ((str[0] == 'U' || str[0] == 'u') && str[1] == '+')
+		  str += 2;
+	      char *end;
+	      unsigned long u = strtoul(str, &end, 16);
+	      if (!*str || *end || u > 0x10FFFF)
+		  usage_error(errh, "bad --has-unicode option");
+	      required_unicodes.push_back(u);
+	      break;
+	  }
+
+	  case JOBS_OPT:
+	    if (clp->val.i < 1)
+		usage_error(errh, "bad --jobs option");
+	    parallel_jobs = clp->val.i;
+	    break;
+
 	case DUMP_TABLE_OPT:
 	    if (query)
 		usage_error(errh, "supply exactly one query type option");
@@ -678,10 +965,24 @@ particular purpose.\n");
   done:
     if (!query)
 	usage_error(errh, "supply exactly one query option");
-    if (!input_files.size())
-	input_files.push_back("-");
+    if ((required_features.size() || required_unicodes.size())
+	&& query != SCAN_OPT && query != CATALOG_OPT)
+	usage_error(errh, "--has-feature and --has-unicode require --scan or --catalog");
+    script_specified = !script.null();
     if (script.null())
 	script = Efont::OpenType::Tag("latn");
+    if (query == SCAN_OPT || query == CATALOG_OPT) {
+	for (const char **p = input_files.begin(); p != input_files.end(); ++p)
+	    scan_paths.push_back(*p);
+	if (query == CATALOG_OPT)
+	    do_catalog(catalog_file, scan_paths, errh);
+	else
+	    do_scan(scan_paths, errh);
+	Clp_DeleteParser(clp);
+	return (errh->nerrors() == 0 ? 0 : 1);
+    }
+    if (!input_files.size())
+	input_files.push_back("-");
 
     FileErrorHandler stdout_errh(stdout);
     for (const char **input_filep = input_files.begin(); input_filep != input_files.end(); input_filep++) {
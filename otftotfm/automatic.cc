@@ -13,8 +13,10 @@
 
 #include <config.h>
 #include "automatic.hh"
+#include "conversion.hh"
 #include "kpseinterface.h"
 #include "util.hh"
+#include "profile.hh"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -32,7 +34,10 @@
 # include <sys/wait.h>
 #endif
 #include <lcdf/error.hh>
+#include <lcdf/filename.hh>
 #include <lcdf/straccum.hh>
+#include <lcdf/vector.hh>
+#include <lcdf/hashmap.hh>
 #if HAVE_FCNTL_H
 # include <fcntl.h>
 #endif
@@ -62,10 +67,9 @@
 enum { T1DOTLESSJ_EXIT_J_NODOT = 2 };
 #endif
 
-static String odir[NUMODIR];
-static String typeface;
-static String vendor;
-static String map_file;
+// Updates to ls-R and the map file are queued in the ConversionContext,
+// then written at once by ConversionContext::commit(). This avoids
+// rewriting the map file, and running updmap, for every font.
 #define DEFAULT_VENDOR "lcdftools"
 #define DEFAULT_TYPEFACE "unknown"
 
@@ -88,8 +92,6 @@ static const struct {
 };
 
 #if HAVE_KPATHSEA
-static String odir_kpathsea[NUMODIR];
-
 static bool writable_texdir_tried = false;
 static String writable_texdir;  // always ends with directory separator
 static int tds_1_1 = -1;
@@ -105,19 +107,92 @@ kpsei_string(char* x)
     return s;
 }
 
+// Memoized kpathsea lookups.  Negative results are remembered too;
+// update_odir() invalidates entries for files we create, and path
+// expansions, which list only existing directories, are forgotten whenever
+// we create a file or directory.
+struct KpathseaLookup {
+    String path;
+    bool valid;
+    KpathseaLookup()                    : valid(false) { }
+};
+static HashMap<String, KpathseaLookup> lookup_cache;
+static HashMap<String, String> expansion_cache;
+static int lookup_count;
+static int search_count;
+static double search_time;
+
+static String
+lookup_key(const String &name, int format)
+{
+    return String((char) ('A' + format)) + name;
+}
+
+String
+find_kpathsea_file(const String &name, int format)
+{
+    lookup_count++;
+    KpathseaLookup &l = lookup_cache.find_force(lookup_key(name, format));
+    if (!l.valid) {
+        ProfilePhase phase(P_KPATHSEA);
+        double t0 = profile_timestamp();
+        l.path = kpsei_string(kpsei_find_file(name.c_str(), format));
+        l.valid = true;
+        search_time += profile_timestamp() - t0;
+        search_count++;
+    }
+    return l.path;
+}
+
+static String
+expand_kpathsea_path(const char *path)
+{
+    String &expansion = expansion_cache.find_force(path);
+    if (!expansion) {
+        ProfilePhase phase(P_KPATHSEA);
+        double t0 = profile_timestamp();
+        // store a leading marker so empty expansions are remembered
+        expansion = "=" + kpsei_string(kpsei_path_expand(path));
+        search_time += profile_timestamp() - t0;
+        search_count++;
+    }
+    return expansion.substring(1);
+}
+
+static void
+forget_kpathsea_file(const String &name)
+{
+    for (int format = KPSEI_FMT_WEB2C; format <= KPSEI_FMT_TYPE42; ++format)
+        if (KpathseaLookup *l = lookup_cache.findp(lookup_key(name, format)))
+            l->valid = false;
+    expansion_cache.clear();
+}
+
+void
+prefetch_kpathsea(bool verbose, ErrorHandler *errh)
+{
+    ProfilePhase phase(P_KPATHSEA);
+    double t0 = profile_timestamp();
+    kpsei_prefetch();
+    if (verbose)
+        errh->message("prefetched kpathsea databases in %.3fs", profile_timestamp() - t0);
+}
+
 static void
 look_for_writable_texdir(const char *path_variable, bool create)
 {
-    String path = kpsei_string(kpsei_path_expand(path_variable));
+    String path = expand_kpathsea_path(path_variable);
     while (path && !writable_texdir) {
         const char* colon = std::find(path.begin(), path.end(), kpsei_env_sep_char);
         String texdir = path.substring(path.begin(), colon);
         path = path.substring(colon + 1, path.end());
         if (access(texdir.c_str(), W_OK) >= 0)
             writable_texdir = texdir;
-        else if (create && errno != EACCES && mkdir(texdir.c_str(), 0777) >= 0)
+        else if (create && errno != EACCES && mkdir(texdir.c_str(), 0777) >= 0) {
             // create file if it doesn't exist already
             writable_texdir = texdir;
+            expansion_cache.clear();
+        }
     }
     if (writable_texdir && writable_texdir.back() != '/')
         writable_texdir += "/";
@@ -144,54 +219,37 @@ find_writable_texdir(ErrorHandler *errh, const char *)
         errh->warning("no writable directory found in $TEXMFVAR or $TEXMF");
         errh->message("(You probably need to set your TEXMF environment variable; see\n\
 the manual for more information. The current TEXMF path is\n\
-%<%s%>.)", kpsei_string(kpsei_path_expand("$TEXMF")).c_str());
+%<%s%>.)", expand_kpathsea_path("$TEXMF").c_str());
     }
     writable_texdir_tried = true;
 }
 
-static String
-get_vendor()
+String
+ConversionContext::get_vendor() const
 {
-    return (vendor ? vendor : String(DEFAULT_VENDOR));
+    return (_opt.vendor ? _opt.vendor : String(DEFAULT_VENDOR));
 }
 
-static String
-get_typeface()
+String
+ConversionContext::get_typeface() const
 {
-    return (typeface ? typeface : String(DEFAULT_TYPEFACE));
+    return (_opt.typeface ? _opt.typeface : String(DEFAULT_TYPEFACE));
 }
 #endif
 
-bool
-set_vendor(const String &s)
-{
-    bool had = (bool) vendor;
-    vendor = s;
-    return !had;
-}
-
-bool
-set_typeface(const String &s, bool override)
-{
-    bool had = (bool) typeface;
-    if (!had || override)
-        typeface = s;
-    return !had;
-}
-
 String
-getodir(int o, ErrorHandler *errh)
+ConversionContext::getodir(int o, ErrorHandler *errh)
 {
     assert(o >= 0 && o < NUMODIR);
 
-    if (!odir[o] && automatic && odir_info[o].envvar)
-        odir[o] = getenv(odir_info[o].envvar);
+    if (!_opt.odir[o] && _opt.automatic && odir_info[o].envvar)
+        _opt.odir[o] = getenv(odir_info[o].envvar);
 
 #if HAVE_KPATHSEA
-    if (!odir[o] && automatic && !writable_texdir_tried)
+    if (!_opt.odir[o] && _opt.automatic && !writable_texdir_tried)
         find_writable_texdir(errh, odir_info[o].name);
 
-    if (!odir[o] && automatic && writable_texdir) {
+    if (!_opt.odir[o] && _opt.automatic && writable_texdir) {
         String suffix = odir_info[o].texdir;
 
         // May need to behave differently on TDS 1.1 rather than TDS 1.0.
@@ -199,9 +257,9 @@ getodir(int o, ErrorHandler *errh)
             // check type of TDS
             if (tds_1_1 < 0) {
                 // using a procedure suggested by Olaf Weber
-                String encfonts = kpsei_string(kpsei_path_expand("$TEXMFMAIN/fonts/enc"));
+                String encfonts = expand_kpathsea_path("$TEXMFMAIN/fonts/enc");
                 if (!encfonts)
-                    encfonts = kpsei_string(kpsei_path_expand("$TEXMFDIST/fonts/enc"));
+                    encfonts = expand_kpathsea_path("$TEXMFDIST/fonts/enc");
                 tds_1_1 = (encfonts != String());
             }
             if (tds_1_1 == 0)
@@ -223,21 +281,22 @@ getodir(int o, ErrorHandler *errh)
             if ((slash = dir.find_left('/', slash + 1)) < 0)
                 slash = dir.length();
             String subdir = dir.substring(0, slash);
-            if (access(subdir.c_str(), F_OK) < 0
-                && !no_create
-                && mkdir(subdir.c_str(), 0777) < 0)
-                goto kpathsea_done;
+            if (access(subdir.c_str(), F_OK) < 0 && !_opt.no_create) {
+                if (mkdir(subdir.c_str(), 0777) < 0)
+                    goto kpathsea_done;
+                expansion_cache.clear();
+            }
         }
 
         // that's our answer
-        odir[o] = dir;
-        odir_kpathsea[o] = dir;
+        _opt.odir[o] = dir;
+        _odir_kpathsea[o] = dir;
     }
   kpathsea_done:
 #endif
 
-    if (!odir[o]) {
-        if (automatic) {
+    if (!_opt.odir[o]) {
+        if (_opt.automatic) {
             errh->warning("%s not specified, placing %s files in %<.%>", odir_info[o].envvar, odir_info[o].name);
 #if !HAVE_KPATHSEA
             static int kpathsea_warning = 0;
@@ -245,22 +304,15 @@ getodir(int o, ErrorHandler *errh)
                 errh->message("(This version of otftotfm lacks $TEXMF directory support.)");
 #endif
         }
-        odir[o] = ".";
+        _opt.odir[o] = ".";
     }
 
-    while (odir[o].length() && odir[o].back() == '/')
-        odir[o] = odir[o].substring(0, -1);
+    while (_opt.odir[o].length() && _opt.odir[o].back() == '/')
+        _opt.odir[o] = _opt.odir[o].substring(0, -1);
 
-    if (verbose)
-        errh->message("placing %s files in %<%s%>", odir_info[o].name, odir[o].c_str());
-    return odir[o];
-}
-
-void
-setodir(int o, const String &value)
-{
-    assert(o >= 0 && o < NUMODIR);
-    odir[o] = value;
+    if (_opt.verbose)
+        errh->message("placing %s files in %<%s%>", odir_info[o].name, _opt.odir[o].c_str());
+    return _opt.odir[o];
 }
 
 const char *
@@ -275,30 +327,30 @@ odirname(int o)
 }
 
 #if HAVE_KPATHSEA
-static bool
-file_in_kpathsea_odir(int o, const String &file)
+bool
+ConversionContext::file_in_kpathsea_odir(int o, const String &file) const
 {
-    return odir_kpathsea[o]
-        && file.length() > odir[o].length()
-        && memcmp(file.data(), odir[o].data(), odir[o].length()) == 0
-        && file[odir[o].length()] == '/';
+    return _odir_kpathsea[o]
+        && file.length() > _opt.odir[o].length()
+        && memcmp(file.data(), _opt.odir[o].data(), _opt.odir[o].length()) == 0
+        && file[_opt.odir[o].length()] == '/';
 }
 #endif
 
 void
-update_odir(int o, String file, ErrorHandler *errh)
+ConversionContext::update_odir(int o, String file, ErrorHandler *errh)
 {
     assert(o >= 0 && o < NUMODIR);
 #if HAVE_KPATHSEA
     if (file.find_left('/') < 0)
-        file = odir[o] + "/" + file;
+        file = _opt.odir[o] + "/" + file;
 
     // exit if this directory was not found via kpathsea, or the file is not
     // in the kpathsea directory
     if (!file_in_kpathsea_odir(o, file))
         return;
 
-    assert(writable_texdir && writable_texdir.length() <= odir[o].length()
+    assert(writable_texdir && writable_texdir.length() <= _opt.odir[o].length()
            && memcmp(file.data(), writable_texdir.data(), writable_texdir.length()) == 0);
 
     // divide the filename into portions
@@ -312,63 +364,25 @@ update_odir(int o, String file, ErrorHandler *errh)
     if (!file)                  // no filename to update
         return;
 
+    // forget any cached lookup of this file
+    forget_kpathsea_file(file);
+
     // return if nocreate
-    if (no_create) {
+    if (_opt.no_create) {
         errh->message("would update %sls-R for %s/%s", writable_texdir.c_str(), directory.c_str(), file.c_str());
         return;
-    } else if (verbose)
-        errh->message("updating %sls-R for %s/%s", writable_texdir.c_str(), directory.c_str(), file.c_str());
-
-    // try to update ls-R ourselves, rather than running mktexupd --
-    // mktexupd's runtime is painful: a half second to update a file
-    String ls_r = writable_texdir + "ls-R";
-    bool success = false;
-    if (access(ls_r.c_str(), R_OK) >= 0) // make sure it already exists
-        if (FILE *f = fopen(ls_r.c_str(), "ab")) {
-            fprintf(f, "./%s:\n%s\n", directory.c_str(), file.c_str());
-            success = true;
-            fclose(f);
-        }
+    } else if (_opt.verbose)
+        errh->message("will update %sls-R for %s/%s", writable_texdir.c_str(), directory.c_str(), file.c_str());
 
-    // otherwise, run mktexupd
-    if (!success && writable_texdir.find_left('\'') < 0 && directory.find_left('\'') < 0 && file.find_left('\'') < 0) {
-        // look for mktexupd script
-        if (!mktexupd_tried) {
-#ifdef _WIN32
-            mktexupd = "mktexupd.exe";
-#else
-            mktexupd = kpsei_string(kpsei_find_file("mktexupd", KPSEI_FMT_WEB2C));
-#endif
-            mktexupd_tried = true;
-        }
-
-        // run script
-        if (mktexupd) {
-            String command = mktexupd + " " + shell_quote(writable_texdir + directory) + " " + shell_quote(file);
-            int retval = system(command.c_str());
-            if (retval == 127)
-                errh->error("could not run %<%s%>", command.c_str());
-            else if (retval < 0)
-                errh->error("could not run %<%s%>: %s", command.c_str(), strerror(errno));
-            else if (retval != 0)
-                errh->error("%<%s%> failed", command.c_str());
-        }
-    }
+    _pending_lsr_directories.push_back(directory);
+    _pending_lsr_files.push_back(file);
 #else
     (void) file, (void) errh;
 #endif
 }
 
-bool
-set_map_file(const String &s)
-{
-    bool had = (bool) map_file;
-    map_file = s;
-    return !had;
-}
-
 String
-installed_type1(const String &otf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *errh)
+ConversionContext::installed_type1(const String &otf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *errh)
 {
     (void) otf_filename, (void) allow_generate, (void) errh;
 
@@ -377,17 +391,17 @@ installed_type1(const String &otf_filename, const String &ps_fontname, bool allo
 
 #if HAVE_KPATHSEA
 # if HAVE_AUTO_CFFTOT1
-    if (!(force && allow_generate && otf_filename && otf_filename != "-" && getodir(O_TYPE1, errh))) {
+    if (!(_opt.force && allow_generate && otf_filename && otf_filename != "-" && getodir(O_TYPE1, errh))) {
 # endif
         // look for .pfb and .pfa
         String file, path;
-        if ((file = ps_fontname + ".pfb", path = kpsei_string(kpsei_find_file(file.c_str(), KPSEI_FMT_TYPE1)))
-            || (file = ps_fontname + ".pfa", path = kpsei_string(kpsei_find_file(file.c_str(), KPSEI_FMT_TYPE1)))) {
+        if ((file = ps_fontname + ".pfb", path = find_kpathsea_file(file, KPSEI_FMT_TYPE1))
+            || (file = ps_fontname + ".pfa", path = find_kpathsea_file(file, KPSEI_FMT_TYPE1))) {
             if (path == "./" + file || path == file) {
-                if (verbose)
+                if (_opt.verbose)
                     errh->message("ignoring Type 1 file %s found with kpathsea in %<.%>", path.c_str());
             } else {
-                if (verbose)
+                if (_opt.verbose)
                     errh->message("Type 1 file %s found with kpathsea at %s", file.c_str(), path.c_str());
                 return path;
             }
@@ -400,9 +414,10 @@ installed_type1(const String &otf_filename, const String &ps_fontname, bool allo
 #if HAVE_AUTO_CFFTOT1
     // if not found, and can generate on the fly, run cfftot1
     if (allow_generate && otf_filename && otf_filename != "-" && getodir(O_TYPE1, errh)) {
-        String pfb_filename = odir[O_TYPE1] + "/" + ps_fontname + ".pfb";
+        String pfb_filename = _opt.odir[O_TYPE1] + "/" + ps_fontname + ".pfb";
         if (pfb_filename.find_left('\'') >= 0 || otf_filename.find_left('\'') >= 0)
             return String();
+        ProfilePhase phase(P_FONTS);
         String command = "cfftot1 " + shell_quote(otf_filename) + " -n " + shell_quote(ps_fontname) + " " + shell_quote(pfb_filename);
         int retval = mysystem(command.c_str(), errh);
         if (retval == 127)
@@ -422,31 +437,31 @@ installed_type1(const String &otf_filename, const String &ps_fontname, bool allo
 }
 
 String
-installed_type1_dotlessj(const String &otf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *errh)
+ConversionContext::installed_type1_dotlessj(const String &otf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *errh)
 {
     (void) otf_filename, (void) allow_generate, (void) errh;
 
     if (!ps_fontname)
         return String();
-    if (verbose)
+    if (_opt.verbose)
         errh->message("searching for dotless-j font for %s", ps_fontname.c_str());
 
     String j_ps_fontname = ps_fontname + "LCDFJ";
 
 #if HAVE_KPATHSEA
 # if HAVE_AUTO_T1DOTLESSJ
-    if (!(force && allow_generate && getodir(O_TYPE1, errh))) {
+    if (!(_opt.force && allow_generate && getodir(O_TYPE1, errh))) {
 # endif
         // look for existing .pfb or .pfa
         String file, path;
-        if ((file = j_ps_fontname + ".pfb", path = kpsei_string(kpsei_find_file(file.c_str(), KPSEI_FMT_TYPE1)))
-            || (file = j_ps_fontname + ".pfa", path = kpsei_string(kpsei_find_file(file.c_str(), KPSEI_FMT_TYPE1)))) {
+        if ((file = j_ps_fontname + ".pfb", path = find_kpathsea_file(file, KPSEI_FMT_TYPE1))
+            || (file = j_ps_fontname + ".pfa", path = find_kpathsea_file(file, KPSEI_FMT_TYPE1))) {
             // ignore versions in the current directory
             if (path == "./" + file || path == file) {
-                if (verbose)
+                if (_opt.verbose)
                     errh->message("ignoring Type 1 file %s found with kpathsea in %<.%>", path.c_str());
             } else {
-                if (verbose)
+                if (_opt.verbose)
                     errh->message("Type 1 file %s found with kpathsea at %s", file.c_str(), path.c_str());
                 return path;
             }
@@ -460,9 +475,10 @@ installed_type1_dotlessj(const String &otf_filename, const String &ps_fontname,
     // if not found, and can generate on the fly, try running t1dotlessj
     if (allow_generate && getodir(O_TYPE1, errh)) {
         if (String base_filename = installed_type1(otf_filename, ps_fontname, allow_generate, errh)) {
-            String pfb_filename = odir[O_TYPE1] + "/" + j_ps_fontname + ".pfb";
+            String pfb_filename = _opt.odir[O_TYPE1] + "/" + j_ps_fontname + ".pfb";
             if (pfb_filename.find_left('\'') >= 0 || base_filename.find_left('\'') >= 0)
                 return String();
+            ProfilePhase phase(P_FONTS);
             String command = "t1dotlessj " + shell_quote(base_filename) + " -n " + shell_quote(j_ps_fontname) + " " + shell_quote(pfb_filename);
             int retval = mysystem(command.c_str(), errh);
             if (retval == 127)
@@ -486,18 +502,18 @@ installed_type1_dotlessj(const String &otf_filename, const String &ps_fontname,
 }
 
 String
-installed_truetype(const String &ttf_filename, bool allow_generate, ErrorHandler *errh)
+ConversionContext::installed_truetype(const String &ttf_filename, bool allow_generate, ErrorHandler *errh)
 {
     String file = pathname_filename(ttf_filename);
 
 #if HAVE_KPATHSEA
-    if (!(force && allow_generate && ttf_filename && ttf_filename != "-" && getodir(O_TRUETYPE, errh))) {
-        if (String path = kpsei_string(kpsei_find_file(file.c_str(), KPSEI_FMT_TRUETYPE))) {
+    if (!(_opt.force && allow_generate && ttf_filename && ttf_filename != "-" && getodir(O_TRUETYPE, errh))) {
+        if (String path = find_kpathsea_file(file, KPSEI_FMT_TRUETYPE)) {
             if (path == "./" + file || path == file) {
-                if (verbose)
+                if (_opt.verbose)
                     errh->message("ignoring TrueType file %s found with kpathsea in %<.%>", path.c_str());
             } else {
-                if (verbose)
+                if (_opt.verbose)
                     errh->message("TrueType file %s found with kpathsea at %s", file.c_str(), path.c_str());
                 return path;
             }
@@ -507,12 +523,13 @@ installed_truetype(const String &ttf_filename, bool allow_generate, ErrorHandler
 
     // perhaps generate type 42 in the future, for now just copy
     if (allow_generate && ttf_filename && ttf_filename != "-" && getodir(O_TRUETYPE, errh)) {
-        String installed_ttf_filename = odir[O_TRUETYPE] + "/" + file;
+        String installed_ttf_filename = _opt.odir[O_TRUETYPE] + "/" + file;
         if (installed_ttf_filename.find_left('\'') >= 0 || installed_ttf_filename.find_left('\"') >= 0)
             return String();
 
         int retval;
         if (!same_filename(ttf_filename, installed_ttf_filename)) {
+            ProfilePhase phase(P_FONTS);
             String command = COPY_CMD " " + shell_quote(ttf_filename) + " " + shell_quote(installed_ttf_filename);
             retval = mysystem(command.c_str(), errh);
             if (retval == 127)
@@ -522,7 +539,7 @@ installed_truetype(const String &ttf_filename, bool allow_generate, ErrorHandler
             else if (retval != 0)
                 errh->error("%<%s%> failed", command.c_str());
         } else {
-            if (verbose)
+            if (_opt.verbose)
                 errh->message("TrueType file %s already located in output directory", installed_ttf_filename.c_str());
             retval = 0;
         }
@@ -537,7 +554,7 @@ installed_truetype(const String &ttf_filename, bool allow_generate, ErrorHandler
 }
 
 String
-installed_type42(const String &ttf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *errh)
+ConversionContext::installed_type42(const String &ttf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *errh)
 {
     (void) allow_generate, (void) ttf_filename, (void) errh;
 
@@ -546,16 +563,16 @@ installed_type42(const String &ttf_filename, const String &ps_fontname, bool all
 
 #if HAVE_KPATHSEA
 # if HAVE_AUTO_TTFTOTYPE42
-    if (!(force && allow_generate && ttf_filename && ttf_filename != "-" && getodir(O_TYPE42, errh))) {
+    if (!(_opt.force && allow_generate && ttf_filename && ttf_filename != "-" && getodir(O_TYPE42, errh))) {
 # endif
         // look for .pfb and .pfa
         String file, path;
-        if ((file = ps_fontname + ".t42", path = kpsei_string(kpsei_find_file(file.c_str(), KPSEI_FMT_TYPE42)))) {
+        if ((file = ps_fontname + ".t42", path = find_kpathsea_file(file, KPSEI_FMT_TYPE42))) {
             if (path == "./" + file || path == file) {
-                if (verbose)
+                if (_opt.verbose)
                     errh->message("ignoring Type 42 file %s found with kpathsea in %<.%>", path.c_str());
             } else {
-                if (verbose)
+                if (_opt.verbose)
                     errh->message("Type 42 file %s found with kpathsea at %s", file.c_str(), path.c_str());
                 return path;
             }
@@ -568,9 +585,10 @@ installed_type42(const String &ttf_filename, const String &ps_fontname, bool all
 #if HAVE_AUTO_TTFTOTYPE42
     // if not found, and can generate on the fly, run ttftotype42
     if (allow_generate && ttf_filename && ttf_filename != "-" && getodir(O_TYPE42, errh)) {
-        String t42_filename = odir[O_TYPE42] + "/" + ps_fontname + ".t42";
+        String t42_filename = _opt.odir[O_TYPE42] + "/" + ps_fontname + ".t42";
         if (t42_filename.find_left('\'') >= 0 || ttf_filename.find_left('\'') >= 0)
             return String();
+        ProfilePhase phase(P_FONTS);
         String command = "ttftotype42 " + shell_quote(ttf_filename) + " " + shell_quote(t42_filename);
         int retval = mysystem(command.c_str(), errh);
         if (retval == 127)
@@ -590,202 +608,355 @@ installed_type42(const String &ttf_filename, const String &ps_fontname, bool all
 }
 
 int
-update_autofont_map(const String &fontname, String mapline, ErrorHandler *errh)
+ConversionContext::update_autofont_map(const String &fontname, String mapline, ErrorHandler *errh)
 {
+    if (_opt.in_memory) {
+        if (mapline)
+            add_output(O_MAP, _opt.map_file, mapline);
+        return 0;
+    }
+
 #if HAVE_KPATHSEA
-    if (automatic && !map_file && getodir(O_MAP, errh))
-        map_file = odir[O_MAP] + "/" + get_vendor() + ".map";
+    if (_opt.automatic && !_opt.map_file && getodir(O_MAP, errh))
+        _opt.map_file = _opt.odir[O_MAP] + "/" + get_vendor() + ".map";
 #endif
 
-    if (map_file == "" || map_file == "-")
+    if (_opt.map_file == "" || _opt.map_file == "-")
         fputs(mapline.c_str(), stdout);
     else {
         // report no_create/verbose
-        if (no_create) {
-            errh->message("would update %s for %s", map_file.c_str(), String(fontname).c_str());
+        if (_opt.no_create) {
+            errh->message("would update %s for %s", _opt.map_file.c_str(), String(fontname).c_str());
             return 0;
-        } else if (verbose)
-            errh->message("updating %s for %s", map_file.c_str(), String(fontname).c_str());
+        } else if (_opt.verbose)
+            errh->message("will update %s for %s", _opt.map_file.c_str(), String(fontname).c_str());
 
-        int fd = open(map_file.c_str(), O_RDWR | O_CREAT, 0666);
-        if (fd < 0)
-            return errh->lerror(map_file, "%s", strerror(errno));
-        FILE *f = fdopen(fd, "r+");
-        // NB: also change encoding logic if you change this code
+        _pending_map_fonts.push_back(fontname);
+        _pending_map_lines.push_back(mapline);
+    }
 
+    return 0;
+}
+
+static bool
+lock_file(int fd)
+{
 #if defined(F_SETLKW) && defined(HAVE_FTRUNCATE)
-        {
-            struct flock lock;
-            lock.l_type = F_WRLCK;
-            lock.l_whence = SEEK_SET;
-            lock.l_start = 0;
-            lock.l_len = 0;
-            int result;
-            while ((result = fcntl(fd, F_SETLKW, &lock)) < 0 && errno == EINTR)
-                /* try again */;
-            if (result < 0) {
-                result = errno;
-                fclose(f);
-                return errh->error("locking %s: %s", map_file.c_str(), strerror(result));
-            }
-        }
+    struct flock lock;
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+    lock.l_start = 0;
+    lock.l_len = 0;
+    int result;
+    while ((result = fcntl(fd, F_SETLKW, &lock)) < 0 && errno == EINTR)
+        /* try again */;
+    return result >= 0;
+#else
+    (void) fd;
+    return true;
 #endif
+}
 
-        // read old data from map file
-        StringAccum sa;
-        int amt;
-        do {
-            if (char *x = sa.reserve(8192)) {
-                amt = fread(x, 1, 8192, f);
-                sa.adjust_length(amt);
-            } else
-                amt = 0;
-        } while (amt != 0);
-        if (!feof(f))
-            return errh->error("%s: %s", map_file.c_str(), strerror(errno));
-        String text = sa.take_string();
-
-        // add comment if necessary
-        bool created = (!text);
-        if (created)
-            text = "% Automatically maintained by otftotfm or other programs. Do not edit.\n\n";
-        if (text.back() != '\n')
-            text += "\n";
-
-        // append old encodings
-        int fl = 0;
-        int nl = text.find_left('\n') + 1;
-        bool changed = created;
-        while (fl < text.length()) {
-            if (fl + fontname.length() + 1 < nl
-                && memcmp(text.data() + fl, fontname.data(), fontname.length()) == 0
-                && text[fl + fontname.length()] == ' ') {
-                // found the old name
-                if (text.substring(fl, nl - fl) == mapline) {
-                    // duplicate of old name, don't change it
-                    fclose(f);
-                    if (verbose)
-                        errh->message("%s unchanged", map_file.c_str());
-                    return 0;
-                } else {
-                    text = text.substring(0, fl) + text.substring(nl);
-                    nl = fl;
-                    changed = true;
-                }
+static bool
+replace_map_line(String &text, const String &fontname, const String &mapline)
+{
+    String new_text = text;
+    int fl = 0;
+    int nl = new_text.find_left('\n') + 1;
+    bool changed = false;
+    while (fl < new_text.length()) {
+        if (fl + fontname.length() + 1 < nl
+            && memcmp(new_text.data() + fl, fontname.data(), fontname.length()) == 0
+            && new_text[fl + fontname.length()] == ' ') {
+            // found the old name
+            if (new_text.substring(fl, nl - fl) == mapline)
+                // duplicate of old name, don't change it
+                return false;
+            else {
+                new_text = new_text.substring(0, fl) + new_text.substring(nl);
+                nl = fl;
+                changed = true;
             }
-            fl = nl;
-            nl = text.find_left('\n', fl) + 1;
         }
+        fl = nl;
+        nl = new_text.find_left('\n', fl) + 1;
+    }
 
-        if (!mapline && !changed) {
-            // special case: empty mapline, unchanged file
-            if (verbose)
-                errh->message("%s unchanged", map_file.c_str());
-        } else {
-            // add our text
-            text += mapline;
+    if (!mapline && !changed)
+        // special case: empty mapline, unchanged file
+        return false;
+    text = new_text + mapline;
+    return true;
+}
+
+int
+ConversionContext::commit_map_file(bool &changed, ErrorHandler *errh)
+{
+    // open and lock the map file; another process may replace it while we
+    // wait for the lock, so check that we locked the current version
+    int fd;
+    FILE *f;
+    while (1) {
+        if ((fd = open(_opt.map_file.c_str(), O_RDWR | O_CREAT, 0666)) < 0)
+            return errh->lerror(_opt.map_file, "%s", strerror(errno));
+        f = fdopen(fd, "r+");
+        if (!lock_file(fd)) {
+            int result = errno;
+            fclose(f);
+            return errh->error("locking %s: %s", _opt.map_file.c_str(), strerror(result));
+        }
+        struct stat fd_st, file_st;
+        if (fstat(fd, &fd_st) < 0 || stat(_opt.map_file.c_str(), &file_st) < 0
+            || (fd_st.st_dev == file_st.st_dev && fd_st.st_ino == file_st.st_ino))
+            break;
+        fclose(f);
+    }
+    // NB: also change encoding logic if you change this code
+
+    // read old data from map file
+    StringAccum sa;
+    int amt;
+    do {
+        if (char *x = sa.reserve(8192)) {
+            amt = fread(x, 1, 8192, f);
+            sa.adjust_length(amt);
+        } else
+            amt = 0;
+    } while (amt != 0);
+    if (!feof(f)) {
+        fclose(f);
+        return errh->error("%s: %s", _opt.map_file.c_str(), strerror(errno));
+    }
+    String text = sa.take_string();
+
+    // add comment if necessary
+    bool created = (!text);
+    if (created)
+        text = "% Automatically maintained by otftotfm or other programs. Do not edit.\n\n";
+    if (text.back() != '\n')
+        text += "\n";
+
+    // apply all queued changes
+    changed = created;
+    for (int i = 0; i < _pending_map_fonts.size(); ++i)
+        if (replace_map_line(text, _pending_map_fonts[i], _pending_map_lines[i]))
+            changed = true;
+
+    if (!changed) {
+        fclose(f);
+        if (_opt.verbose)
+            errh->message("%s unchanged", _opt.map_file.c_str());
+        return 0;
+    }
 
-            // rewind file
+    if (_opt.verbose)
+        errh->message("updating %s", _opt.map_file.c_str());
+
+    // write a new version and rename it into place, so readers never see
+    // a partial file; the new version keeps the old one's permissions
+    profile_count(C_BYTES_WRITTEN, text.length());
+    struct stat st;
+    int mode = (fstat(fd, &st) >= 0 ? (int) (st.st_mode & 07777) : -1);
+    bool written = (replace_file(_opt.map_file, text, mode) == 0);
+
+    // otherwise, rewrite the file in place
+    if (!written) {
 #if HAVE_FTRUNCATE
-            rewind(f);
-            if (ftruncate(fd, 0) < 0)
+        rewind(f);
+        if (ftruncate(fd, 0) < 0)
 #endif
-            {
-                fclose(f);
-                f = fopen(map_file.c_str(), "wb");
-                fd = fileno(f);
-            }
-
-            // write data
-            ignore_result(fwrite(text.data(), 1, text.length(), f));
+        {
+            fclose(f);
+            f = fopen(_opt.map_file.c_str(), "wb");
+            fd = fileno(f);
         }
+        ignore_result(fwrite(text.data(), 1, text.length(), f));
+    }
 
-        fclose(f);
+    fclose(f);
 
-        // inform about the new file if necessary
-        if (created)
-            update_odir(O_MAP, map_file, errh);
-
-#if HAVE_KPATHSEA && !WIN32
-        // run 'updmap' if present
-        String updmap_prog = output_flags & G_UPDMAP_USER ? "updmap-user" : "updmap-sys";
-        String updmap_dir, updmap_file;
-        if (automatic && (output_flags & G_UPDMAP))
-            updmap_dir = getodir(O_MAP_PARENT, errh);
-        if (updmap_dir
-            && (updmap_file = updmap_dir + "/" + updmap_prog)
-            && access(updmap_file.c_str(), X_OK) >= 0) {
-            // want to run `updmap` from its directory, can't use system()
-            if (verbose)
-                errh->message("running %s", updmap_file.c_str());
-
-            pid_t child = fork();
-            if (child < 0)
-                errh->fatal("%s during fork", strerror(errno));
-            else if (child == 0) {
-                // change to updmap directory, run it
-                if (chdir(updmap_dir.c_str()) < 0)
-                    errh->fatal("%s: %s during chdir", updmap_dir.c_str(), strerror(errno));
-                if (execl(output_flags & G_UPDMAP_USER ? "./updmap-user" : "./updmap-sys",
-                          updmap_file.c_str(),
-                          (const char*) 0) < 0)
-                    errh->fatal("%s: %s during exec", updmap_file.c_str(), strerror(errno));
-                exit(1);        // should never get here
-            }
+    // inform about the new file if necessary
+    if (created)
+        update_odir(O_MAP, _opt.map_file, errh);
+    return 0;
+}
 
-# if HAVE_WAITPID
-            // wait for updmap to finish
-            int status;
-            while (1) {
-                pid_t answer = waitpid(child, &status, 0);
-                if (answer >= 0)
-                    break;
-                else if (errno != EINTR)
-                    errh->fatal("%s during wait", strerror(errno));
-            }
-            if (!WIFEXITED(status))
-                errh->warning("%s exited abnormally", updmap_file.c_str());
-            else if (WEXITSTATUS(status) != 0)
-                errh->warning("%s exited with status %d", updmap_file.c_str(), WEXITSTATUS(status));
+#if HAVE_KPATHSEA
+void
+ConversionContext::commit_ls_r(ErrorHandler *errh)
+{
+    // try to update ls-R ourselves, rather than running mktexupd --
+    // mktexupd's runtime is painful: a half second to update a file
+    String ls_r = writable_texdir + "ls-R";
+    StringAccum sa;
+    for (int i = 0; i < _pending_lsr_files.size(); ++i)
+        sa << "./" << _pending_lsr_directories[i] << ":\n" << _pending_lsr_files[i] << "\n";
+    if (access(ls_r.c_str(), R_OK) >= 0) { // make sure it already exists
+        int fd = open(ls_r.c_str(), O_WRONLY | O_APPEND);
+        if (fd >= 0 && lock_file(fd)) {
+            if (_opt.verbose)
+                errh->message("updating %s", ls_r.c_str());
+            bool ok = (write(fd, sa.data(), sa.length()) == (ssize_t) sa.length());
+            close(fd);
+            profile_count(C_BYTES_WRITTEN, sa.length());
+            if (ok)
+                return;
+        } else if (fd >= 0)
+            close(fd);
+    }
+
+    // otherwise, run mktexupd
+    if (!mktexupd_tried) {
+# ifdef _WIN32
+        mktexupd = "mktexupd.exe";
 # else
-#  error "need waitpid() support: report this bug to the maintainer"
+        mktexupd = find_kpathsea_file("mktexupd", KPSEI_FMT_WEB2C);
 # endif
-            goto ran_updmap;
+        mktexupd_tried = true;
+    }
+    if (!mktexupd || writable_texdir.find_left('\'') >= 0)
+        return;
+    for (int i = 0; i < _pending_lsr_files.size(); ++i) {
+        const String &directory = _pending_lsr_directories[i];
+        const String &file = _pending_lsr_files[i];
+        if (directory.find_left('\'') >= 0 || file.find_left('\'') >= 0)
+            continue;
+        String command = mktexupd + " " + shell_quote(writable_texdir + directory) + " " + shell_quote(file);
+        profile_count(C_SUBPROCESSES);
+        int retval = system(command.c_str());
+        if (retval == 127)
+            errh->error("could not run %<%s%>", command.c_str());
+        else if (retval < 0)
+            errh->error("could not run %<%s%>: %s", command.c_str(), strerror(errno));
+        else if (retval != 0)
+            errh->error("%<%s%> failed", command.c_str());
+    }
+}
+
+void
+ConversionContext::run_updmap(ErrorHandler *errh)
+{
+# if !WIN32
+    ProfilePhase phase(P_UPDMAP);
+
+    // run 'updmap' if present
+    String updmap_prog = _opt.output_flags & G_UPDMAP_USER ? "updmap-user" : "updmap-sys";
+    String updmap_dir, updmap_file;
+    if (_opt.automatic && (_opt.output_flags & G_UPDMAP))
+        updmap_dir = getodir(O_MAP_PARENT, errh);
+    if (updmap_dir
+        && (updmap_file = updmap_dir + "/" + updmap_prog)
+        && access(updmap_file.c_str(), X_OK) >= 0) {
+        // want to run `updmap` from its directory, can't use system()
+        if (_opt.verbose)
+            errh->message("running %s", updmap_file.c_str());
+
+        profile_count(C_SUBPROCESSES);
+        pid_t child = fork();
+        if (child < 0) {
+            errh->error("%s during fork", strerror(errno));
+            return;
+        } else if (child == 0) {
+            // change to updmap directory, run it
+            if (chdir(updmap_dir.c_str()) < 0)
+                errh->error("%s: %s during chdir", updmap_dir.c_str(), strerror(errno));
+            else if (execl(_opt.output_flags & G_UPDMAP_USER ? "./updmap-user" : "./updmap-sys",
+                           updmap_file.c_str(),
+                           (const char*) 0) < 0)
+                errh->error("%s: %s during exec", updmap_file.c_str(), strerror(errno));
+            _exit(1);
         }
 
-# if HAVE_AUTO_UPDMAP
-        // run system updmap
-        if (output_flags & G_UPDMAP) {
-            String filename = map_file;
-            int slash = filename.find_right('/');
-            if (slash >= 0)
-                filename = filename.substring(slash + 1);
-            String redirect = verbose ? " 1>&2" : " >" DEV_NULL " 2>&1";
-            String command = updmap_prog + " --nomkmap --enable Map " + shell_quote(filename) + redirect
-                + CMD_SEP " " + updmap_prog + redirect;
-            int retval = mysystem(command.c_str(), errh);
-            if (retval == 127)
-                errh->warning("could not run %<%s%>", command.c_str());
-            else if (retval < 0)
-                errh->warning("could not run %<%s%>: %s", command.c_str(), strerror(errno));
-            else if (retval != 0)
-                errh->warning("%<%s%> exited with status %d;\nrun it manually to check for errors", command.c_str(), WEXITSTATUS(retval));
-            goto ran_updmap;
+#  if HAVE_WAITPID
+        // wait for updmap to finish
+        int status;
+        while (1) {
+            pid_t answer = waitpid(child, &status, 0);
+            if (answer >= 0)
+                break;
+            else if (errno != EINTR) {
+                errh->error("%s during wait", strerror(errno));
+                return;
+            }
         }
-# endif
+        if (!WIFEXITED(status))
+            errh->warning("%s exited abnormally", updmap_file.c_str());
+        else if (WEXITSTATUS(status) != 0)
+            errh->warning("%s exited with status %d", updmap_file.c_str(), WEXITSTATUS(status));
+#  else
+#   error "need waitpid() support: report this bug to the maintainer"
+#  endif
+        return;
+    }
 
-        if (verbose)
-            errh->message("not running updmap");
+#  if HAVE_AUTO_UPDMAP
+    // run system updmap
+    if (_opt.output_flags & G_UPDMAP) {
+        String filename = _opt.map_file;
+        int slash = filename.find_right('/');
+        if (slash >= 0)
+            filename = filename.substring(slash + 1);
+        String redirect = _opt.verbose ? " 1>&2" : " >" DEV_NULL " 2>&1";
+        String command = updmap_prog + " --nomkmap --enable Map " + shell_quote(filename) + redirect
+            + CMD_SEP " " + updmap_prog + redirect;
+        int retval = mysystem(command.c_str(), errh);
+        if (retval == 127)
+            errh->warning("could not run %<%s%>", command.c_str());
+        else if (retval < 0)
+            errh->warning("could not run %<%s%>: %s", command.c_str(), strerror(errno));
+        else if (retval != 0)
+            errh->warning("%<%s%> exited with status %d;\nrun it manually to check for errors", command.c_str(), WEXITSTATUS(retval));
+        return;
+    }
+#  endif
 
-      ran_updmap: ;
+    if (_opt.verbose)
+        errh->message("not running updmap");
+# else
+    (void) errh;
+# endif
+}
+#endif
+
+void
+report_automatic_statistics(ErrorHandler *errh)
+{
+#if HAVE_KPATHSEA
+    if (lookup_count || search_count)
+        errh->message("kpathsea: %d lookups, %d searches, %.3fs searching", lookup_count, search_count, search_time);
+#else
+    (void) errh;
 #endif
+}
+
+void
+ConversionContext::commit(ErrorHandler *errh)
+{
+    ProfilePhase phase(P_MAP);
+    bool map_changed = false;
+    if (_pending_map_fonts.size()) {
+        commit_map_file(map_changed, errh);
+        _pending_map_fonts.clear();
+        _pending_map_lines.clear();
     }
 
-    return 0;
+#if HAVE_KPATHSEA
+    // commit_map_file() may have queued an ls-R entry for a new map file
+    if (_pending_lsr_files.size()) {
+        commit_ls_r(errh);
+        _pending_lsr_directories.clear();
+        _pending_lsr_files.clear();
+    }
+
+    if (map_changed)
+        run_updmap(errh);
+#else
+    (void) map_changed;
+#endif
 }
 
 String
-locate_encoding(String encfile, ErrorHandler *errh, bool literal)
+locate_encoding(String encfile, bool verbose, ErrorHandler *errh, bool literal)
 {
     if (!encfile || encfile == "-")
         return encfile;
@@ -794,12 +965,12 @@ locate_encoding(String encfile, ErrorHandler *errh, bool literal)
         int slash = encfile.find_right('/');
         int dot = encfile.find_left('.', slash >= 0 ? slash : 0);
         if (dot < 0)
-            if (String file = locate_encoding(encfile + ".enc", errh, true))
+            if (String file = locate_encoding(encfile + ".enc", verbose, errh, true))
                 return file;
     }
 
 #if HAVE_KPATHSEA
-    if (String file = kpsei_string(kpsei_find_file(encfile.c_str(), KPSEI_FMT_ENCODING))) {
+    if (String file = find_kpathsea_file(encfile, KPSEI_FMT_ENCODING)) {
         if (verbose)
             errh->message("encoding file %s found with kpathsea at %s", encfile.c_str(), file.c_str());
         return file;
@@ -0,0 +1,1949 @@
+/* conversion.{cc,hh} -- convert an OpenType font to TeX metrics
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#ifdef WIN32
+# define _USE_MATH_DEFINES
+# include <io.h>
+#endif
+#include <efont/otfgsub.hh>
+#include <efont/otfgpos.hh>
+#include <efont/otflayout.hh>
+#include <efont/otfname.hh>
+#include <efont/ttfkern.hh>
+#include <efont/t1bounds.hh>
+#include <efont/cff.hh>
+#include <efont/t1item.hh>
+#include "conversion.hh"
+#include "glyphfilter.hh"
+#include "metrics.hh"
+#include "secondary.hh"
+#include "util.hh"
+#include "profile.hh"
+#include "otftotfm.hh"
+#include "daemon.hh"
+#include "kpseinterface.h"
+#include <lcdf/md5.h>
+#include <lcdf/parallel.hh>
+#include <lcdf/error.hh>
+#include <lcdf/filename.hh>
+#include <lcdf/straccum.hh>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <errno.h>
+#include <algorithm>
+#include <math.h>
+/* M_PI isn't defined in C99 */
+#ifndef M_PI
+# define M_PI 3.14159265358979323846264338327
+#endif
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+#ifdef HAVE_FCNTL_H
+# include <fcntl.h>
+#endif
+
+using namespace Efont;
+
+ConversionOptions::ConversionOptions()
+    : feature_filters(0), altselector_feature_filters(0),
+      literal_encoding(false), warn_no_encoding(true),
+      no_encoding_commands(false), default_ligkern(true), warn_missing(-1),
+      extend(0), slant(0), letterspace(0), design_size(0),
+      minimum_kern(2.0), space_factor(1.0), math_spacing(false),
+      skew_char(-1), override_is_fixed_pitch(false), is_fixed_pitch(false),
+      override_italic_angle(false), italic_angle(0),
+      override_x_height(FontInfo::x_height_auto), x_height(0),
+      output_flags(G_ENCODING | G_METRICS | G_VMETRICS | G_PSFONTSMAP | G_TYPE1 | G_DOTLESSJ | G_UPDMAP | G_TRUETYPE),
+      automatic(false), verbose(false), no_create(false), force(false),
+      in_memory(false)
+{
+}
+
+ConversionContext::ConversionContext(const ConversionOptions &opt)
+    : _opt(opt), _out_encoding_file(opt.out_encoding_file)
+{
+    if (!_opt.interesting_scripts.size()) {
+        _opt.interesting_scripts.push_back(OpenType::Tag("latn"));
+        _opt.interesting_scripts.push_back(OpenType::Tag());
+    }
+    std::sort(_opt.interesting_features.begin(), _opt.interesting_features.end());
+    std::sort(_opt.altselector_features.begin(), _opt.altselector_features.end());
+    if (_opt.in_memory) {
+        _opt.automatic = false;
+        _opt.output_flags &= ~(G_TYPE1 | G_DOTLESSJ | G_UPDMAP | G_TRUETYPE | G_TYPE42);
+    }
+}
+
+
+void
+load_glyphlists(Vector<String> &filenames, bool verbose, ErrorHandler *errh)
+{
+    // find glyphlist
+    if (!filenames.size()) {
+#if HAVE_KPATHSEA
+        if (String g = find_kpathsea_file("glyphlist.txt", KPSEI_FMT_MAP)) {
+            filenames.push_back(g);
+            if (verbose)
+                errh->message("glyphlist.txt found with kpathsea at %s", g.c_str());
+        } else
+#endif
+            filenames.push_back(GLYPHLISTDIR "/glyphlist.txt");
+#if HAVE_KPATHSEA
+        if (String g = find_kpathsea_file("texglyphlist.txt", KPSEI_FMT_MAP)) {
+            filenames.push_back(g);
+            if (verbose)
+                errh->message("texglyphlist.txt found with kpathsea at %s", g.c_str());
+        } else
+#endif
+            filenames.push_back(GLYPHLISTDIR "/texglyphlist.txt");
+    }
+#if !HAVE_KPATHSEA
+    (void) verbose;
+#endif
+
+    // read glyphlist, unless the daemon already has
+    if (!daemon_glyphlists_loaded(filenames))
+        for (String *g = filenames.begin(); g < filenames.end(); g++)
+            if (String s = read_file(*g, errh, true))
+                DvipsEncoding::add_glyphlist(s);
+}
+
+void
+read_base_encodings(const String &filename, ConversionOptions &copt, ErrorHandler *errh)
+{
+    String str = read_file(filename, errh, true);
+    String print_filename = (filename == "-" ? "<stdin>" : filename) + ":";
+    int lineno = 1;
+    str.c_str();
+    const char *s_end = str.end();
+    for (const char *s = str.begin(); s != s_end; ) {
+        while (s != s_end && isspace((unsigned char) *s) && *s != '\n' && *s != '\r')
+            s++;
+        // skip comments and blank lines
+        if (s != s_end && *s != '%' && *s != '#' && *s != '\n' && *s != '\r') {
+            const char *w1 = s;
+            while (s != s_end && !isspace((unsigned char) *s))
+                s++;
+            BaseEncoding *be = new BaseEncoding;
+            be->font_name = str.substring(w1, s);
+            while (s != s_end && isspace((unsigned char) *s) && *s != '\n' && *s != '\r')
+                s++;
+            const char *w2 = s;
+            while (s != s_end && !isspace((unsigned char) *s))
+                s++;
+            String efile = str.substring(w2, s);
+            while (s != s_end && isspace((unsigned char) *s) && *s != '\n' && *s != '\r')
+                s++;
+            if (s != s_end && !isspace((unsigned char) *s) && *s != '%' && *s != '#') {
+                const char *w3 = s;
+                while (s != s_end && !isspace((unsigned char) *s))
+                    s++;
+                be->secondary = str.substring(w3, s);
+            }
+            LandmarkErrorHandler lerrh(errh, print_filename + String(lineno));
+            int before = lerrh.nerrors();
+            if (be->secondary)
+                /* encoding ignored */;
+            else if (!efile)
+                lerrh.error("missing encoding name");
+            else if (String path = locate_encoding(efile, copt.verbose, errh))
+                be->encoding.parse(path, true, true, &lerrh);
+            else
+                lerrh.error("encoding %<%s%> not found", efile.c_str());
+            if (lerrh.nerrors() == before)
+                copt.base_encodings.push_back(be);
+            else
+                delete be;
+        }
+        while (s != s_end && *s != '\n' && *s != '\r')
+            s++;
+        if (s != s_end && *s == '\r')
+            s++;
+        if (s != s_end && *s == '\n')
+            s++;
+        lineno++;
+    }
+}
+
+void
+ConversionContext::add_output(int kind, const String &filename, const String &data)
+{
+    ConversionOutput o;
+    o.kind = kind;
+    o.filename = filename;
+    o.data = data;
+    _outputs.push_back(o);
+}
+
+static String
+read_stream(FILE *f)
+{
+    StringAccum sa;
+    int amt;
+    do {
+        if (char *x = sa.reserve(8192)) {
+            amt = fread(x, 1, 8192, f);
+            sa.adjust_length(amt);
+        } else
+            amt = 0;
+    } while (amt != 0);
+    return sa.take_string();
+}
+
+int
+ConversionContext::mysystem(const char *command, ErrorHandler *errh)
+{
+    if (_opt.no_create) {
+        errh->message("would run %s", command);
+        return 0;
+    } else {
+        if (_opt.verbose)
+            errh->message("running %s", command);
+        profile_count(C_SUBPROCESSES);
+        return system(command);
+    }
+}
+
+FILE*
+ConversionContext::mypopen(const char* command, const char* type, ErrorHandler* errh)
+{
+    if (_opt.no_create) {
+        errh->message("would run %s", command);
+        return popen("true", type);
+    } else {
+        if (_opt.verbose)
+            errh->message("running %s", command);
+        profile_count(C_SUBPROCESSES);
+        return popen(command, type);
+    }
+}
+
+#if !HAVE_MKSTEMP
+static const char *
+my_tmpnam()
+{
+# ifndef WIN32
+    return tmpnam(0);
+# else
+    const char *dir = getenv("TEMP");
+    return _tempnam(dir ? dir : ".", "otftmp.");
+# endif
+}
+#endif
+
+int
+ConversionContext::temporary_file(String &filename, ErrorHandler *errh)
+{
+    if (_opt.no_create)
+        return 0;               // random number suffices
+
+#if HAVE_MKSTEMP
+    const char *tmpdir = getenv("TMPDIR");
+    if (tmpdir)
+        filename = String(tmpdir) + "/otftotfm.XXXXXX";
+    else {
+# ifdef P_tmpdir
+        filename = P_tmpdir "/otftotfm.XXXXXX";
+# else
+        filename = "/tmp/otftotfm.XXXXXX";
+# endif
+    }
+    int fd = mkstemp(filename.mutable_c_str());
+    if (fd < 0)
+        errh->error("temporary file %<%s%>: %s", filename.c_str(), strerror(errno));
+    return fd;
+#else  // !HAVE_MKSTEMP
+    for (int tries = 0; tries < 5; tries++) {
+        if (!(filename = my_tmpnam()))
+            return errh->error("cannot create temporary file");
+# ifdef O_EXCL
+        int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_EXCL | O_TRUNC, 0600);
+# else
+        int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+# endif
+        if (fd >= 0)
+            return fd;
+    }
+    return errh->error("temporary file %<%s%>: %s", filename.c_str(), strerror(errno));
+#endif
+}
+
+
+String
+suffix_font_name(const String &font_name, const String &suffix)
+{
+    const char *begin = font_name.begin(), *end = font_name.end();
+    while (end > begin && isdigit((unsigned char) end[-1]))
+        --end;
+    if (end < font_name.end() && end > begin && end[-1] != '-' && end[-1] != '+')
+        end = font_name.end();
+    else
+        while (end > begin && (end[-1] == '-' || end[-1] == '+'))
+            --end;
+    if (end == begin)
+        end = font_name.end();
+    return font_name.substring(begin, end) + suffix + font_name.substring(end, font_name.end());
+}
+
+static inline String
+make_base_font_name(const String &font_name)
+{
+    return suffix_font_name(font_name, "--base");
+}
+
+double
+ConversionContext::get_design_size(const FontInfo &finfo) const
+{
+    try {
+        String gpos_table = finfo.otf->table("GPOS");
+        if (!gpos_table)
+            throw OpenType::Error();
+
+        ErrorHandler *errh = ErrorHandler::silent_handler();
+        OpenType::Gpos gpos(gpos_table, errh);
+
+        // extract 'size' feature(s)
+        int required_fid;
+        Vector<int> fids;
+        for (const OpenType::Tag *t = _opt.interesting_scripts.begin(); t < _opt.interesting_scripts.end(); t += 2)
+            gpos.script_list().features(t[0], t[1], required_fid, fids, 0, false);
+
+        int size_fid = gpos.feature_list().find(OpenType::Tag("size"), fids);
+        if (size_fid < 0)
+            throw OpenType::Error();
+
+        // old Adobe fonts implement an old, incorrect idea
+        // of what the FeatureParams offset means.
+        OpenType::Name name(finfo.otf->table("name"), errh);
+        OpenType::Data size_data = gpos.feature_list().size_params(size_fid, name, errh);
+        if (!size_data.length())
+            throw OpenType::Error();
+
+        double result = size_data.u16(0) / 10.;
+        // check for insane design sizes
+        if (result < 1 || result > 1000)
+            throw OpenType::Error();
+
+        // return a number in 'pt', not 'bp'
+        return result * 72.27 / 72.;
+
+    } catch (OpenType::Error) {
+        return 10.0;
+    }
+}
+
+static const char * const digit_names[] = {
+    "zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine"
+};
+
+static inline const char *
+lig_context_str(int ctx)
+{
+    return (ctx == 0 ? "LIG" : (ctx < 0 ? "/LIG" : "LIG/"));
+}
+
+namespace {
+struct Printer {
+    Printer(FILE* f, unsigned design_units, unsigned units_per_em)
+        : f_(f), du_((double) design_units / units_per_em),
+          round_(design_units == 1000), max_printed_real_(0) {
+    }
+    inline double transform(double value) const;
+    void print_transformed(const char* prefix, double value) const;
+    void print(const char* prefix, double value) const;
+    String render(double value) const;
+    FILE* f_;
+    double du_;
+    bool round_;
+    mutable double max_printed_real_;
+};
+
+inline double Printer::transform(double value) const {
+    value *= du_;
+    if (round_)
+        value = ceil(value);
+    return value;
+}
+
+void Printer::print_transformed(const char* prefix, double value) const {
+    if (round_ || value == 0 || (value > 0.01 && value - floor(value) < 0.01))
+        fprintf(f_, "%s R %g)\n", prefix, value);
+    else
+        fprintf(f_, "%s R %.4f)\n", prefix, value);
+    max_printed_real_ = std::max(max_printed_real_, fabs(value));
+}
+
+void Printer::print(const char* prefix, double value) const {
+    print_transformed(prefix, transform(value));
+}
+
+String Printer::render(double value) const {
+    value = transform(value);
+    if (round_ || value == 0 || (value > 0.01 && value - floor(value) < 0.01))
+        return String(value);
+    else {
+        char buf[128];
+        sprintf(buf, "%.4f", value);
+        return String(buf);
+    }
+}
+} // namespace
+
+double
+ConversionContext::font_slant(const FontInfo &finfo) const
+{
+    double val = finfo.italic_angle();
+    return -tan(val * M_PI / 180.0) + _opt.slant;
+}
+
+int
+ConversionContext::output_pl(Metrics &metrics, const String &ps_name, int boundary_char,
+          const FontInfo &finfo, bool vpl,
+          const String &filename, ErrorHandler *errh)
+{
+    ProfilePhase phase(P_PL);
+
+    // create file
+    if (_opt.no_create) {
+        errh->message("would create %s", filename.c_str());
+        return 0;
+    }
+
+    if (_opt.verbose)
+        errh->message("creating %s", filename.c_str());
+    FILE *f = (_opt.in_memory ? tmpfile() : fopen(filename.c_str(), "wb"));
+    if (!f) {
+        errh->error("%s: %s", filename.c_str(), strerror(errno));
+        return -1;
+    }
+
+    // XXX check DESIGNSIZE and DESIGNUNITS for correctness
+
+    fprintf(f, "(COMMENT Created by '%s'%s)\n", _opt.invocation.c_str(), _opt.current_time.c_str());
+
+    // calculate a TeX FAMILY name using afm2tfm's algorithm
+    String family_name = String("TeX-") + ps_name;
+    if (family_name.length() > 19)
+        family_name = family_name.substring(0, 9) + family_name.substring(-10);
+    fprintf(f, "(FAMILY %s)\n", family_name.c_str());
+
+    if (metrics.coding_scheme())
+        fprintf(f, "(CODINGSCHEME %.39s)\n", String(metrics.coding_scheme()).c_str());
+    int design_units = metrics.design_units();
+
+    if (_opt.design_size <= 0)
+        _opt.design_size = get_design_size(finfo);
+
+    fprintf(f, "(DESIGNSIZE R %.1f)\n"
+            "(DESIGNUNITS R %d.0)\n"
+            "(COMMENT DESIGNSIZE (1 em) IS IN POINTS)\n"
+            "(COMMENT OTHER DIMENSIONS ARE MULTIPLES OF DESIGNSIZE/%d)\n"
+            "(FONTDIMEN\n", _opt.design_size, design_units, design_units);
+
+    // figure out font dimensions
+    Transform font_xform;
+    if (_opt.extend)
+        font_xform.scale(_opt.extend, 1);
+    if (_opt.slant)
+        font_xform.shear(_opt.slant);
+    double bounds[4], width;
+    Printer pr(f, design_units, metrics.units_per_em());
+
+    double actual_slant = font_slant(finfo);
+    if (actual_slant)
+        fprintf(f, "   (SLANT R %g)\n", actual_slant);
+
+    if (char_bounds(bounds, width, finfo, font_xform, ' ')) {
+        // advance space width by letterspacing, scale by space_factor
+        double space_width = (width + (vpl ? _opt.letterspace : 0)) * _opt.space_factor;
+        pr.print("   (SPACE", space_width);
+        if (finfo.is_fixed_pitch()) {
+            // fixed-pitch: no space stretch or shrink
+            pr.print("   (STRETCH", 0);
+            pr.print("   (SHRINK", 0);
+            pr.print("   (EXTRASPACE", space_width);
+        } else {
+            pr.print("   (STRETCH", space_width / 2.);
+            pr.print("   (SHRINK", space_width / 3.);
+            pr.print("   (EXTRASPACE", space_width / 6.);
+        }
+    }
+
+    double x_height = finfo.x_height(font_xform);
+    if (x_height < finfo.units_per_em())
+        pr.print("   (XHEIGHT", x_height);
+
+    pr.print("   (QUAD", finfo.units_per_em());
+    fprintf(f, "   )\n");
+
+    if (boundary_char >= 0)
+        fprintf(f, "(BOUNDARYCHAR D %d)\n", boundary_char);
+
+    // figure out font mapping
+    int mapped_font0 = 0;
+    Vector<int> font_mapping;
+    if (vpl) {
+        int vpl_first_font = (metrics.need_base() ? 0 : 1);
+        font_mapping.assign(metrics.n_mapped_fonts(), 0);
+        if (vpl_first_font == 1 && font_mapping.size() == 1)
+            font_mapping.push_back(0);
+        // how many times is each font used?
+        Vector<Setting> settings;
+        for (int i = 0; i < 256; i++)
+            if (metrics.setting(i, settings)) {
+                int font_number = 0;
+                for (const Setting *s = settings.begin(); s < settings.end(); s++)
+                    if (s->op == Setting::SHOW)
+                        font_mapping[font_number]++;
+                    else if (s->op == Setting::FONT)
+                        font_number = (int) s->x;
+            }
+        // make sure the most-used font is number 0
+        mapped_font0 = std::max_element(font_mapping.begin(), font_mapping.end()) - font_mapping.begin();
+        // prepare the mapping
+        for (int i = vpl_first_font; i < font_mapping.size(); i++)
+            font_mapping[i] = i - vpl_first_font;
+        font_mapping[mapped_font0] = 0;
+        font_mapping[vpl_first_font] = mapped_font0 - vpl_first_font;
+        if (vpl_first_font != 0)
+            font_mapping[0] = font_mapping.size() - 1;
+        // write MAPFONT
+        for (int i = 0; i < metrics.n_mapped_fonts() - vpl_first_font; i++) {
+            int j = std::find(font_mapping.begin(), font_mapping.end(), i) - font_mapping.begin();
+            String name = metrics.mapped_font_name(j);
+            if (!name)
+                name = make_base_font_name(_opt.font_name);
+            fprintf(f, "(MAPFONT D %d\n   (FONTNAME %s)\n   (FONTDSIZE R %.1f)\n   )\n", i, name.c_str(), _opt.design_size);
+        }
+    } else
+        for (int i = 0; i < metrics.n_mapped_fonts(); i++)
+            font_mapping.push_back(i);
+
+    // figure out the proper names and numbers for glyphs
+    Vector<String> glyph_ids;
+    Vector<String> glyph_comments(257, String());
+    Vector<String> glyph_base_comments(257, String());
+    for (int i = 0; i < metrics.encoding_size(); i++) {
+        if (metrics.glyph(i)) {
+            PermString name = metrics.code_name(i), expected_name;
+            if (i >= '0' && i <= '9')
+                expected_name = digit_names[i - '0'];
+            else if ((i >= 'A' && i <= 'Z') || (i >= 'a' && i <= 'z'))
+                expected_name = PermString((char)i);
+            String glyph_comment;
+            if (name != expected_name)
+                glyph_comment = " (COMMENT " + String(name) + ")";
+
+            int base = metrics.base_code(i);
+            if (base >= 0 && base < 256)
+                glyph_base_comments[base] = glyph_comment;
+
+            if (i >= 256)
+                continue;
+
+            char* expected_name_end;
+            if (expected_name
+                && (name == expected_name
+                    || (name.length() == 7
+                        && memcmp(name.data(), "uni00", 5) == 0
+                        && strtol(name.c_str() + 3, &expected_name_end, 16) == i
+                        && *expected_name_end == 0)))
+                glyph_ids.push_back("C " + String((char)i));
+            else
+                glyph_ids.push_back("D " + String(i));
+
+            glyph_comments[i] = glyph_base_comments[i] = glyph_comment;
+
+        } else if (i < 256)
+            glyph_ids.push_back("D " + String(i));
+    }
+    // finally, BOUNDARYCHAR
+    glyph_ids.push_back("BOUNDARYCHAR");
+
+    // LIGTABLE
+    fprintf(f, "(LIGTABLE\n");
+    Vector<int> lig_code2, lig_outcode, lig_context, kern_code2, kern_amt;
+    // don't print KRN x after printing LIG x
+    uint32_t used[8];
+    bool any_ligs = false;
+    StringAccum omitted_clig_sa;
+    for (int i = 0; i <= 256; i++)
+        if (metrics.glyph(i) && _opt.minimum_kern < 10000) {
+            int any_lig = metrics.ligatures(i, lig_code2, lig_outcode, lig_context);
+            int any_kern = metrics.kerns(i, kern_code2, kern_amt);
+            if (any_lig || any_kern) {
+                StringAccum kern_sa;
+                memset(used, 0, sizeof(used));
+                for (int j = 0; j < lig_code2.size(); j++) {
+                    if (lig_outcode[j] < 257) {
+                        kern_sa << "   (" << lig_context_str(lig_context[j])
+                                << ' ' << glyph_ids[lig_code2[j]]
+                                << ' ' << glyph_ids[lig_outcode[j]]
+                                << ')' << glyph_comments[lig_code2[j]]
+                                << glyph_comments[lig_outcode[j]] << '\n';
+                        used[lig_code2[j] >> 5] |= (1 << (lig_code2[j] & 0x1F));
+                    } else {
+                        omitted_clig_sa << "(COMMENT omitted "
+                                << lig_context_str(lig_context[j])
+                                << ' ' << metrics.code_name(i)
+                                << ' ' << metrics.code_name(lig_code2[j])
+                                << ' ' << metrics.code_name(lig_outcode[j])
+                                << ")\n";
+                    }
+                }
+                for (Vector<int>::const_iterator k2 = kern_code2.begin(); k2 < kern_code2.end(); k2++)
+                    if (!(used[*k2 >> 5] & (1 << (*k2 & 0x1F)))) {
+                        double this_kern = kern_amt[k2 - kern_code2.begin()];
+                        if (fabs(this_kern) >= _opt.minimum_kern)
+                            kern_sa << "   (KRN " << glyph_ids[*k2]
+                                    << " R " << pr.render(this_kern)
+                                    << ')' << glyph_comments[*k2] << '\n';
+                    }
+                if (kern_sa) {
+                    if (any_ligs)
+                        fprintf(f, "\n");
+                    fprintf(f, "   (LABEL %s)%s\n%s   (STOP)\n", glyph_ids[i].c_str(), glyph_comments[i].c_str(), kern_sa.c_str());
+                    any_ligs = true;
+                }
+            }
+        }
+    fprintf(f, "   )\n");
+    if (omitted_clig_sa)
+        fprintf(f, "%s\n", omitted_clig_sa.c_str());
+
+    // CHARACTERs
+    Vector<Setting> settings;
+    StringAccum sa;
+    Vector<Point> push_stack;
+
+    for (int i = 0; i < 256; i++)
+        if (metrics.setting(i, settings)) {
+            fprintf(f, "(CHARACTER %s%s\n", glyph_ids[i].c_str(), glyph_comments[i].c_str());
+
+            // unparse settings into DVI commands
+            sa.clear();
+            push_stack.clear();
+            CharstringBounds boundser(font_xform);
+            int program_number = mapped_font0;
+            const CharstringProgram *program = finfo.program();
+            for (const Setting *s = settings.begin(); s < settings.end(); s++)
+                switch (s->op) {
+
+                  case Setting::SHOW:
+                    if (vpl || program == finfo.program()) {
+                        boundser.char_bounds(program->glyph_context(s->y));
+                        profile_count(C_GLYPH_BOUNDS);
+                    }
+                    // 3.Aug.2004 -- reported by Marco Kuhlmann: Don't use
+                    // glyph_ids[] array when looking at a different font.
+                    if (program_number == 0)
+                        sa << "      (SETCHAR " << glyph_ids[s->x] << ')' << glyph_base_comments[s->x] << "\n";
+                    else
+                        sa << "      (SETCHAR D " << s->x << ")\n";
+                    break;
+
+                  case Setting::MOVE: {
+                      int x = 0, y = 0;
+                      while (s+1 < settings.end() && s[1].op == Setting::MOVE)
+                          x += s->x, y += s->y, s++;
+                      if (vpl)
+                          boundser.translate(s->x + x, s->y + y);
+                      if (s->x + x)
+                          sa << "      (MOVERIGHT R " << pr.render(s->x + x) << ")\n";
+                      if (s->y + y)
+                          sa << "      (MOVEUP R " << pr.render(s->y + y) << ")\n";
+                      break;
+                  }
+
+                  case Setting::RULE:
+                    if (vpl) {
+                        boundser.mark(Point(0, 0));
+                        boundser.mark(Point(s->x, s->y));
+                        boundser.translate(s->x, 0);
+                    }
+                    sa << "      (SETRULE R " << pr.render(s->y) << " R " << pr.render(s->x) << ")\n";
+                    break;
+
+                  case Setting::FONT:
+                    if ((int) s->x != program_number) {
+                        program = metrics.mapped_font((int) s->x);
+                        program_number = (int) s->x;
+                        sa << "      (SELECTFONT D " << font_mapping[program_number] << ")\n";
+                    }
+                    break;
+
+                  case Setting::PUSH:
+                    push_stack.push_back(boundser.transform(Point(0, 0)));
+                    sa << "      (PUSH)\n";
+                    break;
+
+                  case Setting::POP: {
+                      assert(push_stack.size());
+                      Point p = push_stack.back() - boundser.transform(Point(0, 0));
+                      if (vpl)
+                          boundser.translate(p.x, p.y);
+                      push_stack.pop_back();
+                      sa << "      (POP)\n";
+                      break;
+                  }
+
+                  case Setting::SPECIAL: {
+                      bool needhex = false;
+                      for (const char *str = s->s.begin(); str < s->s.end() && !needhex; str++)
+                          if (*str < ' ' || *str > '~' || *str == '(' || *str == ')')
+                              needhex = true;
+                      if (needhex) {
+                          sa << "      (SPECIALHEX ";
+                          for (const char *str = s->s.begin(); str < s->s.end(); str++) {
+                              static const char hexdig[] = "0123456789ABCDEF";
+                              int val = (unsigned char) *str;
+                              sa << hexdig[val >> 4] << hexdig[val & 0xF];
+                          }
+                          sa << ")\n";
+                      } else
+                          sa << "      (SPECIAL " << s->s << ")\n";
+                      break;
+                  }
+
+                }
+
+            assert(push_stack.size() == 0);
+
+            // output information
+            boundser.output(bounds, width);
+            pr.print("   (CHARWD", width);
+            if (bounds[3] > 0)
+                pr.print("   (CHARHT", bounds[3]);
+            if (bounds[1] < 0)
+                pr.print("   (CHARDP", -bounds[1]);
+            if (bounds[2] > width)
+                pr.print_transformed("   (CHARIC", pr.transform(bounds[2]) - pr.transform(width));
+            if (vpl && (settings.size() > 1 || settings[0].op != Setting::SHOW))
+                fprintf(f, "   (MAP\n%s      )\n", sa.c_str());
+            fprintf(f, "   )\n");
+        }
+
+    // at last, close the file
+    profile_count(C_BYTES_WRITTEN, ftell(f));
+
+    // Did we print a number too big for TeX to handle?  If so, try again.
+    if (pr.max_printed_real_ >= 2047) {
+        fclose(f);
+        if (metrics.design_units() <= 1)
+            return errh->error("This font appears to be broken.  It has characters so big that the PL format\ncannot represent them.");
+        metrics.set_design_units(metrics.design_units() > 200 ? metrics.design_units() - 250 : 1);
+        if (_opt.verbose)
+            errh->message("the font%,s metrics overflow the limits of PL files\n(reducing DESIGNUNITS to %d and trying again)", metrics.design_units());
+        return output_pl(metrics, ps_name, boundary_char, finfo, vpl, filename, errh);
+    } else if (_opt.in_memory) {
+        rewind(f);
+        String data = read_stream(f);
+        fclose(f);
+        add_output(vpl ? O_VPL : O_PL, filename, data);
+    } else
+        fclose(f);
+    return 0;
+}
+
+struct ConversionContext::Lookup {
+    bool used;
+    bool required;
+    Vector<OpenType::Tag> features;
+    GlyphFilter* filter;
+    Lookup()                    : used(false), required(false), filter(0) { }
+};
+
+void
+ConversionContext::find_lookups(const OpenType::ScriptList& scripts, const OpenType::FeatureList& features, Vector<Lookup>& lookups, ErrorHandler* errh) const
+{
+    Vector<int> fids, lookupids;
+    int required;
+
+    // go over all scripts
+    for (int i = 0; i < _opt.interesting_scripts.size(); i += 2) {
+        OpenType::Tag script = _opt.interesting_scripts[i];
+        OpenType::Tag langsys = _opt.interesting_scripts[i+1];
+
+        // collect features applying to this script
+        scripts.features(script, langsys, required, fids, errh);
+
+        // only use the selected features
+        features.filter(fids, _opt.interesting_features);
+
+        // mark features as having been used
+        for (int j = (required < 0 ? 0 : -1); j < fids.size(); j++) {
+            int fid = (j < 0 ? required : fids[j]);
+            OpenType::Tag ftag = features.tag(fid);
+            if (features.lookups(fid, lookupids, errh) < 0)
+                lookupids.clear();
+            for (int k = 0; k < lookupids.size(); k++) {
+                int l = lookupids[k];
+                if (l < 0 || l >= lookups.size())
+                    errh->error("lookup for %<%s%> feature out of range", OpenType::Tag::langsys_text(script, langsys).c_str());
+                else {
+                    lookups[l].used = true;
+                    lookups[l].features.push_back(ftag);
+                    if (j < 0)
+                        lookups[l].required = true;
+                }
+            }
+        }
+    }
+
+    // now check for compatible glyph filters
+    for (Lookup* l = lookups.begin(); l < lookups.end(); l++)
+        if (l->used && !l->required) {
+            l->filter = _opt.feature_filters[l->features[0]];
+            for (OpenType::Tag* ft = l->features.begin() + 1; ft < l->features.end(); ft++)
+                if (!l->filter->check_eq(*_opt.feature_filters[*ft])) {
+                    errh->error("%<%s%> and %<%s%> features share a lookup, but have different filters", l->features[0].text().c_str(), ft->text().c_str());
+                    break;
+                }
+        }
+}
+
+int
+ConversionContext::write_encoding_file(String &filename, const String &encoding_name,
+                    StringAccum &contents, ErrorHandler *errh)
+{
+    FILE *f;
+    if (_opt.in_memory) {
+        add_output(O_ENCODING, filename, contents.take_string());
+        return 0;
+    }
+
+    int ok_retval = (access(filename.c_str(), R_OK) >= 0 ? 0 : 1);
+
+    if (_opt.no_create) {
+        errh->message((ok_retval ? "would create encoding file %s" : "would update encoding file %s"), filename.c_str());
+        return ok_retval;
+    } else if (_opt.verbose)
+        errh->message((ok_retval ? "creating encoding file %s" : "updating encoding file %s"), filename.c_str());
+
+    int fd = open(filename.c_str(), O_RDWR | O_CREAT, 0666);
+    if (fd < 0)
+        return errh->error("%s: %s", filename.c_str(), strerror(errno));
+    f = fdopen(fd, "r+");
+    // NB: also change commit_map_file in automatic.cc if you change this code
+
+#if defined(F_SETLKW) && defined(HAVE_FTRUNCATE)
+    {
+        struct flock lock;
+        lock.l_type = F_WRLCK;
+        lock.l_whence = SEEK_SET;
+        lock.l_start = 0;
+        lock.l_len = 0;
+        int result;
+        while ((result = fcntl(fd, F_SETLKW, &lock)) < 0 && errno == EINTR)
+            /* try again */;
+        if (result < 0) {
+            result = errno;
+            fclose(f);
+            return errh->error("locking %s: %s", filename.c_str(), strerror(result));
+        }
+    }
+#endif
+
+    // read old data from encoding file
+    StringAccum sa;
+    int amt;
+    do {
+        if (char *x = sa.reserve(8192)) {
+            amt = fread(x, 1, 8192, f);
+            sa.adjust_length(amt);
+        } else
+            amt = 0;
+    } while (amt != 0);
+    if (!feof(f) || ferror(f))
+        return errh->error("%s: %s", filename.c_str(), strerror(errno));
+    String old_encodings = sa.take_string();
+    bool created = (!old_encodings);
+
+    // append old encodings
+    int pos1 = old_encodings.find_left("\n%%");
+    while (pos1 >= 0 && pos1 < old_encodings.length()) {
+        int pos2 = old_encodings.find_left("\n%%", pos1 + 1);
+        if (pos2 < 0)
+            pos2 = old_encodings.length();
+        if (old_encodings.substring(pos1 + 3, encoding_name.length()) == encoding_name) {
+            // encoding already exists, don't change it
+            fclose(f);
+            if (_opt.verbose)
+                errh->message("%s unchanged", filename.c_str());
+            return 0;
+        } else
+            contents << old_encodings.substring(pos1, pos2 - pos1);
+        pos1 = pos2;
+    }
+
+    // rewind file
+#ifdef HAVE_FTRUNCATE
+    rewind(f);
+    if (ftruncate(fd, 0) < 0)
+#endif
+    {
+        fclose(f);
+        f = fopen(filename.c_str(), "wb");
+        fd = fileno(f);
+    }
+
+    ignore_result(fwrite(contents.data(), 1, contents.length(), f));
+    profile_count(C_BYTES_WRITTEN, contents.length());
+
+    fclose(f);
+
+    // inform about the new file if necessary
+    if (created)
+        update_odir(O_ENCODING, filename, errh);
+    return 0;
+}
+
+bool
+ConversionContext::output_encoding(const Metrics &metrics,
+                const Vector<PermString> &glyph_names,
+                ErrorHandler *errh)
+{
+    static const char * const hex_digits = "0123456789ABCDEF";
+    ProfilePhase phase(P_OUTPUT);
+
+    // collect encoding data
+    Vector<Metrics::Glyph> glyphs;
+    if (!metrics.base_glyphs(glyphs, 256))
+        return false;
+
+    StringAccum sa;
+    for (int i = 0; i < 256; i++) {
+        if ((i & 0xF) == 0)
+            sa << (i ? "\n%" : "%") << hex_digits[(i >> 4) & 0xF] << '0' << '\n' << ' ';
+        else if ((i & 0x7) == 0)
+            sa << '\n' << ' ';
+        int g = glyphs[i];
+        if (g > 0 && g < glyph_names.size())
+            sa << ' ' << '/' << glyph_names[g];
+        else
+            sa << " /.notdef";
+    }
+    sa << '\n';
+
+    // digest encoding data
+    MD5_CONTEXT md5;
+    md5_init(&md5);
+    md5_update(&md5, (const unsigned char *)sa.data(), sa.length());
+    char text_digest[MD5_TEXT_DIGEST_SIZE + 1];
+    md5_final_text(text_digest, &md5);
+
+    // name encoding using digest
+    _out_encoding_name = "AutoEnc_" + String(text_digest);
+
+    // create encoding filename
+    bool output_encoding_only = (bool) _out_encoding_file;
+    if (!_out_encoding_file)
+        _out_encoding_file = getodir(O_ENCODING, errh) + String("/a_") + String(text_digest).substring(0, 6) + ".enc";
+
+    // exit if we're not responsible for generating an encoding
+    if (!(_opt.output_flags & G_ENCODING))
+        return true;
+
+    // put encoding block in a StringAccum
+    // 3.Jun.2003: stick command line definition at the end of the encoding,
+    // where it won't confuse idiotic ps2pk
+    StringAccum contents;
+    if (!output_encoding_only)
+        contents << "% THIS FILE WAS AUTOMATICALLY GENERATED -- DO NOT EDIT\n\n\
+%%" << _out_encoding_name << "\n";
+    contents << "% Encoding created by otftotfm" << _opt.current_time << "\n\
+% Command line follows encoding\n";
+
+    // the encoding itself
+    contents << '/' << _out_encoding_name << " [\n" << sa << "] def\n";
+
+    // write banner -- unfortunately this takes some doing
+    String banner = String("Command line: '") + String(_opt.invocation.data(), _opt.invocation.length()) + String("'");
+    char *buf = banner.mutable_data();
+    // get rid of crap characters
+    for (int i = 0; i < banner.length(); i++)
+        if (buf[i] < ' ' || buf[i] > 0176) {
+            if (buf[i] == '\n' || buf[i] == '\r')
+                buf[i] = ' ';
+            else
+                buf[i] = '.';
+        }
+    // break lines at 80 characters -- it would be nice if this were in a
+    // library
+    while (banner.length() > 0) {
+        int pos = banner.find_left(' '), last_pos = pos;
+        while (pos < 75 && pos >= 0) {
+            last_pos = pos;
+            pos = banner.find_left(' ', pos + 1);
+        }
+        if (last_pos < 0 || (pos < 0 && banner.length() < 75))
+            last_pos = banner.length();
+        contents << "% " << banner.substring(0, last_pos) << '\n';
+        banner = banner.substring(last_pos + 1);
+    }
+
+    // open encoding file
+    if (_out_encoding_file == "-" && _opt.in_memory)
+        add_output(O_ENCODING, _out_encoding_file, contents.take_string());
+    else if (_out_encoding_file == "-")
+        ignore_result(fwrite(contents.data(), 1, contents.length(), stdout));
+    else if (write_encoding_file(_out_encoding_file, _out_encoding_name, contents, errh) == 1)
+        update_odir(O_ENCODING, _out_encoding_file, errh);
+    return true;
+}
+
+int
+ConversionContext::output_tfm(Metrics &metrics, const String &ps_name, int boundary_char,
+           const FontInfo &finfo, String tfm_filename, String vf_filename,
+           String pl_filename, ErrorHandler *errh)
+{
+    bool vpl = vf_filename;
+
+    // In memory, the (V)PL, TFM, and VF files all live in temporary files
+    // that are read back and removed.
+    String nominal_tfm_filename = tfm_filename, nominal_vf_filename = vf_filename;
+    bool in_memory = _opt.in_memory && !_opt.no_create;
+    if (in_memory) {
+        pl_filename = String();
+        int fd = temporary_file(tfm_filename, errh);
+        if (fd < 0)
+            return -1;
+        close(fd);
+        if (vpl && (fd = temporary_file(vf_filename, errh)) >= 0)
+            close(fd);
+        else if (vpl) {
+            unlink(tfm_filename.c_str());
+            return -1;
+        }
+    }
+    bool had_pl_filename = !pl_filename.empty();
+
+    if (!pl_filename) {
+        if (_opt.no_create) {
+            errh->message("would write %s to temporary file", (vpl ? "VPL" : "PL"));
+            pl_filename = "<temporary>";
+        } else {
+            int pl_fd = temporary_file(pl_filename, errh);
+            if (pl_fd < 0)
+                return -1;
+            _opt.in_memory = false;
+            int r = output_pl(metrics, ps_name, boundary_char, finfo, vpl, pl_filename, errh);
+            _opt.in_memory = in_memory;
+            close(pl_fd);
+            if (r < 0) {
+                unlink(pl_filename.c_str());
+                if (in_memory) {
+                    unlink(tfm_filename.c_str());
+                    if (vpl)
+                        unlink(vf_filename.c_str());
+                }
+                return r;
+            }
+        }
+    }
+
+    StringAccum command;
+    if (vpl)
+        command << "vptovf " << shell_quote(pl_filename) << ' ' << shell_quote(vf_filename) << ' ' << shell_quote(tfm_filename) << " 2>&1";
+    else
+        command << "pltotf " << shell_quote(pl_filename) << ' ' << shell_quote(tfm_filename) << " 2>&1";
+
+    ProfilePhase pltotf_phase(P_PLTOTF);
+    FILE* cmdfile = mypopen(command.c_str(), "r", errh);
+    int status;
+    if (cmdfile) {
+        StringAccum results;
+        while (!feof(cmdfile)) {
+            char* buf = results.reserve(BUFSIZ);
+            results.adjust_length(fread(buf, 1, BUFSIZ, cmdfile));
+        }
+        // compensate for shitty vptovf/pltotf messages
+        char* by_units, *last_line;
+        while (!results.empty()
+               && (by_units = strstr((char*) results.c_str(), "  units"))
+               && (last_line = strrchr((char*) results.c_str(), '\n'))
+               && results.end() - last_line > 1
+               && isdigit((unsigned char) last_line[1])) {
+            char* start_number = last_line + 1;
+            char* end_number = last_line + 2;
+            while (end_number < results.end()
+                   && isdigit((unsigned char) *end_number))
+                ++end_number;
+            if (end_number < results.end() && *end_number == '.') {
+                char* dot = end_number;
+                ++end_number;
+                while (end_number < results.end()
+                       && end_number < dot + 8
+                       && isdigit((unsigned char) *end_number))
+                    ++end_number;
+            }
+            String number(start_number, end_number);
+            char* by_units_dest = by_units + 1 + (end_number - start_number);
+            memmove(by_units_dest, by_units + 1, start_number - (by_units + 1));
+            memmove(by_units + 1, number.begin(), number.length());
+        }
+        if (!results.empty())
+            fwrite(results.begin(), 1, results.length(), stderr);
+        status = pclose(cmdfile);
+    } else
+        status = -1;
+
+    if (!_opt.no_create && !had_pl_filename)
+        unlink(pl_filename.c_str());
+
+    if (in_memory) {
+        if (status == 0) {
+            add_output(O_TFM, nominal_tfm_filename, read_file(tfm_filename, errh));
+            if (vpl)
+                add_output(O_VF, nominal_vf_filename, read_file(vf_filename, errh));
+        }
+        unlink(tfm_filename.c_str());
+        if (vpl)
+            unlink(vf_filename.c_str());
+    }
+
+    if (status != 0)
+        return errh->error("%s execution failed", (vpl ? "vptovf" : "pltotf"));
+    else if (!in_memory) {
+        update_odir(O_TFM, tfm_filename, errh);
+        if (vpl)
+            update_odir(O_VF, vf_filename, errh);
+    }
+    return 0;
+}
+
+int
+ConversionContext::output_metrics(Metrics &metrics, const String &ps_name, int boundary_char,
+               const FontInfo &finfo,
+               const String &encoding_name, const String &encoding_file,
+               const String &font_name, const String &font_file,
+               ErrorHandler *errh)
+{
+    ProfilePhase phase(P_OUTPUT);
+    String base_font_name = font_name;
+    bool need_virtual = metrics.need_virtual(257);
+    if (need_virtual) {
+        if (_opt.output_flags & G_VMETRICS)
+            base_font_name = make_base_font_name(font_name);
+        else if (_opt.output_flags & G_METRICS)
+            errh->warning("features require virtual fonts");
+    }
+
+    // output virtual metrics
+    if (!(_opt.output_flags & G_VMETRICS))
+        /* do nothing */;
+    else if (!need_virtual) {
+        if (_opt.automatic) {
+            // erase old virtual font
+            String vf = getodir(O_VF, errh) + "/" + font_name + ".vf";
+            if (_opt.no_create)
+                errh->message("would remove potential VF file %<%s%>", vf.c_str());
+            else {
+                if (_opt.verbose)
+                    errh->message("removing potential VF file %<%s%>", vf.c_str());
+                if (unlink(vf.c_str()) < 0 && errno != ENOENT)
+                    errh->error("removing %s: %s", vf.c_str(), strerror(errno));
+            }
+        }
+    } else {
+        String vplfile;
+        if (_opt.output_flags & G_ASCII) {
+            vplfile = getodir(O_VPL, errh) + "/" + font_name + ".vpl";
+            if (output_pl(metrics, ps_name, boundary_char, finfo, true, vplfile, errh) < 0)
+                return -1;
+            update_odir(O_VPL, vplfile, errh);
+        }
+        if (_opt.output_flags & G_BINARY) {
+            String tfm = getodir(O_TFM, errh) + "/" + font_name + ".tfm";
+            String vf = getodir(O_VF, errh) + "/" + font_name + ".vf";
+            if (output_tfm(metrics, ps_name, boundary_char, finfo, tfm, vf, vplfile, errh) < 0)
+                return -1;
+        }
+    }
+
+    // quit if no base needed
+    metrics.make_base(257);
+    if (!metrics.need_base())
+        return 0;
+
+    // output metrics
+    double save_minimum_kern = _opt.minimum_kern;
+    if (need_virtual)
+        _opt.minimum_kern = 100000;
+    int r = 0;
+    if (_opt.output_flags & G_METRICS) {
+        String plfile;
+        if (_opt.output_flags & G_ASCII) {
+            plfile = getodir(O_PL, errh) + "/" + base_font_name + ".pl";
+            if ((r = output_pl(metrics, ps_name, boundary_char, finfo, false, plfile, errh)) >= 0)
+                update_odir(O_PL, plfile, errh);
+        }
+        if (r >= 0 && (_opt.output_flags & G_BINARY)) {
+            String tfm = getodir(O_TFM, errh) + "/" + base_font_name + ".tfm";
+            r = output_tfm(metrics, ps_name, boundary_char, finfo, tfm, String(), plfile, errh);
+        }
+    }
+    _opt.minimum_kern = save_minimum_kern;
+    if (r < 0)
+        return r;
+
+    // print DVIPS map line
+    if (errh->nerrors() == 0 && (_opt.output_flags & G_PSFONTSMAP)) {
+        StringAccum sa;
+        sa << base_font_name << ' ' << ps_name << " \"";
+        if (_opt.extend)
+            sa << _opt.extend << " ExtendFont ";
+        if (_opt.slant)
+            sa << _opt.slant << " SlantFont ";
+        if (encoding_name)
+            sa << encoding_name << " ReEncodeFont\" <[" << pathname_filename(encoding_file);
+        else
+            sa << "\"";
+        if (font_file)
+            sa << " <" << pathname_filename(font_file) << '\n';
+        else
+            sa << ' ' << main_dvips_map(ps_name, finfo, errh) << '\n';
+        update_autofont_map(base_font_name, sa.take_string(), errh);
+        // if virtual font, remove any map line for base font name
+        if (base_font_name != font_name)
+            update_autofont_map(font_name, "", errh);
+    }
+    return 0;
+}
+
+
+enum { F_GSUB_TRY = 1, F_GSUB_PART = 2, F_GSUB_ALL = 4,
+       F_GPOS_TRY = 8, F_GPOS_PART = 16, F_GPOS_ALL = 32,
+       X_UNUSED = 0, X_BOTH_NONE = 1, X_GSUB_NONE = 2,
+       X_GSUB_PART = 3, X_GPOS_NONE = 4, X_GPOS_PART = 5, X_COUNT };
+
+static const char * const x_messages[] = {
+    "% ignored, not supported by font",
+    "% ignored, too complex for me",
+    "complex substitutions from % ignored",
+    "some complex substitutions from % ignored",
+    "complex positionings from % ignored",
+    "some complex positionings from % ignored",
+};
+
+void
+ConversionContext::report_underused_features(const HashMap<uint32_t, int> &feature_usage, ErrorHandler *errh) const
+{
+    Vector<String> x[X_COUNT];
+    for (int i = 0; i < _opt.interesting_features.size(); i++) {
+        OpenType::Tag f = _opt.interesting_features[i];
+        int fu = feature_usage[f.value()];
+        String ftext = errh->format("%<%s%>", f.text().c_str());
+        if (fu == 0)
+            x[X_UNUSED].push_back(ftext);
+        else if ((fu & (F_GSUB_TRY | F_GPOS_TRY)) == fu)
+            x[X_BOTH_NONE].push_back(ftext);
+        else {
+            if (fu & F_GSUB_TRY) {
+                if ((fu & (F_GSUB_PART | F_GSUB_ALL)) == 0)
+                    x[X_GSUB_NONE].push_back(ftext);
+                else if (fu & F_GSUB_PART)
+                    x[X_GSUB_PART].push_back(ftext);
+            }
+            if (fu & F_GPOS_TRY) {
+                if ((fu & (F_GPOS_PART | F_GPOS_ALL)) == 0)
+                    x[X_GPOS_NONE].push_back(ftext);
+                else if (fu & F_GPOS_PART)
+                    x[X_GPOS_PART].push_back(ftext);
+            }
+        }
+    }
+
+    for (int i = 0; i < X_COUNT; i++)
+        if (x[i].size())
+            goto found;
+    return;
+
+  found:
+    for (int i = 0; i < X_COUNT; i++)
+        if (x[i].size()) {
+            StringAccum sa;
+            const char* msg_pct = strchr(x_messages[i], '%');
+            sa.append(x_messages[i], msg_pct - x_messages[i]);
+            const char* sep = (x[i].size() > 2 ? ", " : " ");
+            for (const String* a = x[i].begin(); a < x[i].end() - 1; a++)
+                sa << *a << sep;
+            sa << (x[i].size() > 1 ? "and " : "") << x[i].back()
+               << (x[i].size() > 1 ? " features" : " feature") << (msg_pct+1);
+            sa.append_break_lines(sa.take_string(), 58);
+            errh->warning("%s", sa.c_str());
+        }
+}
+
+String
+ConversionContext::main_dvips_map(const String &ps_name, const FontInfo &finfo, ErrorHandler *errh)
+{
+    if (String fn = installed_type1(_otf_filename, ps_name, (_opt.output_flags & G_TYPE1) != 0, errh))
+        return "<" + pathname_filename(fn);
+    if (!finfo.cff) {
+        String ttf_fn, t42_fn;
+        ttf_fn = installed_truetype(_otf_filename, (_opt.output_flags & G_TRUETYPE) != 0, errh);
+        t42_fn = installed_type42(_otf_filename, ps_name, (_opt.output_flags & G_TYPE42) != 0, errh);
+        if (t42_fn && (!ttf_fn || (_opt.output_flags & G_TYPE42) != 0))
+            return "<" + pathname_filename(t42_fn);
+        else if (ttf_fn)
+            return "<" + pathname_filename(ttf_fn);
+    }
+    return "<" + pathname_filename(_otf_filename);
+}
+
+// Unparsing a lookup depends only on the font, so with --jobs, lookups are
+// unparsed concurrently into per-lookup buffers and applied afterwards in
+// lookup order.  Workers share the font and its Gsub or Gpos.
+namespace {
+class GsubUnparseTask : public ParallelTask { public:
+
+    GsubUnparseTask(const OpenType::Gsub &gsub, const OpenType::Coverage &limit,
+                    const Vector<int> &lookups)
+        : subs(lookups.size(), Vector<OpenType::Substitution>()),
+          understood(lookups.size(), 0), errors(lookups.size(), String()),
+          _gsub(gsub), _limit(limit), _lookups(lookups) {
+    }
+
+    void *thread_begin(bool) {
+        return 0;
+    }
+    void run(int item, void *thread);
+    void thread_end(void *) {
+    }
+
+    Vector<Vector<OpenType::Substitution> > subs;
+    Vector<int> understood;
+    Vector<String> errors;
+    Vector<int> pending;        // items still to be unparsed
+
+  private:
+
+    const OpenType::Gsub &_gsub;
+    const OpenType::Coverage &_limit;
+    const Vector<int> &_lookups;
+
+};
+
+void
+GsubUnparseTask::run(int item, void *)
+{
+    item = pending[item];
+    try {
+        OpenType::GsubLookup l = _gsub.lookup(_lookups[item]);
+        understood[item] = l.unparse_automatics(_gsub, subs[item], _limit);
+    } catch (const OpenType::Error &e) {
+        errors[item] = e.description;
+    }
+}
+
+class GposUnparseTask : public ParallelTask { public:
+
+    GposUnparseTask(const OpenType::Gpos &gpos, const Vector<int> &lookups)
+        : poss(lookups.size(), Vector<OpenType::Positioning>()),
+          understood(lookups.size(), 0), errors(lookups.size(), String()),
+          messages(lookups.size(), DeferredErrorHandler()),
+          _gpos(gpos), _lookups(lookups) {
+    }
+
+    void *thread_begin(bool) {
+        return 0;
+    }
+    void run(int item, void *thread);
+    void thread_end(void *) {
+    }
+
+    Vector<Vector<OpenType::Positioning> > poss;
+    Vector<int> understood;
+    Vector<String> errors;
+    Vector<DeferredErrorHandler> messages;
+    Vector<int> pending;        // items still to be unparsed
+
+  private:
+
+    const OpenType::Gpos &_gpos;
+    const Vector<int> &_lookups;
+
+};
+
+void
+GposUnparseTask::run(int item, void *)
+{
+    item = pending[item];
+    try {
+        OpenType::GposLookup l = _gpos.lookup(_lookups[item]);
+        understood[item] = l.unparse_automatics(poss[item], &messages[item]);
+    } catch (const OpenType::Error &e) {
+        errors[item] = e.description;
+    }
+}
+}
+
+OpenType::LayoutSnapshot
+ConversionContext::load_layout_snapshot(const OpenType::Font &otf, ErrorHandler *errh)
+{
+    OpenType::LayoutSnapshot cached = daemon_layout_snapshot(otf);
+    if (cached.ok() || !_opt.layout_cache_dir)
+        return cached;
+
+    String key = OpenType::LayoutSnapshot::font_key(otf);
+    String filename = _opt.layout_cache_dir + "/" + OpenType::LayoutSnapshot::key_text(key) + ".otls";
+    if (access(filename.c_str(), R_OK) >= 0) {
+        OpenType::LayoutSnapshot snapshot(read_file(filename, errh, true), key);
+        if (snapshot.ok()) {
+            if (_opt.verbose)
+                errh->message("using layout snapshot %s", filename.c_str());
+            return snapshot;
+        }
+    }
+
+    String data = OpenType::LayoutSnapshot::make(otf, errh);
+    if (_opt.verbose)
+        errh->message("creating layout snapshot %s", filename.c_str());
+    if (!_opt.no_create) {
+        // replace_file() uses a unique temporary name, so concurrent
+        // writers don't collide and readers never see a partial snapshot
+        if (int r = replace_file(filename, data))
+            errh->warning("%s: %s", filename.c_str(), strerror(-r));
+        else
+            profile_count(C_BYTES_WRITTEN, data.length());
+    }
+    return OpenType::LayoutSnapshot(data, key);
+}
+
+void
+ConversionContext::do_gsub(Metrics& metrics, const OpenType::Font& otf,
+        const OpenType::LayoutSnapshot& snapshot,
+        DvipsEncoding& dvipsenc, bool dvipsenc_literal,
+        HashMap<uint32_t, int>& feature_usage,
+        const Vector<PermString>& glyph_names, ErrorHandler* errh)
+{
+    ProfilePhase phase(P_GSUB);
+
+    // find activated GSUB features
+    OpenType::Gsub gsub(otf.table("GSUB"), &otf, errh);
+    Vector<Lookup> lookups(gsub.nlookups(), Lookup());
+    find_lookups(gsub.script_list(), gsub.feature_list(), lookups, errh);
+
+    // find all characters that might result
+    Vector<bool> used(glyph_names.size(), false);
+    for (Metrics::Code c = 0; c < metrics.encoding_size(); ++c) {
+        Metrics::Glyph g = metrics.glyph(c);
+        if (g >= 0 && g < used.size())
+            used[g] = true;
+    }
+    Vector<int> used_lookups;
+    for (int i = 0; i < lookups.size(); ++i)
+        if (lookups[i].used)
+            used_lookups.push_back(i);
+    gsub.closure(used, used_lookups);
+    OpenType::Coverage used_coverage(used);
+
+    // unparse activated GSUB features, using the layout snapshot if possible
+    GsubUnparseTask task(gsub, used_coverage, used_lookups);
+    for (int k = 0; k < used_lookups.size(); k++)
+        try {
+            bool understood;
+            if (snapshot.unparse(used_lookups[k], task.subs[k], used_coverage, understood))
+                task.understood[k] = understood;
+            else
+                task.pending.push_back(k);
+        } catch (OpenType::Error) {
+            task.subs[k].clear();
+            task.pending.push_back(k);
+        }
+    run_parallel(task, task.pending.size());
+
+    // apply them in lookup order
+    CompiledGlyphFilterSet filters(glyph_names);
+    for (int k = 0; k < used_lookups.size(); k++) {
+        int i = used_lookups[k];
+        if (task.errors[k].length())
+            throw OpenType::Error(task.errors[k]);
+        Vector<OpenType::Substitution> &subs = task.subs[k];
+        bool understood = task.understood[k];
+
+        // check for -ffina, which should apply only at the ends of words,
+        // and -finit, which should apply only at the beginnings.
+        OpenType::Tag feature = (lookups[i].features.size() == 1 ? lookups[i].features[0] : OpenType::Tag());
+        if (feature == OpenType::Tag("fina") || feature == OpenType::Tag("fin2") || feature == OpenType::Tag("fin3")) {
+            if (dvipsenc.boundary_char() < 0)
+                errh->warning("%<-ffina%> requires a boundary character\n(The input encoding didn%,t specify a boundary character, but\nI need one to implement %<-ffina%> features correctly.  Try\nthe %<--boundary-char%> option.)");
+            else {
+                int bg = metrics.boundary_glyph();
+                for (int j = 0; j < subs.size(); j++)
+                    subs[j].add_outer_right(bg);
+            }
+        } else if (feature == OpenType::Tag("init")) {
+            int bg = metrics.boundary_glyph();
+            for (int j = 0; j < subs.size(); j++)
+                subs[j].add_outer_left(bg);
+        }
+
+        //for (int subno = 0; subno < subs.size(); subno++) fprintf(stderr, "%5d\t%s\n", i, subs[subno].unparse().c_str());
+
+        // figure out which glyph filter to use
+        int nunderstood = metrics.apply(subs, !dvipsenc_literal, i, filters[lookups[i].filter]);
+        profile_count(C_SUBS_GENERATED, subs.size());
+        profile_count(C_SUBS_APPLIED, nunderstood);
+
+        // mark as used
+        int d = (understood && nunderstood == subs.size() ? F_GSUB_ALL : (nunderstood ? F_GSUB_PART : 0)) + F_GSUB_TRY;
+        for (int j = 0; j < lookups[i].features.size(); j++)
+            feature_usage.find_force(lookups[i].features[j].value()) |= d;
+    }
+
+    // apply alternate selectors
+    if (metrics.altselectors() && !dvipsenc_literal) {
+        // do lookups
+        _opt.altselector_features.swap(_opt.interesting_features);
+        _opt.altselector_feature_filters.swap(_opt.feature_filters);
+        Vector<Lookup> alt_lookups(gsub.nlookups(), Lookup());
+        find_lookups(gsub.script_list(), gsub.feature_list(), alt_lookups, ErrorHandler::silent_handler());
+        Vector<OpenType::Substitution> alt_subs;
+        for (int i = 0; i < alt_lookups.size(); i++)
+            if (alt_lookups[i].used) {
+                OpenType::GsubLookup l = gsub.lookup(i);
+                alt_subs.clear();
+                (void) l.unparse_automatics(gsub, alt_subs, used_coverage);
+                profile_count(C_SUBS_GENERATED, alt_subs.size());
+                metrics.apply_alternates(alt_subs, i, filters[alt_lookups[i].filter]);
+            }
+        _opt.altselector_features.swap(_opt.interesting_features);
+        _opt.altselector_feature_filters.swap(_opt.feature_filters);
+    }
+}
+
+bool
+ConversionContext::kern_feature_requested() const
+{
+    return std::find(_opt.interesting_features.begin(), _opt.interesting_features.end(),
+                     OpenType::Tag("kern")) != _opt.interesting_features.end();
+}
+
+void
+ConversionContext::do_try_ttf_kern(Metrics& metrics, const OpenType::Font& otf, HashMap<uint32_t, int>& feature_usage, ErrorHandler* errh)
+{
+    // if no GPOS "kern" lookups and "kern" requested, try "kern" table
+    if (!kern_feature_requested())
+        return;
+    ProfilePhase phase(P_GPOS);
+    try {
+        OpenType::KernTable kern(otf.table("kern"), errh);
+        Vector<OpenType::Positioning> poss;
+        bool understood = kern.unparse_automatics(poss, errh);
+        int nunderstood = metrics.apply(poss);
+        profile_count(C_POS_GENERATED, poss.size());
+        profile_count(C_POS_APPLIED, nunderstood);
+
+        // mark as used
+        int d = (understood && nunderstood == poss.size() ? F_GPOS_ALL : (nunderstood ? F_GPOS_PART : 0)) + F_GPOS_TRY;
+        feature_usage.find_force(OpenType::Tag("kern").value()) |= d;
+    } catch (OpenType::BlankTable) {
+        // nada
+    } catch (OpenType::Error e) {
+        errh->warning("kern %<%s%> error, continuing", e.description.c_str());
+    }
+}
+
+void
+ConversionContext::do_gpos(Metrics& metrics, const OpenType::Font& otf, const OpenType::LayoutSnapshot& snapshot, HashMap<uint32_t, int>& feature_usage, ErrorHandler* errh)
+{
+    ProfilePhase phase(P_GPOS);
+    OpenType::Gpos gpos(otf.table("GPOS"), errh);
+    Vector<Lookup> lookups(gpos.nlookups(), Lookup());
+    find_lookups(gpos.script_list(), gpos.feature_list(), lookups, errh);
+
+    // OpenType recommends that if GPOS exists, but the "kern" feature loads
+    // no lookups, we use the TrueType "kern" table, if any.
+    if (kern_feature_requested()) {
+        OpenType::Tag kern_tag("kern");
+        for (Lookup *l = lookups.begin(); l != lookups.end(); ++l)
+            if (std::find(l->features.begin(), l->features.end(), kern_tag) != l->features.end())
+                goto skip_ttf_kern;
+        do_try_ttf_kern(metrics, otf, feature_usage, errh);
+    skip_ttf_kern: ;
+    }
+
+    // unparse activated GPOS features, then apply them in lookup order
+    Vector<int> used_lookups;
+    for (int i = 0; i < lookups.size(); i++)
+        if (lookups[i].used)
+            used_lookups.push_back(i);
+    GposUnparseTask task(gpos, used_lookups);
+    for (int k = 0; k < used_lookups.size(); k++)
+        try {
+            bool understood;
+            if (snapshot.unparse(used_lookups[k], task.poss[k], understood))
+                task.understood[k] = understood;
+            else
+                task.pending.push_back(k);
+        } catch (OpenType::Error) {
+            task.poss[k].clear();
+            task.pending.push_back(k);
+        }
+    run_parallel(task, task.pending.size());
+
+    for (int k = 0; k < used_lookups.size(); k++) {
+        int i = used_lookups[k];
+        task.messages[k].replay(errh);
+        if (task.errors[k].length())
+            throw OpenType::Error(task.errors[k]);
+        Vector<OpenType::Positioning> &poss = task.poss[k];
+        bool understood = task.understood[k];
+        int nunderstood = metrics.apply(poss);
+        profile_count(C_POS_GENERATED, poss.size());
+        profile_count(C_POS_APPLIED, nunderstood);
+
+        // mark as used
+        int d = (understood && nunderstood == poss.size() ? F_GPOS_ALL : (nunderstood ? F_GPOS_PART : 0)) + F_GPOS_TRY;
+        for (int j = 0; j < lookups[i].features.size(); j++)
+            feature_usage.find_force(lookups[i].features[j].value()) |= d;
+    }
+}
+
+void
+ConversionContext::do_math_spacing(Metrics &metrics, const FontInfo &finfo,
+                const DvipsEncoding &dvipsenc) const
+{
+    Transform font_xform;
+    if (_opt.extend)
+        font_xform.scale(_opt.extend, 1);
+    if (_opt.slant)
+        font_xform.shear(_opt.slant);
+    CharstringBounds boundser(font_xform);
+
+    double x_height = finfo.x_height(font_xform);
+    double actual_slant = font_slant(finfo);
+    int boundary_char = dvipsenc.boundary_char();
+
+    double bounds[4], width;
+
+    for (int code = 0; code < metrics.encoding_size(); code++)
+        if (metrics.was_base_glyph(code)
+            && code != boundary_char
+            && char_bounds(bounds, width, finfo, font_xform, metrics.unicode(code))) {
+            int left_sb = (bounds[0] < 0 ? (int) ceil(-bounds[0]) : 0);
+            metrics.add_single_positioning(code, left_sb, 0, left_sb);
+
+            if (_opt.skew_char >= 0 && code < 256) {
+                double sheight = std::max(bounds[3], x_height) - 0.5 * x_height;
+                double right_sb = std::max(bounds[2] - width, 0.0);
+                double desired = left_sb + 0.5 * width + actual_slant * sheight + 0.25 * right_sb;
+                double computed = 0.5 * (left_sb + width + right_sb);
+                int skew = (int) (desired - computed);
+                metrics.add_kern(code, _opt.skew_char, skew);
+            }
+        }
+}
+
+static const char * const default_ligkerns = "\
+space l =: lslash ; space L =: Lslash ; \
+question quoteleft =: questiondown ; \
+exclam quoteleft =: exclamdown ; \
+hyphen hyphen =: endash ; endash hyphen =: emdash ; \
+quoteleft quoteleft =: quotedblleft ; \
+quoteright quoteright =: quotedblright ;";
+
+int
+ConversionContext::make_encoding(const String &otf_filename, const OpenType::Font &otf,
+                                 DvipsEncoding &dvipsenc, ErrorHandler *errh) const
+{
+    LandmarkErrorHandler cerrh(errh, printable_filename(otf_filename));
+
+    // read encoding
+    if (_opt.encoding_file) {
+        if (String path = locate_encoding(_opt.encoding_file, _opt.verbose, errh))
+            dvipsenc.parse(path, _opt.no_encoding_commands, _opt.no_encoding_commands, errh);
+        else
+            return errh->error("encoding %<%s%> not found", _opt.encoding_file.c_str());
+    } else {
+        String cff_data(otf.table("CFF"));
+        if (!cff_data) {
+            errh->error("explicit encoding required for TrueType fonts");
+            errh->message("(Use %<-e ENCODING%> to choose an encoding. %<-e texnansx%> often works.)");
+            return -1;
+        } else if (_opt.warn_no_encoding) {
+            errh->warning("no encoding provided");
+            errh->message("(Use %<-e ENCODING%> to choose an encoding. %<-e texnansx%> often works,\nor say %<-e -%> to turn off this warning.)");
+        }
+
+        // use encoding from font
+        int before = cerrh.nerrors();
+        Cff cff(cff_data, otf.units_per_em(), &cerrh);
+        Cff::FontParent *font = (cff.ok() ? cff.font(PermString(), &cerrh) : 0);
+        if (!font || !font->ok() || cerrh.nerrors() != before)
+            return -1;
+        if (Type1Encoding *t1e = font->type1_encoding()) {
+            for (int i = 0; i < 256; i++)
+                dvipsenc.encode(i, (*t1e)[i]);
+        } else
+            return errh->error("font has no encoding, specify one explicitly");
+    }
+
+    // apply default ligkern commands
+    if (_opt.default_ligkern)
+        dvipsenc.parse_ligkern(default_ligkerns, 0, ErrorHandler::silent_handler());
+
+    // apply command-line ligkern commands and coding scheme
+    cerrh.set_landmark("--ligkern command");
+    for (int i = 0; i < _opt.ligkern.size(); i++)
+        dvipsenc.parse_ligkern(_opt.ligkern[i], 1, &cerrh);
+    cerrh.set_landmark("--position command");
+    for (int i = 0; i < _opt.position.size(); i++)
+        dvipsenc.parse_position(_opt.position[i], 1, &cerrh);
+    cerrh.set_landmark("--unicoding command");
+    for (int i = 0; i < _opt.unicoding.size(); i++)
+        dvipsenc.parse_unicoding(_opt.unicoding[i], 1, &cerrh);
+    if (_opt.coding_scheme)
+        dvipsenc.set_coding_scheme(_opt.coding_scheme);
+    if (_opt.warn_missing >= 0)
+        dvipsenc.set_warn_missing(_opt.warn_missing);
+    return 0;
+}
+
+namespace {
+// Writes a context's queued ls-R and map file changes when it goes out of
+// scope, so files installed before an error or exception are registered.
+class CommitGuard { public:
+    CommitGuard(ConversionContext &ctx, ErrorHandler *errh)
+        : _ctx(ctx), _errh(errh) {
+    }
+    ~CommitGuard() {
+        _ctx.commit(_errh);
+    }
+  private:
+    ConversionContext &_ctx;
+    ErrorHandler *_errh;
+    CommitGuard(const CommitGuard &);
+    CommitGuard &operator=(const CommitGuard &);
+};
+}
+
+int
+ConversionContext::convert_file(const String &otf_filename, const String &otf_data,
+                                ErrorHandler *errh)
+{
+    int before = errh->nerrors();
+    try {
+        LandmarkErrorHandler cerrh(errh, printable_filename(otf_filename));
+        OpenType::Font otf(otf_data, &cerrh);
+        if (!otf.ok() || errh->nerrors() != before)
+            return -1;
+
+        DvipsEncoding dvipsenc;
+        if (make_encoding(otf_filename, otf, dvipsenc, errh) < 0)
+            return -1;
+
+        // write queued ls-R and map file changes, and run updmap, however
+        // the conversion ends
+        CommitGuard guard(*this, errh);
+        convert(otf_filename, otf, dvipsenc, _opt.literal_encoding, errh);
+
+    } catch (const OpenType::Error &e) {
+        errh->error("unhandled exception %<%s%>", e.description.c_str());
+    }
+    return errh->nerrors() == before ? 0 : -1;
+}
+
+int
+ConversionContext::convert(const String &otf_filename, const OpenType::Font &otf,
+        const DvipsEncoding &dvipsenc_in, bool dvipsenc_literal,
+        ErrorHandler *errh)
+{
+    ProfilePhase phase(P_ENCODING);
+    _otf_filename = otf_filename;
+    FontInfo finfo(&otf, errh);
+    if (!finfo.ok())
+        return -1;
+    if (!finfo.cff)
+        errh->warning("TrueType-flavored font support is experimental");
+    if (_opt.override_is_fixed_pitch)
+        finfo.set_is_fixed_pitch(_opt.is_fixed_pitch);
+    if (_opt.override_italic_angle)
+        finfo.set_italic_angle(_opt.italic_angle);
+    if (_opt.override_x_height != FontInfo::x_height_auto)
+        finfo.set_x_height(_opt.override_x_height, _opt.x_height);
+
+    // save glyph names
+    Vector<PermString> glyph_names;
+    finfo.glyph_names(glyph_names);
+
+    // set typeface name from font family name
+    {
+        String typeface = finfo.family_name();
+
+        // make it reasonable for the shell
+        StringAccum sa;
+        for (int i = 0; i < typeface.length(); i++)
+            if (isalnum((unsigned char) typeface[i]) || typeface[i] == '_' || typeface[i] == '-' || typeface[i] == '.' || typeface[i] == ',' || typeface[i] == '+')
+                sa << typeface[i];
+
+        if (!_opt.typeface)
+            _opt.typeface = (sa.length() ? sa.take_string() : _opt.font_name);
+    }
+
+    // initialize encoding
+    DvipsEncoding dvipsenc(dvipsenc_in); // make copy
+    Metrics metrics(finfo.program(), finfo.nglyphs());
+    metrics.set_letterspace(_opt.letterspace);
+    // encode boundary glyph at 256; pretend its Unicode value is '\n'
+    metrics.encode(256, '\n', metrics.boundary_glyph());
+    if (dvipsenc_literal)
+        dvipsenc.make_metrics(metrics, finfo, 0, true, errh);
+    else {
+        T1Secondary secondary(finfo, _opt.font_name, otf_filename, *this);
+        dvipsenc.make_metrics(metrics, finfo, &secondary, false, errh);
+    }
+
+    // maintain statistics about features
+    HashMap<uint32_t, int> feature_usage(0);
+
+    // load decoded layout data saved by an earlier run
+    OpenType::LayoutSnapshot snapshot = load_layout_snapshot(otf, errh);
+
+    // apply activated GSUB features
+    try {
+        do_gsub(metrics, otf, snapshot, dvipsenc, dvipsenc_literal, feature_usage, glyph_names, errh);
+    } catch (OpenType::BlankTable) {
+        // nada
+    } catch (OpenType::Error e) {
+        errh->warning("GSUB %<%s%> error, continuing", e.description.c_str());
+    }
+
+    // apply LIGKERN ligature commands to the result
+    dvipsenc.apply_ligkern_lig(metrics, errh);
+
+    // test fake ligature mechanism
+    //metrics.add_threeligature('T', 'h', 'e', '0');
+
+    // reencode characters to fit within 8 bytes (+ 1 for the boundary)
+    if (!dvipsenc_literal) {
+        ProfilePhase shrink_phase(P_SHRINK);
+        metrics.shrink_encoding(257, dvipsenc_in, errh);
+    }
+
+    // apply activated GPOS features
+    try {
+        do_gpos(metrics, otf, snapshot, feature_usage, errh);
+    } catch (OpenType::BlankTable) {
+        do_try_ttf_kern(metrics, otf, feature_usage, errh);
+    } catch (OpenType::Error e) {
+        errh->warning("GPOS %<%s%> error, continuing", e.description.c_str());
+    }
+
+    // apply LIGKERN kerning and POS positioning commands to the result
+    dvipsenc.apply_ligkern_kern(metrics, errh);
+    dvipsenc.apply_position(metrics, errh);
+
+    // use prespecified raw fonts
+    for (BaseEncoding **be = _opt.base_encodings.begin(); be != _opt.base_encodings.end(); be++)
+        if (!(*be)->secondary) {
+            Vector<int> mapp;
+            (*be)->encoding.make_base_mappings(mapp, finfo);
+            metrics.apply_base_encoding((*be)->font_name, (*be)->encoding, mapp);
+        }
+
+    // remove extra characters
+    metrics.cut_encoding(257);
+    //metrics.unparse();
+    int boundary_char = dvipsenc.boundary_char();
+
+    // apply letterspacing, if any
+    if (_opt.letterspace)
+        for (int code = 0; code < metrics.encoding_size(); code++)
+            if (metrics.was_base_glyph(code) && code != boundary_char) {
+                metrics.add_single_positioning(code, _opt.letterspace / 2, 0, _opt.letterspace);
+                if (code < 256) {
+                    metrics.add_kern(code, 256, -_opt.letterspace / 2);
+                    metrics.add_kern(256, code, -_opt.letterspace / 2);
+                }
+            }
+
+    // apply math letterspacing, if any
+    if (_opt.math_spacing)
+        do_math_spacing(metrics, finfo, dvipsenc);
+
+    // reencode right components of boundary_glyph as boundary_char
+    if (metrics.reencode_right_ligkern(256, boundary_char) > 0
+        && boundary_char < 0) {
+        errh->warning("no boundary character, ignoring some ligatures and/or kerns\n");
+        errh->message("(You may want to try the --boundary-char option.)");
+    }
+
+    // report unused and underused features if any
+    report_underused_features(feature_usage, errh);
+
+    // figure out our FONTNAME
+    if (!_opt.font_name) {
+        // derive font name from OpenType font name
+        _opt.font_name = finfo.postscript_name();
+        if (_opt.encoding_file) {
+            int slash = _opt.encoding_file.find_right('/') + 1;
+            int dot = _opt.encoding_file.find_right('.');
+            if (dot < slash)    // includes dot < 0 case
+                dot = _opt.encoding_file.length();
+            _opt.font_name += String("--") + _opt.encoding_file.substring(slash, dot - slash);
+        }
+        if (_opt.interesting_scripts.size() != 2 || _opt.interesting_scripts[0] != OpenType::Tag("latn") || _opt.interesting_scripts[1].valid())
+            for (int i = 0; i < _opt.interesting_scripts.size(); i += 2) {
+                _opt.font_name += String("--S") + _opt.interesting_scripts[i].text();
+                if (_opt.interesting_scripts[i+1].valid())
+                    _opt.font_name += String(".") + _opt.interesting_scripts[i+1].text();
+            }
+        for (int i = 0; i < _opt.interesting_features.size(); i++)
+            if (feature_usage[_opt.interesting_features[i].value()])
+                _opt.font_name += String("--F") + _opt.interesting_features[i].text();
+    }
+
+    // output encoding
+    if (dvipsenc_literal) {
+        _out_encoding_name = dvipsenc_in.name();
+        _out_encoding_file = dvipsenc_in.filename();
+    } else
+        output_encoding(metrics, glyph_names, errh);
+
+    // set up coding scheme
+    if (metrics.coding_scheme())
+        metrics.set_design_units(1);
+    else
+        metrics.set_coding_scheme(_out_encoding_name);
+
+    // force no type 1
+    if (!finfo.cff && (_opt.output_flags & G_TYPE1)) {
+        errh->warning("assuming --no-type1 since this font is TrueType-flavored");
+        _opt.output_flags &= ~G_TYPE1;
+    }
+
+    // output
+    return output_metrics(metrics, finfo.postscript_name(), dvipsenc.boundary_char(),
+                          finfo,
+                          _out_encoding_name, _out_encoding_file,
+                          _opt.font_name, String(), errh);
+}
+
+
+String
+ConversionContext::installed_metrics_font_name(const String &base_font_name, const String &secondary) const
+{
+    for (BaseEncoding * const *be = _opt.base_encodings.begin(); be != _opt.base_encodings.end(); be++)
+        if ((*be)->secondary == secondary && _opt.font_name == base_font_name)
+            return (*be)->font_name;
+    return String();
+}
@@ -0,0 +1,223 @@
+#ifndef OTFTOTFM_CONVERSION_HH
+#define OTFTOTFM_CONVERSION_HH
+#include <efont/otf.hh>
+#include <lcdf/hashmap.hh>
+#include "automatic.hh"
+#include "dvipsencoding.hh"
+class Metrics;
+struct FontInfo;
+class GlyphFilter;
+namespace Efont { namespace OpenType {
+class ScriptList;
+class FeatureList;
+class LayoutSnapshot;
+}}
+
+struct BaseEncoding {
+    String font_name;
+    String secondary;
+    DvipsEncoding encoding;
+};
+
+// ConversionOptions holds everything that controls a conversion.  The
+// otftotfm command line fills one in; a program linking libotftotfm fills
+// in its own.  Glyph filters and base encodings are referenced, not copied,
+// and must outlive every context that uses them.
+struct ConversionOptions {
+
+    ConversionOptions();
+
+    // (script, language system) pairs; empty means latn and the default
+    Vector<Efont::OpenType::Tag> interesting_scripts;
+    Vector<Efont::OpenType::Tag> interesting_features;
+    Vector<Efont::OpenType::Tag> altselector_features;
+    HashMap<Efont::OpenType::Tag, GlyphFilter *> feature_filters;
+    HashMap<Efont::OpenType::Tag, GlyphFilter *> altselector_feature_filters;
+    Vector<BaseEncoding *> base_encodings;
+
+    String font_name;           // derived from the font if empty
+    String encoding_file;       // empty means the font's built-in encoding
+    String out_encoding_file;   // --output-encoding
+
+    // how ConversionContext::make_encoding() reads encoding_file
+    bool literal_encoding;      // use encoding_file verbatim
+    bool warn_no_encoding;      // warn when using the built-in encoding
+    bool no_encoding_commands;  // ignore LIGKERN/UNICODING in encoding_file
+    bool default_ligkern;
+    Vector<String> ligkern;     // extra LIGKERN commands
+    Vector<String> position;    // extra POSITION commands
+    Vector<String> unicoding;   // extra UNICODING commands
+    String coding_scheme;
+    int warn_missing;           // < 0 means the encoding file decides
+
+    double extend;
+    double slant;
+    int letterspace;
+    double design_size;         // read from the font if <= 0
+    double minimum_kern;
+    double space_factor;
+    bool math_spacing;
+    int skew_char;
+    bool override_is_fixed_pitch;
+    bool is_fixed_pitch;
+    bool override_italic_angle;
+    double italic_angle;
+    int override_x_height;
+    double x_height;
+
+    unsigned output_flags;      // G_ flags from util.hh
+    bool automatic;
+    bool verbose;
+    bool no_create;
+    bool force;
+
+    // If true, the context collects its output files in outputs() rather
+    // than writing them, never installs fonts, and never runs updmap.
+    bool in_memory;
+
+    String odir[NUMODIR];
+    String vendor;
+    String typeface;
+    String map_file;
+    String layout_cache_dir;
+
+    String invocation;          // recorded in output file comments
+    String current_time;        // " on DATE", or empty
+
+};
+
+struct ConversionOutput {
+    int kind;                   // O_ENCODING, O_TFM, O_PL, O_VF, O_VPL, O_MAP
+    String filename;
+    String data;
+};
+
+// Load the glyph lists that map glyph names to Unicode, which every
+// context shares.  An empty list means the default glyph lists.  Call this
+// before starting any context.
+void load_glyphlists(Vector<String> &filenames, bool verbose, ErrorHandler *);
+
+// Append the base encodings listed in filename to copt.base_encodings.
+void read_base_encodings(const String &filename, ConversionOptions &copt,
+                         ErrorHandler *);
+
+// A ConversionContext converts one font using a private copy of its
+// options.  Contexts share no mutable state, so separate contexts may run
+// on separate threads, with these exceptions: glyph lists (see
+// load_glyphlists) must be loaded first; --profile counters are global;
+// and automatic mode uses kpathsea, which is not reentrant, so at most one
+// automatic-mode context may run at a time.  Errors are reported to the
+// ErrorHandler and returned; no method exits the process.
+class ConversionContext { public:
+
+    ConversionContext(const ConversionOptions &);
+    // default destructor
+
+    const ConversionOptions &options() const    { return _opt; }
+    const Vector<ConversionOutput> &outputs() const { return _outputs; }
+
+    // Parse a font, convert it with the encoding from make_encoding(), and
+    // commit, even if conversion fails.  otf_filename names the font in messages and map lines.
+    // Returns 0 on success and -1 on error.
+    int convert_file(const String &otf_filename, const String &otf_data,
+                     ErrorHandler *errh);
+
+    // Build the input encoding that the options describe.  Returns 0 on
+    // success and < 0 on error.
+    int make_encoding(const String &otf_filename, const Efont::OpenType::Font &otf,
+                      DvipsEncoding &dvipsenc, ErrorHandler *errh) const;
+
+    // Returns 0 on success and < 0 on error.
+    int convert(const String &otf_filename, const Efont::OpenType::Font &otf,
+                const DvipsEncoding &dvipsenc, bool dvipsenc_literal,
+                ErrorHandler *errh);
+
+    // Write queued ls-R and map file changes, and run updmap.  Call this
+    // after convert() whether or not it succeeds, so that files already
+    // installed are registered.
+    void commit(ErrorHandler *errh);
+
+    String installed_metrics_font_name(const String &base_font_name, const String &secondary) const;
+
+    // Write metrics for a font.  The map line downloads font_file, or the
+    // main font if font_file is empty.  Returns 0 on success and < 0 on
+    // error.
+    int output_metrics(Metrics &metrics, const String &ps_name, int boundary_char,
+                       const FontInfo &finfo,
+                       const String &encoding_name, const String &encoding_file,
+                       const String &font_name, const String &font_file,
+                       ErrorHandler *errh);
+
+    // automatic.cc
+    String getodir(int o, ErrorHandler *);
+    void update_odir(int o, String file, ErrorHandler *);
+    String installed_type1(const String &otf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *);
+    String installed_type1_dotlessj(const String &otf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *);
+    String installed_truetype(const String &ttf_filename, bool allow_generate, ErrorHandler *);
+    String installed_type42(const String &ttf_filename, const String &ps_fontname, bool allow_generate, ErrorHandler *);
+    int update_autofont_map(const String &fontname, String mapline, ErrorHandler *);
+
+  private:
+
+    struct Lookup;
+
+    ConversionOptions _opt;
+    String _otf_filename;
+    String _out_encoding_file;
+    String _out_encoding_name;
+    Vector<ConversionOutput> _outputs;
+
+    String _odir_kpathsea[NUMODIR];
+    Vector<String> _pending_lsr_directories;
+    Vector<String> _pending_lsr_files;
+    Vector<String> _pending_map_fonts;
+    Vector<String> _pending_map_lines;
+
+    void add_output(int kind, const String &filename, const String &data);
+    int mysystem(const char *command, ErrorHandler *);
+    FILE *mypopen(const char *command, const char *type, ErrorHandler *);
+    int temporary_file(String &filename, ErrorHandler *);
+
+    double font_slant(const FontInfo &) const;
+    double get_design_size(const FontInfo &) const;
+    int output_pl(Metrics &, const String &ps_name, int boundary_char,
+                  const FontInfo &, bool vpl, const String &filename,
+                  ErrorHandler *);
+    void find_lookups(const Efont::OpenType::ScriptList &,
+                      const Efont::OpenType::FeatureList &,
+                      Vector<Lookup> &, ErrorHandler *) const;
+    int write_encoding_file(String &filename, const String &encoding_name,
+                            StringAccum &contents, ErrorHandler *);
+    bool output_encoding(const Metrics &, const Vector<PermString> &glyph_names,
+                         ErrorHandler *);
+    int output_tfm(Metrics &, const String &ps_name, int boundary_char,
+                   const FontInfo &, String tfm_filename, String vf_filename,
+                   String pl_filename, ErrorHandler *);
+    void report_underused_features(const HashMap<uint32_t, int> &feature_usage,
+                                   ErrorHandler *) const;
+    String main_dvips_map(const String &ps_name, const FontInfo &, ErrorHandler *);
+    Efont::OpenType::LayoutSnapshot load_layout_snapshot(const Efont::OpenType::Font &, ErrorHandler *);
+    void do_gsub(Metrics &, const Efont::OpenType::Font &,
+                 const Efont::OpenType::LayoutSnapshot &,
+                 DvipsEncoding &, bool dvipsenc_literal,
+                 HashMap<uint32_t, int> &feature_usage,
+                 const Vector<PermString> &glyph_names, ErrorHandler *);
+    bool kern_feature_requested() const;
+    void do_try_ttf_kern(Metrics &, const Efont::OpenType::Font &,
+                         HashMap<uint32_t, int> &feature_usage, ErrorHandler *);
+    void do_gpos(Metrics &, const Efont::OpenType::Font &,
+                 const Efont::OpenType::LayoutSnapshot &,
+                 HashMap<uint32_t, int> &feature_usage, ErrorHandler *);
+    void do_math_spacing(Metrics &, const FontInfo &, const DvipsEncoding &) const;
+
+    // automatic.cc
+    String get_vendor() const;
+    String get_typeface() const;
+    bool file_in_kpathsea_odir(int o, const String &file) const;
+    int commit_map_file(bool &changed, ErrorHandler *);
+    void commit_ls_r(ErrorHandler *);
+    void run_updmap(ErrorHandler *);
+
+};
+
+#endif
@@ -0,0 +1,711 @@
+/* daemon.{cc,hh} -- serve otftotfm requests from a long-running process
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include "daemon.hh"
+#include "dvipsencoding.hh"
+#include "util.hh"
+#include <lcdf/error.hh>
+#include <lcdf/parallel.hh>
+#include <lcdf/straccum.hh>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+#ifdef HAVE_FCNTL_H
+# include <fcntl.h>
+#endif
+#if HAVE_SYS_SOCKET_H && HAVE_SYS_UN_H && HAVE_SYS_WAIT_H && !defined(WIN32)
+# define DAEMON_SUPPORTED 1
+# include <sys/socket.h>
+# include <sys/un.h>
+# include <sys/wait.h>
+# include <poll.h>
+// Requests run as the daemon's user, so the daemon must be able to check
+// who its clients are.
+# if !HAVE_GETPEEREID && !defined(SO_PEERCRED)
+#  undef DAEMON_SUPPORTED
+# endif
+#endif
+
+using namespace Efont;
+
+// PROTOCOL
+// The client connects to the daemon's socket and sends a ULONG length
+// followed by that many bytes: its umask in octal, its working directory,
+// its argument count in decimal, its arguments, and its environment
+// variables, each terminated by a null byte.  Its standard input, output,
+// and error descriptors travel with the first byte as SCM_RIGHTS ancillary
+// data.  The request runs with the client's umask, directory, and
+// environment.  When the request finishes, the daemon replies with a ULONG
+// exit status.
+//
+// The socket is created with mode 0600, and the daemon also closes
+// connections from peers whose user ID differs from its own, since a
+// request runs the client's command line and environment as the daemon's
+// user.
+//
+// Each request's child process reads the request, so a slow client holds
+// up only its own request, and writes "R" to a socket pair shared with the
+// daemon.  The daemon answers with a byte when one of its job slots is
+// free, and the child then runs the request.  The child tells the daemon
+// which font and glyph list files it used by writing lines like
+// "F /path/font.otf" to the same socket.  After the request, the daemon
+// loads those files into its caches.
+
+namespace {
+struct CachedFont {
+    String filename;
+    time_t mtime;
+    off_t size;
+    String data;
+    String key;
+    OpenType::LayoutSnapshot snapshot;
+    unsigned last_used;
+};
+
+struct CachedGlyphlist {
+    String filename;
+    time_t mtime;
+    off_t size;
+};
+}
+
+enum { FONT_CACHE_SIZE = 32, MAX_REQUEST = 1 << 20, MAX_NOTE = 4096,
+       MAX_WAITING = 64 };
+
+static Vector<CachedFont> font_cache;
+static unsigned font_cache_clock;
+static Vector<CachedGlyphlist> glyphlist_cache;
+static int notify_fd = -1;
+
+static String
+absolute_filename(const String &filename)
+{
+    if (!filename || filename[0] == '/')
+        return filename;
+    char buf[8192];
+    if (!getcwd(buf, sizeof(buf)))
+        return filename;
+    return String(buf) + "/" + filename;
+}
+
+static bool
+file_unchanged(const String &filename, time_t mtime, off_t size)
+{
+    struct stat st;
+    return stat(filename.c_str(), &st) >= 0
+        && st.st_mtime == mtime && st.st_size == size;
+}
+
+static void
+note_file(char kind, const String &filename)
+{
+    String path = absolute_filename(filename);
+    if (path.length() + 3 <= MAX_NOTE) {
+        StringAccum sa;
+        sa << kind << ' ' << path << '\n';
+        ignore_result(write(notify_fd, sa.data(), sa.length()));
+    }
+}
+
+String
+daemon_font_data(const String &filename)
+{
+    if (notify_fd < 0 || !filename || filename == "-")
+        return String();
+    note_file('F', filename);
+    String path = absolute_filename(filename);
+    for (CachedFont *cf = font_cache.begin(); cf != font_cache.end(); ++cf)
+        if (cf->filename == path && file_unchanged(path, cf->mtime, cf->size))
+            return cf->data;
+    return String();
+}
+
+OpenType::LayoutSnapshot
+daemon_layout_snapshot(const OpenType::Font &otf)
+{
+    if (notify_fd >= 0 && font_cache.size()) {
+        String key = OpenType::LayoutSnapshot::font_key(otf);
+        for (CachedFont *cf = font_cache.begin(); cf != font_cache.end(); ++cf)
+            if (cf->key == key && cf->snapshot.ok())
+                return cf->snapshot;
+    }
+    return OpenType::LayoutSnapshot();
+}
+
+static bool
+glyphlists_match(const Vector<String> &paths)
+{
+    if (paths.size() != glyphlist_cache.size())
+        return false;
+    for (int i = 0; i < paths.size(); ++i)
+        if (glyphlist_cache[i].filename != paths[i]
+            || !file_unchanged(paths[i], glyphlist_cache[i].mtime, glyphlist_cache[i].size))
+            return false;
+    return true;
+}
+
+bool
+daemon_glyphlists_loaded(const Vector<String> &filenames)
+{
+    if (notify_fd < 0)
+        return false;
+    Vector<String> paths;
+    for (const String *f = filenames.begin(); f != filenames.end(); ++f) {
+        note_file('G', *f);
+        paths.push_back(absolute_filename(*f));
+    }
+    if (glyphlists_match(paths))
+        return true;
+    if (glyphlist_cache.size()) {
+        DvipsEncoding::clear_glyphlist();
+        glyphlist_cache.clear();
+    }
+    return false;
+}
+
+
+/*****
+ * daemon side
+ **/
+
+#if DAEMON_SUPPORTED
+
+extern char **environ;
+
+static void
+load_glyphlists(const Vector<String> &paths)
+{
+    if (glyphlists_match(paths))
+        return;
+    DvipsEncoding::clear_glyphlist();
+    glyphlist_cache.clear();
+    for (const String *p = paths.begin(); p != paths.end(); ++p) {
+        struct stat st;
+        if (stat(p->c_str(), &st) < 0)
+            break;
+        if (String s = read_file(*p, ErrorHandler::silent_handler(), true))
+            DvipsEncoding::add_glyphlist(s);
+        CachedGlyphlist g;
+        g.filename = *p;
+        g.mtime = st.st_mtime;
+        g.size = st.st_size;
+        glyphlist_cache.push_back(g);
+    }
+}
+
+static void
+load_font(const String &path)
+{
+    struct stat st;
+    if (stat(path.c_str(), &st) < 0)
+        return;
+
+    // find the font's entry, or the least recently used entry
+    CachedFont *slot = 0;
+    for (CachedFont *cf = font_cache.begin(); cf != font_cache.end(); ++cf)
+        if (cf->filename == path) {
+            slot = cf;
+            break;
+        } else if (!slot || cf->last_used < slot->last_used)
+            slot = cf;
+    if (slot && slot->filename == path
+        && slot->mtime == st.st_mtime && slot->size == st.st_size) {
+        slot->last_used = ++font_cache_clock;
+        return;
+    }
+    if (!slot || (slot->filename != path && font_cache.size() < FONT_CACHE_SIZE)) {
+        font_cache.push_back(CachedFont());
+        slot = &font_cache.back();
+    }
+
+    slot->filename = path;
+    slot->mtime = st.st_mtime;
+    slot->size = st.st_size;
+    slot->data = read_file(path, ErrorHandler::silent_handler(), true);
+    slot->key = String();
+    slot->snapshot = OpenType::LayoutSnapshot();
+    slot->last_used = ++font_cache_clock;
+
+    OpenType::Font otf(slot->data);
+    if (otf.ok())
+        try {
+            SilentErrorHandler serrh;
+            slot->key = OpenType::LayoutSnapshot::font_key(otf);
+            slot->snapshot = OpenType::LayoutSnapshot(OpenType::LayoutSnapshot::make(otf, &serrh), slot->key);
+        } catch (OpenType::Error) {
+        }
+}
+
+static void
+process_notes(const String &notes)
+{
+    Vector<String> glyphlists;
+    String font;
+    const char *s = notes.begin(), *end = notes.end();
+    while (s + 2 < end) {
+        const char *nl = s;
+        while (nl != end && *nl != '\n')
+            ++nl;
+        if (nl == end)
+            break;
+        if (s[0] == 'G' && s[1] == ' ')
+            glyphlists.push_back(notes.substring(s + 2, nl));
+        else if (s[0] == 'F' && s[1] == ' ')
+            font = notes.substring(s + 2, nl);
+        s = nl + 1;
+    }
+    if (glyphlists.size())
+        load_glyphlists(glyphlists);
+    if (font)
+        load_font(font);
+}
+
+static bool
+read_fully(int fd, char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t r = read(fd, buf, len);
+        if (r > 0) {
+            buf += r;
+            len -= r;
+        } else if (r == 0 || errno != EINTR)
+            return false;
+    }
+    return true;
+}
+
+static bool
+write_fully(int fd, const char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t w = write(fd, buf, len);
+        if (w > 0) {
+            buf += w;
+            len -= w;
+        } else if (w == 0 || errno != EINTR)
+            return false;
+    }
+    return true;
+}
+
+static void
+encode_u32(char *buf, uint32_t x)
+{
+    buf[0] = x >> 24;
+    buf[1] = x >> 16;
+    buf[2] = x >> 8;
+    buf[3] = x;
+}
+
+static uint32_t
+decode_u32(const char *buf)
+{
+    const unsigned char *ubuf = reinterpret_cast<const unsigned char *>(buf);
+    return (ubuf[0] << 24) | (ubuf[1] << 16) | (ubuf[2] << 8) | ubuf[3];
+}
+
+namespace {
+struct RequestData {
+    mode_t umask;
+    Vector<String> args;        // working directory, then arguments
+    Vector<String> env;
+};
+}
+
+static bool
+read_request(int fd, int fds[3], RequestData &rd)
+{
+    char header[4];
+    struct iovec iov;
+    iov.iov_base = header;
+    iov.iov_len = sizeof(header);
+    union {
+        struct cmsghdr h;
+        char buf[CMSG_SPACE(3 * sizeof(int))];
+    } control;
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    ssize_t r;
+    while ((r = recvmsg(fd, &msg, 0)) < 0 && errno == EINTR)
+        /* try again */;
+    struct cmsghdr *cmsg = (r > 0 ? CMSG_FIRSTHDR(&msg) : 0);
+    if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS
+        || cmsg->cmsg_len != CMSG_LEN(3 * sizeof(int)))
+        return false;
+    memcpy(fds, CMSG_DATA(cmsg), 3 * sizeof(int));
+
+    uint32_t len;
+    String payload;
+    Vector<String> fields;
+    char *end;
+    long nargs;
+    if (!read_fully(fd, header + r, sizeof(header) - r)
+        || (len = decode_u32(header)) == 0 || len > MAX_REQUEST)
+        goto fail;
+    payload = String::make_uninitialized(len);
+    if (!read_fully(fd, payload.mutable_data(), len) || payload.back() != 0)
+        goto fail;
+
+    for (const char *s = payload.begin(); s != payload.end(); ) {
+        const char *t = s + strlen(s);
+        fields.push_back(payload.substring(s, t));
+        s = t + 1;
+    }
+    if (fields.size() < 4)
+        goto fail;
+    rd.umask = (mode_t) strtol(fields[0].c_str(), &end, 8);
+    if (*end || !fields[0])
+        goto fail;
+    nargs = strtol(fields[2].c_str(), &end, 10);
+    if (*end || !fields[2] || nargs < 1 || nargs > fields.size() - 3)
+        goto fail;
+    rd.args.push_back(fields[1]);
+    for (int i = 3; i < fields.size(); ++i)
+        if (i < 3 + nargs)
+            rd.args.push_back(fields[i]);
+        else
+            rd.env.push_back(fields[i]);
+    return true;
+
+  fail:
+    for (int i = 0; i < 3; ++i)
+        close(fds[i]);
+    return false;
+}
+
+namespace {
+struct Request {
+    pid_t pid;
+    int client_fd;
+    int notify_fd;
+    int state;
+    String notes;
+    enum { READING, READY, RUNNING };
+};
+}
+
+static bool
+peer_is_self(int fd)
+{
+#if HAVE_GETPEEREID
+    uid_t uid;
+    gid_t gid;
+    return getpeereid(fd, &uid, &gid) >= 0 && uid == geteuid();
+#else
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    return getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) >= 0
+        && len == sizeof(cred) && cred.uid == geteuid();
+#endif
+}
+
+static void
+start_request(int listen_fd, int client_fd, Vector<Request> &running,
+              DaemonMain main_function)
+{
+    int p[2];
+    if (!peer_is_self(client_fd) || socketpair(AF_UNIX, SOCK_STREAM, 0, p) < 0) {
+        close(client_fd);
+        return;
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(listen_fd);
+        close(p[0]);
+        for (Request *r = running.begin(); r != running.end(); ++r) {
+            close(r->client_fd);
+            close(r->notify_fd);
+        }
+        signal(SIGPIPE, SIG_DFL);
+        fcntl(p[1], F_SETFD, FD_CLOEXEC);
+        notify_fd = p[1];
+
+        // Read the request here rather than in the daemon, so a slow
+        // client delays only its own request.  Then tell the daemon the
+        // request is ready and wait for one of its job slots.
+        struct timeval tv;
+        tv.tv_sec = 10;
+        tv.tv_usec = 0;
+        setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        int fds[3];
+        RequestData rd;
+        Vector<String> &args = rd.args;
+        char go;
+        if (!read_request(client_fd, fds, rd))
+            _exit(1);
+        close(client_fd);
+        if (!write_fully(notify_fd, "R\n", 2)
+            || !read_fully(notify_fd, &go, 1))
+            _exit(1);
+        for (int i = 0; i < 3; ++i)
+            if (fds[i] != i) {
+                dup2(fds[i], i);
+                if (fds[i] > 2)
+                    close(fds[i]);
+            }
+        if (chdir(args[0].c_str()) < 0) {
+            fprintf(stderr, "otftotfm: %s: %s\n", args[0].c_str(), strerror(errno));
+            _exit(1);
+        }
+        umask(rd.umask);
+        Vector<char *> envp;
+        for (String *e = rd.env.begin(); e != rd.env.end(); ++e)
+            envp.push_back(e->mutable_c_str());
+        envp.push_back(0);
+        environ = envp.begin();
+        Vector<char *> argv;
+        for (String *a = args.begin() + 1; a != args.end(); ++a)
+            argv.push_back(a->mutable_c_str());
+        argv.push_back(0);
+        exit(main_function(argv.size() - 1, argv.begin()));
+    }
+
+    close(p[1]);
+    if (pid < 0) {
+        char status[4];
+        encode_u32(status, 1);
+        ignore_result(write_fully(client_fd, status, sizeof(status)));
+        close(client_fd);
+        close(p[0]);
+        return;
+    }
+
+    Request r;
+    r.pid = pid;
+    r.client_fd = client_fd;
+    r.notify_fd = p[0];
+    r.state = Request::READING;
+    running.push_back(r);
+}
+
+static void
+finish_request(Request &r)
+{
+    int status;
+    while (waitpid(r.pid, &status, 0) < 0 && errno == EINTR)
+        /* try again */;
+    char buf[4];
+    encode_u32(buf, WIFEXITED(status) ? WEXITSTATUS(status) : 1);
+    ignore_result(write_fully(r.client_fd, buf, sizeof(buf)));
+    close(r.client_fd);
+    close(r.notify_fd);
+    process_notes(r.notes);
+}
+
+int
+run_daemon(const String &path, DaemonMain main_function, ErrorHandler *errh)
+{
+    struct sockaddr_un sa;
+    if (path.length() >= (int) sizeof(sa.sun_path))
+        return errh->error("%s: socket name too long", path.c_str());
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    memcpy(sa.sun_path, path.data(), path.length());
+
+    // remove a stale socket
+    struct stat st;
+    if (lstat(path.c_str(), &st) >= 0 && S_ISSOCK(st.st_mode))
+        unlink(path.c_str());
+
+    // only our own user may connect, whatever the umask
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    int bound = -1;
+    if (listen_fd >= 0) {
+        mode_t old_umask = umask(077);
+        bound = bind(listen_fd, reinterpret_cast<struct sockaddr *>(&sa), sizeof(sa));
+        umask(old_umask);
+    }
+    if (bound < 0
+        || chmod(path.c_str(), 0600) < 0
+        || listen(listen_fd, 64) < 0)
+        return errh->error("%s: %s", path.c_str(), strerror(errno));
+    fcntl(listen_fd, F_SETFD, FD_CLOEXEC);
+    signal(SIGPIPE, SIG_IGN);
+
+    int jobs = (parallel_jobs > 0 ? parallel_jobs : default_parallel_jobs());
+    Vector<Request> running;
+    Vector<struct pollfd> pfds;
+    while (1) {
+        pfds.clear();
+        for (Request *r = running.begin(); r != running.end(); ++r) {
+            struct pollfd pfd;
+            pfd.fd = r->notify_fd;
+            pfd.events = POLLIN;
+            pfds.push_back(pfd);
+        }
+        if (running.size() < jobs + MAX_WAITING) {
+            struct pollfd pfd;
+            pfd.fd = listen_fd;
+            pfd.events = POLLIN;
+            pfds.push_back(pfd);
+        }
+
+        if (poll(pfds.begin(), pfds.size(), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            return errh->error("%s", strerror(errno));
+        }
+
+        // collect notes from requests; a closed socket means the request is
+        // done
+        for (int i = running.size() - 1; i >= 0; --i)
+            if (pfds[i].revents) {
+                char buf[4096];
+                ssize_t n = read(running[i].notify_fd, buf, sizeof(buf));
+                if (n > 0)
+                    running[i].notes += String(buf, n);
+                else if (n == 0 || errno != EINTR) {
+                    finish_request(running[i]);
+                    running[i] = running.back();
+                    running.pop_back();
+                }
+            }
+
+        // start requests whose children have read them, up to jobs at once
+        int nrunning = 0;
+        for (Request *r = running.begin(); r != running.end(); ++r)
+            if (r->state == Request::READING && r->notes.length() >= 2) {
+                r->notes = r->notes.substring(2);
+                r->state = Request::READY;
+            } else if (r->state == Request::RUNNING)
+                ++nrunning;
+        for (Request *r = running.begin(); r != running.end() && nrunning < jobs; ++r)
+            if (r->state == Request::READY) {
+                ignore_result(write_fully(r->notify_fd, "g", 1));
+                r->state = Request::RUNNING;
+                ++nrunning;
+            }
+
+        if (pfds.size() > running.size() && pfds.back().fd == listen_fd
+            && (pfds.back().revents & POLLIN)) {
+            int client_fd = accept(listen_fd, 0, 0);
+            if (client_fd >= 0) {
+                fcntl(client_fd, F_SETFD, FD_CLOEXEC);
+                start_request(listen_fd, client_fd, running, main_function);
+            }
+        }
+    }
+}
+
+int
+run_daemon_client(const char *path, int argc, char *argv[], ErrorHandler *errh)
+{
+    struct sockaddr_un sa;
+    if (strlen(path) >= sizeof(sa.sun_path))
+        return -1;
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    strcpy(sa.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return -1;
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&sa), sizeof(sa)) < 0) {
+        close(fd);
+        return -1;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    StringAccum payload;
+    char cwd[8192];
+    if (!getcwd(cwd, sizeof(cwd))) {
+        close(fd);
+        return -1;
+    }
+    mode_t mask = umask(0);
+    umask(mask);
+    char buf[40];
+    sprintf(buf, "%o", (unsigned) mask);
+    payload << buf << '\0' << cwd << '\0' << argc << '\0';
+    for (int i = 0; i < argc; ++i)
+        payload << argv[i] << '\0';
+    for (char **e = environ; *e; ++e)
+        payload << *e << '\0';
+
+    char header[4];
+    encode_u32(header, payload.length());
+    struct iovec iov;
+    iov.iov_base = header;
+    iov.iov_len = sizeof(header);
+    union {
+        struct cmsghdr h;
+        char buf[CMSG_SPACE(3 * sizeof(int))];
+    } control;
+    memset(&control, 0, sizeof(control));
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(3 * sizeof(int));
+    int fds[3] = { 0, 1, 2 };
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    // Flush our own output first; the daemon writes to the same files.
+    fflush(stdout);
+    fflush(stderr);
+    ssize_t w;
+    while ((w = sendmsg(fd, &msg, 0)) < 0 && errno == EINTR)
+        /* try again */;
+    char status[4];
+    if (w < 0) {
+        close(fd);
+        return -1;
+    } else if (!write_fully(fd, header + w, sizeof(header) - w)
+               || !write_fully(fd, payload.data(), payload.length())
+               || !read_fully(fd, status, sizeof(status))) {
+        close(fd);
+        errh->error("%s: lost connection to daemon", path);
+        return 1;
+    }
+    close(fd);
+    return decode_u32(status);
+}
+
+#else /* !DAEMON_SUPPORTED */
+
+int
+run_daemon(const String &, DaemonMain, ErrorHandler *errh)
+{
+    return errh->error("daemon mode is not supported on this system");
+}
+
+int
+run_daemon_client(const char *, int, char *[], ErrorHandler *)
+{
+    return -1;
+}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef OTFTOTFM_DAEMON_HH
+#define OTFTOTFM_DAEMON_HH
+#include <efont/otflayout.hh>
+class ErrorHandler;
+
+typedef int (*DaemonMain)(int argc, char *argv[]);
+
+// Serves otftotfm requests on the Unix domain socket at path until killed.
+// Each request runs main_function in a child process forked from the
+// daemon, with the client's arguments, working directory, and standard
+// file descriptors, so requests never see each other's state.  The daemon
+// keeps recently used fonts, their layout snapshots, and the glyph lists
+// in memory, where forked children find them already parsed.  At most
+// parallel_jobs requests, or one per processor if it is 0, run at once.
+int run_daemon(const String &path, DaemonMain main_function, ErrorHandler *errh);
+
+// Forwards a command line to the daemon at path and returns the request's
+// exit status, or -1 if no daemon is listening there.
+int run_daemon_client(const char *path, int argc, char *argv[], ErrorHandler *errh);
+
+// In a request run by the daemon, return the cached contents of a font
+// file, or a null string if the font is not cached or has changed.  The
+// daemon caches the font after the request.  Outside the daemon, returns a
+// null string.
+String daemon_font_data(const String &filename);
+
+// Return the daemon's cached layout snapshot for otf, if any.
+Efont::OpenType::LayoutSnapshot daemon_layout_snapshot(const Efont::OpenType::Font &otf);
+
+// Return true if the daemon has already loaded exactly these glyph list
+// files, in this order.  Otherwise, forget any glyph lists the daemon
+// loaded, so the caller can load its own.
+bool daemon_glyphlists_loaded(const Vector<String> &filenames);
+
+#endif
@@ -104,6 +104,13 @@ DvipsEncoding::add_glyphlist(String text)
     }
 }
 
+void
+DvipsEncoding::clear_glyphlist()
+{
+    glyphlist.clear();
+    glyphmap.clear();
+}
+
 static void
 unicode_add_suffix(Vector<uint32_t> &prefix,
                    int prefix_starting_from,
@@ -770,6 +777,10 @@ DvipsEncoding::x_unicodes(PermString chname, Vector<uint32_t> &unicodes) const
 void
 DvipsEncoding::make_metrics(Metrics &metrics, const FontInfo &finfo, Secondary *secondary, bool literal, ErrorHandler *errh)
 {
+    // resolve every glyph name at once
+    Vector<int> named_glyphs;
+    finfo.glyphids(_e, named_glyphs);
+
     // first pass: without secondaries
     for (int code = 0; code < _e.size(); code++) {
         PermString chname = _e[code];
@@ -801,7 +812,7 @@ DvipsEncoding::make_metrics(Metrics &metrics, const FontInfo &finfo, Secondary *
         }
 
         // find named glyph, if any
-        Efont::OpenType::Glyph named_glyph = finfo.glyphid(chname);
+        Efont::OpenType::Glyph named_glyph = named_glyphs[code];
 #if 0
         // 2.May.2008: ff, fi, fl, ffi, and ffl might map to f_f, f_i, f_l,
         // f_f_i, and f_f_l
@@ -846,7 +857,7 @@ DvipsEncoding::make_metrics(Metrics &metrics, const FontInfo &finfo, Secondary *
         bool unicodes_explicit = x_unicodes(chname, unicodes);
 
         // find named glyph, if any
-        Efont::OpenType::Glyph named_glyph = finfo.glyphid(chname);
+        Efont::OpenType::Glyph named_glyph = named_glyphs[code];
 
         // 1. We were not able to find the glyph using Unicode.
         // 2. There might be a named_glyph.
@@ -919,6 +930,8 @@ void
 DvipsEncoding::make_base_mappings(Vector<int> &mappings, const FontInfo &finfo)
 {
     mappings.clear();
+    Vector<int> named_glyphs;
+    finfo.glyphids(_e, named_glyphs);
     for (int code = 0; code < _e.size(); code++) {
         PermString chname = _e[code];
 
@@ -927,7 +940,7 @@ DvipsEncoding::make_base_mappings(Vector<int> &mappings, const FontInfo &finfo)
             continue;
 
         // find named glyph
-        Efont::OpenType::Glyph named_glyph = finfo.glyphid(chname);
+        Efont::OpenType::Glyph named_glyph = named_glyphs[code];
         if (named_glyph > 0) {
             if (mappings.size() <= named_glyph)
                 mappings.resize(named_glyph + 1, -1);
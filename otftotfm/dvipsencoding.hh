@@ -12,6 +12,7 @@ class DvipsEncoding { public:
     DvipsEncoding();
 
     static void add_glyphlist(String);
+    static void clear_glyphlist();
 
     operator bool() const                       { return _e.size() > 0; }
     const String &name() const                  { return _name; }
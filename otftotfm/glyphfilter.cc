@@ -25,49 +25,114 @@
 #include "uniprop.hh"
 #include "util.hh"
 
-bool
-GlyphFilter::allow(Efont::OpenType::Glyph glyph, const Vector<PermString>& glyph_names, uint32_t unicode, int ptype) const
+CompiledGlyphFilter::CompiledGlyphFilter(const GlyphFilter& filter, const Vector<PermString>& glyph_names)
+    : _filter(&filter), _nglyphs(glyph_names.size()), _name_words(0),
+      _unicode_dependent(0)
 {
-    // out-of-range glyphs never match
-    if (glyph < 0 || glyph >= glyph_names.size())
-        return false;
+    typedef GlyphFilter::Pattern Pattern;
+    const Vector<Pattern>& patterns = filter._patterns;
+    if (!patterns.size())
+        return;
+
+    int nname = 0;
+    for (const Pattern* p = patterns.begin(); p < patterns.end(); p++)
+        if (p->data == GlyphFilter::D_NAME)
+            nname++;
+        else
+            _unicode_dependent |= 1 << (p->type & GlyphFilter::T_DST ? 2 : 0);
+    _name_words = (nname + 31) >> 5;
 
-    String glyph_name = glyph_names[glyph];
+    // match every glyph name against every name pattern exactly once
+    _name_matches.assign(_nglyphs * _name_words, 0);
+    if (nname) {
+        uint32_t* matches = _name_matches.begin();
+        for (int g = 0; g < _nglyphs; g++, matches += _name_words) {
+            String glyph_name = glyph_names[g];
+            int i = 0;
+            for (const Pattern* p = patterns.begin(); p < patterns.end(); p++)
+                if (p->data == GlyphFilter::D_NAME) {
+                    if (glob_match(glyph_name, p->pattern))
+                        matches[i >> 5] |= 1U << (i & 31);
+                    i++;
+                }
+        }
+    }
+
+    // decide every glyph for filter types that ignore the Unicode value
+    _decisions.assign(_nglyphs, 0);
+    for (int shift = 0; shift <= 2; shift += 2)
+        if (!(_unicode_dependent & (1 << shift))) {
+            int ptype = (shift ? GlyphFilter::T_DST : GlyphFilter::T_SRC);
+            for (int g = 0; g < _nglyphs; g++)
+                _decisions[g] |= (evaluate(g, 0, ptype) ? D_KNOWN | D_ALLOW : D_KNOWN) << shift;
+        }
+}
+
+bool
+CompiledGlyphFilter::evaluate(Efont::OpenType::Glyph glyph, uint32_t unicode, int ptype) const
+{
+    typedef GlyphFilter::Pattern Pattern;
+    const Vector<Pattern>& patterns = _filter->_patterns;
+    const uint32_t* name_matches = _name_matches.begin() + glyph * _name_words;
+    int name_index = 0;
     int uniprop = -1;
     bool any_includes = false;
     bool included = false;
+    bool excluded = false;
 
     // loop over patterns
-    for (const Pattern* p = _patterns.begin(); p < _patterns.end(); p++) {
+    for (const Pattern* p = patterns.begin(); p < patterns.end(); p++) {
+        int this_name_index = name_index;
+        if (p->data == GlyphFilter::D_NAME)
+            name_index++;
         // check pattern type
-        if ((p->type & ~T_TYPEMASK) != ptype)
+        if ((p->type & ~GlyphFilter::T_TYPEMASK) != ptype)
             continue;
         // check include/exclude
-        if ((p->type & T_EXCLUDE) == 0) {
+        if ((p->type & GlyphFilter::T_EXCLUDE) == 0) {
             if (included)
                 continue;
             any_includes = true;
         }
         // check if there's a match
         bool match;
-        if (p->data == D_NAME)
-            match = glob_match(glyph_name, p->pattern);
-        else if (p->data == D_UNIPROP) {
+        if (p->data == GlyphFilter::D_NAME)
+            match = (name_matches[this_name_index >> 5] & (1U << (this_name_index & 31))) != 0;
+        else if (p->data == GlyphFilter::D_UNIPROP) {
             if (uniprop < 0)
                 uniprop = UnicodeProperty::property(unicode);
             match = ((uniprop & p->u.uniprop.mask) == p->u.uniprop.value);
         } else
             match = (unicode >= p->u.unirange.low && unicode <= p->u.unirange.high);
         // act if match
-        if (match == ((p->type & T_NEGATE) == 0)) {
-            if ((p->type & T_EXCLUDE) == 0)
+        if (match == ((p->type & GlyphFilter::T_NEGATE) == 0)) {
+            if ((p->type & GlyphFilter::T_EXCLUDE) == 0)
                 included = true;
-            else
-                return false;
+            else {
+                excluded = true;
+                break;
+            }
         }
     }
 
-    return !any_includes || included;
+    return !excluded && (!any_includes || included);
+}
+
+CompiledGlyphFilterSet::~CompiledGlyphFilterSet()
+{
+    for (int i = 0; i < _compiled.size(); i++)
+        delete _compiled[i];
+}
+
+const CompiledGlyphFilter&
+CompiledGlyphFilterSet::operator[](const GlyphFilter* filter)
+{
+    // a font uses few distinct filters
+    for (int i = 0; i < _compiled.size(); i++)
+        if (&_compiled[i]->filter() == filter)
+            return *_compiled[i];
+    _compiled.push_back(new CompiledGlyphFilter(*filter, _glyph_names));
+    return *_compiled.back();
 }
 
 GlyphFilter::Pattern::Pattern(uint16_t ptype)
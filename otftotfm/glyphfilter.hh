@@ -3,6 +3,7 @@
 #include <efont/otf.hh>
 #include <lcdf/vector.hh>
 class Metrics;
+class CompiledGlyphFilter;
 
 class GlyphFilter { public:
 
@@ -10,9 +11,6 @@ class GlyphFilter { public:
 
     operator bool() const               { return _patterns.size() != 0; }
 
-    inline bool allow_substitution(Efont::OpenType::Glyph glyph, const Vector<PermString>& glyph_names, uint32_t unicode) const;
-    inline bool allow_alternate(Efont::OpenType::Glyph glyph, const Vector<PermString>& glyph_names, uint32_t unicode) const;
-
     void add_substitution_filter(const String&, bool is_exclude, ErrorHandler*);
     void add_alternate_filter(const String&, bool is_exclude, ErrorHandler*);
 
@@ -50,22 +48,86 @@ class GlyphFilter { public:
     Vector<Pattern> _patterns;
     bool _sorted;
 
-    bool allow(Efont::OpenType::Glyph glyph, const Vector<PermString>& glyph_names, uint32_t unicode, int ptype) const;
     void add_pattern(const String&, int ptype, ErrorHandler*);
     void sort();
 
+    friend class CompiledGlyphFilter;
+
+};
+
+// A GlyphFilter compiled against one font's glyph names.  Every glyph name
+// is matched against every name pattern once, and each glyph's decision is
+// computed up front for filter types that do not depend on the Unicode
+// value.  A compiled filter never changes after construction, and refers
+// to its GlyphFilter, which must outlive it.
+class CompiledGlyphFilter { public:
+
+    CompiledGlyphFilter(const GlyphFilter&, const Vector<PermString>& glyph_names);
+
+    const GlyphFilter& filter() const   { return *_filter; }
+
+    inline bool allow_substitution(Efont::OpenType::Glyph glyph, uint32_t unicode) const;
+    inline bool allow_alternate(Efont::OpenType::Glyph glyph, uint32_t unicode) const;
+
+  private:
+
+    enum { D_KNOWN = 1, D_ALLOW = 2 };
+
+    const GlyphFilter* _filter;
+    int _nglyphs;
+    int _name_words;
+    int _unicode_dependent;
+    Vector<uint32_t> _name_matches;     // one bit per (glyph, name pattern)
+    Vector<uint8_t> _decisions;         // D_ flags, shifted by ptype
+
+    inline bool allow(Efont::OpenType::Glyph glyph, uint32_t unicode, int ptype) const;
+    bool evaluate(Efont::OpenType::Glyph glyph, uint32_t unicode, int ptype) const;
+
 };
 
+// The compiled forms of the GlyphFilters used with one font, each compiled
+// the first time it is requested.
+class CompiledGlyphFilterSet { public:
+
+    explicit CompiledGlyphFilterSet(const Vector<PermString>& glyph_names)
+        : _glyph_names(glyph_names) { }
+    ~CompiledGlyphFilterSet();
+
+    const CompiledGlyphFilter& operator[](const GlyphFilter*);
+
+  private:
+
+    const Vector<PermString>& _glyph_names;
+    Vector<CompiledGlyphFilter*> _compiled;
+
+    CompiledGlyphFilterSet(const CompiledGlyphFilterSet&);
+    CompiledGlyphFilterSet& operator=(const CompiledGlyphFilterSet&);
+
+};
+
+inline bool
+CompiledGlyphFilter::allow(Efont::OpenType::Glyph glyph, uint32_t unicode, int ptype) const
+{
+    // out-of-range glyphs never match
+    if (glyph < 0 || glyph >= _nglyphs)
+        return false;
+    int shift = (ptype == GlyphFilter::T_DST ? 2 : 0);
+    int decision = _decisions[glyph] >> shift;
+    if (decision & D_KNOWN)
+        return decision & D_ALLOW;
+    return evaluate(glyph, unicode, ptype);
+}
+
 inline bool
-GlyphFilter::allow_substitution(Efont::OpenType::Glyph glyph, const Vector<PermString>& glyph_names, uint32_t unicode) const
+CompiledGlyphFilter::allow_substitution(Efont::OpenType::Glyph glyph, uint32_t unicode) const
 {
-    return (!_patterns.size() || allow(glyph, glyph_names, unicode, T_SRC));
+    return (!_filter->_patterns.size() || allow(glyph, unicode, GlyphFilter::T_SRC));
 }
 
 inline bool
-GlyphFilter::allow_alternate(Efont::OpenType::Glyph glyph, const Vector<PermString>& glyph_names, uint32_t unicode) const
+CompiledGlyphFilter::allow_alternate(Efont::OpenType::Glyph glyph, uint32_t unicode) const
 {
-    return (!_patterns.size() || allow(glyph, glyph_names, unicode, T_DST));
+    return (!_filter->_patterns.size() || allow(glyph, unicode, GlyphFilter::T_DST));
 }
 
 inline bool operator==(const GlyphFilter::Pattern& a, const GlyphFilter::Pattern& b)
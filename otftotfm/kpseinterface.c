@@ -22,6 +22,7 @@
 #include <kpathsea/c-pathch.h>
 #include <kpathsea/tex-file.h>
 #include <kpathsea/variable.h>
+#include <kpathsea/db.h>
 #include "kpseinterface.h"
 
 int kpsei_env_sep_char = ENV_SEP;
@@ -88,6 +89,25 @@ kpsei_find_file(const char* name, int format)
     }
 }
 
+void
+kpsei_prefetch(void)
+{
+    /* load ls-R databases and search paths now, rather than on first use */
+    kpse_init_db();
+    kpse_init_format(kpse_web2c_format);
+#if HAVE_DECL_KPSE_ENC_FORMAT
+    kpse_init_format(kpse_enc_format);
+#endif
+    kpse_init_format(kpse_tex_ps_header_format);
+    kpse_init_format(kpse_type1_format);
+    kpse_init_format(kpse_type42_format);
+    kpse_init_format(kpse_truetype_format);
+#if HAVE_DECL_KPSE_OPENTYPE_FORMAT
+    kpse_init_format(kpse_opentype_format);
+#endif
+    kpse_init_format(kpse_fontmap_format);
+}
+
 void
 kpsei_set_debug_flags(unsigned flags)
 {
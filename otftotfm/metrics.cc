@@ -26,7 +26,7 @@
 Metrics::Metrics(const Efont::CharstringProgram *font, int nglyphs)
     : _boundary_glyph(nglyphs), _emptyslot_glyph(nglyphs + 1),
       _design_units(1000), _units_per_em(font->units_per_em()),
-      _liveness_marked(false)
+      _letterspace(0), _liveness_marked(false)
 {
     _encoding.assign(256, Char());
     add_mapped_font(font, String());
@@ -580,8 +580,7 @@ Metrics::ChangedContext::disallow_pair(Code c1, Code c2)
 
 void
 Metrics::apply_single(Code cin, const Substitution *s, int lookup,
-                ChangedContext &ctx, const GlyphFilter &glyph_filter,
-                const Vector<PermString> &glyph_names)
+                ChangedContext &ctx, const CompiledGlyphFilter &glyph_filter)
 {
     // check if encoded
     if (!ctx.allowed(cin, false))
@@ -590,13 +589,13 @@ Metrics::apply_single(Code cin, const Substitution *s, int lookup,
         return;
 
     // check if substitution of this code allowed
-    if (!glyph_filter.allow_substitution(s->in_glyph(), glyph_names, unicode(cin)))
+    if (!glyph_filter.allow_substitution(s->in_glyph(), unicode(cin)))
         return;
 
     // look for an allowed alternate
     Glyph out = -1;
     for (int i = 0; out < 0 && i < s->out_nglyphs(); i++)
-        if (glyph_filter.allow_alternate(s->out_glyph(i), glyph_names, unicode(cin)))
+        if (glyph_filter.allow_alternate(s->out_glyph(i), unicode(cin)))
             out = s->out_glyph(i);
     if (out < 0)                // no allowed alternate
         return;
@@ -633,14 +632,16 @@ Metrics::apply_ligature(const Vector<Code> &in, const Substitution *s, int looku
         cin1 = pair_code(cin1, *inp, lookup);
     int cin2 = in.back();
 
-    // build up the output character
-    Vector<Code> out;
-    s->all_out_glyphs(out);
+    // build up the output character from the left context, output, and
+    // right context glyphs
+    const Glyph *outp[3] = { s->left_glyphptr(), s->out_glyphptr(), s->right_glyphptr() };
+    int nout[3] = { s->left_nglyphs(), s->out_nglyphs(), s->right_nglyphs() };
     int cout = -1;
-    for (Glyph *outp = out.begin(); outp < out.end(); outp++) {
-        *outp = force_encoding(*outp, lookup);
-        cout = (cout < 0 ? *outp : pair_code(cout, *outp, lookup));
-    }
+    for (int part = 0; part < 3; part++)
+        for (int i = 0; i < nout[part]; i++) {
+            Code c = force_encoding(outp[part][i], lookup);
+            cout = (cout < 0 ? c : pair_code(cout, c, lookup));
+        }
     _encoding[cout].flags &= ~Char::INTERMEDIATE;
 
     // check for replacing a fake ligature
@@ -668,8 +669,7 @@ Metrics::apply_ligature(const Vector<Code> &in, const Substitution *s, int looku
 void
 Metrics::apply_simple_context_ligature(const Vector<Code> &codes,
              const Substitution *s, int lookup, ChangedContext &ctx,
-             const GlyphFilter &glyph_filter,
-             const Vector<PermString>& glyph_names)
+             const CompiledGlyphFilter &glyph_filter)
 {
     int nleft = s->left_nglyphs(), nin = s->in_nglyphs();
     assert(codes.size() >= 2);
@@ -677,7 +677,7 @@ Metrics::apply_simple_context_ligature(const Vector<Code> &codes,
     // check if context allows substitutions
     for (int i = 0; i < codes.size(); ++i) {
         if (!ctx.allowed(codes[i], i < nleft)
-            || !glyph_filter.allow_substitution(s->in_glyph(i), glyph_names, unicode(codes[i])))
+            || !glyph_filter.allow_substitution(s->in_glyph(i), unicode(codes[i])))
             return;
     }
 
@@ -717,7 +717,7 @@ Metrics::next_encoding(Vector<Code> &codes, const Vector<Glyph> &glyphs) const
 }
 
 int
-Metrics::apply(const Vector<Substitution>& sv, bool allow_single, int lookup, const GlyphFilter& glyph_filter, const Vector<PermString>& glyph_names)
+Metrics::apply(const Vector<Substitution>& sv, bool allow_single, int lookup, const CompiledGlyphFilter& glyph_filter)
 {
     Vector<Glyph> glyphs;
     Vector<Code> codes;
@@ -736,9 +736,9 @@ Metrics::apply(const Vector<Substitution>& sv, bool allow_single, int lookup, co
             s->all_in_glyphs(glyphs);
             for (codes.clear(); next_encoding(codes, glyphs); ) {
                 if (is_apply_single)
-                    apply_single(codes[0], s, lookup, ctx, glyph_filter, glyph_names);
+                    apply_single(codes[0], s, lookup, ctx, glyph_filter);
                 else
-                    apply_simple_context_ligature(codes, s, lookup, ctx, glyph_filter, glyph_names);
+                    apply_simple_context_ligature(codes, s, lookup, ctx, glyph_filter);
             }
         } else
             failures++;
@@ -749,15 +749,14 @@ Metrics::apply(const Vector<Substitution>& sv, bool allow_single, int lookup, co
 
 void
 Metrics::apply_alternates_single(Code cin, const Substitution *s, int lookup,
-                const GlyphFilter &glyph_filter,
-                const Vector<PermString> &glyph_names)
+                const CompiledGlyphFilter &glyph_filter)
 {
     for (const Kern *as = _altselectors.begin(); as != _altselectors.end(); as++)
         if (as->kern == 0) {
             Code last = cin;
             uint32_t u = unicode(cin);
             for (int i = 0; i < s->out_nglyphs(); i++)
-                if (glyph_filter.allow_alternate(s->out_glyph(i), glyph_names, u)) {
+                if (glyph_filter.allow_alternate(s->out_glyph(i), u)) {
                     Code out = force_encoding(s->out_glyph(i), lookup);
                     add_ligature(last, as->in2, out);
                     last = out;
@@ -771,24 +770,25 @@ Metrics::apply_alternates_single(Code cin, const Substitution *s, int lookup,
 void
 Metrics::apply_alternates_ligature(const Vector<Code> &codes,
                 const Substitution *s, int lookup,
-                const GlyphFilter &glyph_filter,
-                const Vector<PermString> &glyph_names)
+                const CompiledGlyphFilter &glyph_filter)
 {
     // check whether the output character is allowed
-    if (!glyph_filter.allow_alternate(s->out_glyph(), glyph_names, 0))
+    if (!glyph_filter.allow_alternate(s->out_glyph(), 0))
         return;
 
     // find alternate selector and apply ligature if appropriate
+    Vector<Code> lig(codes.size() + 1, 0);
+    for (int i = 0; i < codes.size(); i++)
+        lig[i + (i > 0)] = codes[i];
     for (const Kern *as = _altselectors.begin(); as != _altselectors.end(); as++)
         if (as->kern == 0) {
-            Vector<Code> lig(codes);
-            lig.insert(lig.begin() + 1, as->in2);
+            lig[1] = as->in2;
             apply_ligature(lig, s, lookup);
         }
 }
 
 void
-Metrics::apply_alternates(const Vector<Substitution>& sv, int lookup, const GlyphFilter& glyph_filter, const Vector<PermString>& glyph_names)
+Metrics::apply_alternates(const Vector<Substitution>& sv, int lookup, const CompiledGlyphFilter& glyph_filter)
 {
     Vector<Glyph> glyphs;
     Vector<Code> codes;
@@ -799,9 +799,9 @@ Metrics::apply_alternates(const Vector<Substitution>& sv, int lookup, const Glyp
             s->all_in_glyphs(glyphs);
             for (codes.clear(); next_encoding(codes, glyphs); ) {
                 if (is_single)
-                    apply_alternates_single(codes[0], s, lookup, glyph_filter, glyph_names);
+                    apply_alternates_single(codes[0], s, lookup, glyph_filter);
                 else
-                    apply_alternates_ligature(codes, s, lookup, glyph_filter, glyph_names);
+                    apply_alternates_ligature(codes, s, lookup, glyph_filter);
             }
         }
     }
@@ -1384,8 +1384,6 @@ Metrics::need_base()
 bool
 Metrics::setting(Code code, Vector<Setting> &v, SettingMode sm) const
 {
-    extern int letterspace;
-
     if (!(sm & SET_KEEP))
         v.clear();
 
@@ -1430,7 +1428,7 @@ Metrics::setting(Code code, Vector<Setting> &v, SettingMode sm) const
                          && s[1].op == Setting::SHOW) {
                     int k = kern(s[-1].x, s[1].x);
                     if (s->op == Setting::KERNX)
-                        k -= letterspace;
+                        k -= _letterspace;
                     if (k)
                         v.push_back(Setting(Setting::MOVE, k, 0));
                 }
@@ -5,7 +5,7 @@
 #include "setting.hh"
 namespace Efont { class CharstringProgram; }
 class DvipsEncoding;
-class GlyphFilter;
+class CompiledGlyphFilter;
 
 class Metrics { public:
 
@@ -31,6 +31,9 @@ class Metrics { public:
     int units_per_em() const                    { return _units_per_em; }
     void set_design_units(int du)               { _design_units = du; }
 
+    int letterspace() const                     { return _letterspace; }
+    void set_letterspace(int ls)                { _letterspace = ls; }
+
     int n_mapped_fonts() const                  { return _mapped_fonts.size();}
     const Efont::CharstringProgram *mapped_font(int i) const { return _mapped_fonts[i]; }
     const String &mapped_font_name(int i) const { return _mapped_font_names[i]; }
@@ -68,8 +71,8 @@ class Metrics { public:
     void remove_ligatures(Code in1, Code in2);
     int reencode_right_ligkern(Code old_in2, Code new_in2);
 
-    int apply(const Vector<Substitution>&, bool allow_single, int lookup, const GlyphFilter&, const Vector<PermString>& glyph_names);
-    void apply_alternates(const Vector<Substitution>&, int lookup, const GlyphFilter&, const Vector<PermString>& glyph_names);
+    int apply(const Vector<Substitution>&, bool allow_single, int lookup, const CompiledGlyphFilter&);
+    void apply_alternates(const Vector<Substitution>&, int lookup, const CompiledGlyphFilter&);
     int apply(const Vector<Positioning>&);
 
     void apply_base_encoding(const String &font_name, const DvipsEncoding &, const Vector<int> &mapping);
@@ -153,6 +156,7 @@ class Metrics { public:
     String _coding_scheme;
     int _design_units;
     int _units_per_em;
+    int _letterspace;
 
     bool _liveness_marked : 1;
 
@@ -179,19 +183,15 @@ class Metrics { public:
     class ChangedContext;
     void apply_ligature(const Vector<Code> &, const Substitution *, int lookup);
     void apply_single(Code cin, const Substitution *s, int lookup,
-                ChangedContext &ctx, const GlyphFilter &glyph_filter,
-                const Vector<PermString> &glyph_names);
+                ChangedContext &ctx, const CompiledGlyphFilter &glyph_filter);
     void apply_simple_context_ligature(const Vector<Code> &codes,
                 const Substitution *s, int lookup, ChangedContext &ctx,
-                const GlyphFilter &glyph_filter,
-                const Vector<PermString> &glyph_names);
+                const CompiledGlyphFilter &glyph_filter);
     void apply_alternates_single(Code cin, const Substitution *s, int lookup,
-                const GlyphFilter &glyph_filter,
-                const Vector<PermString> &glyph_names);
+                const CompiledGlyphFilter &glyph_filter);
     void apply_alternates_ligature(const Vector<Code> &codes,
                 const Substitution *s, int lookup,
-                const GlyphFilter &glyph_filter,
-                const Vector<PermString> &glyph_names);
+                const CompiledGlyphFilter &glyph_filter);
 
     void unparse(const Char *) const;
 
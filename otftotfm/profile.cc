@@ -0,0 +1,125 @@
+/* profile.{cc,hh} -- phase timing and counters for --profile
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include "profile.hh"
+#include <stdio.h>
+#if HAVE_SYS_TIME_H
+# include <sys/time.h>
+#endif
+#include <time.h>
+
+int profiling = PROFILE_OFF;
+long profile_counters[NPROFILE_COUNTERS];
+
+static const char * const phase_names[] = {
+    "read", "encoding", "gsub", "shrink_encoding", "gpos", "output",
+    "pl", "pltotf", "fonts", "map", "updmap", "kpathsea"
+};
+static const char * const counter_names[] = {
+    "substitutions_generated", "substitutions_applied",
+    "positionings_generated", "positionings_applied",
+    "glyph_bounds", "subprocesses", "bytes_written"
+};
+
+static double phase_time[NPROFILE_PHASES];
+static int phase_calls[NPROFILE_PHASES];
+static int current_phase = -1;
+static double phase_mark;
+static double profile_begin;
+
+double
+profile_timestamp()
+{
+#if HAVE_SYS_TIME_H
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec / 1000000.;
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+void
+profile_start(int format)
+{
+    profiling = format;
+    profile_begin = phase_mark = profile_timestamp();
+}
+
+void
+ProfilePhase::enter(int phase)
+{
+    double now = profile_timestamp();
+    if (current_phase >= 0)
+        phase_time[current_phase] += now - phase_mark;
+    phase_mark = now;
+    _prev = current_phase;
+    current_phase = phase;
+    phase_calls[phase]++;
+}
+
+void
+ProfilePhase::leave()
+{
+    double now = profile_timestamp();
+    phase_time[current_phase] += now - phase_mark;
+    phase_mark = now;
+    current_phase = _prev;
+}
+
+double
+profile_phase_time(int phase)
+{
+    return phase_time[phase];
+}
+
+void
+profile_report(FILE *f)
+{
+    if (!profiling)
+        return;
+    double total = profile_timestamp() - profile_begin;
+    double other = total;
+    for (int i = 0; i < NPROFILE_PHASES; ++i)
+        other -= phase_time[i];
+    if (other < 0)
+        other = 0;
+
+    if (profiling == PROFILE_JSON) {
+        fprintf(f, "{\"total\": %.6f,\n \"phases\": {", total);
+        for (int i = 0; i < NPROFILE_PHASES; ++i)
+            fprintf(f, "%s\n  \"%s\": {\"calls\": %d, \"seconds\": %.6f}",
+                    i ? "," : "", phase_names[i], phase_calls[i], phase_time[i]);
+        fprintf(f, ",\n  \"other\": {\"calls\": 0, \"seconds\": %.6f}},\n \"counters\": {", other);
+        for (int i = 0; i < NPROFILE_COUNTERS; ++i)
+            fprintf(f, "%s\n  \"%s\": %ld", i ? "," : "",
+                    counter_names[i], profile_counters[i]);
+        fprintf(f, "}}\n");
+    } else {
+        fprintf(f, "%-24s %8s %10s %6s\n", "phase", "calls", "seconds", "%");
+        for (int i = 0; i < NPROFILE_PHASES; ++i)
+            if (phase_calls[i])
+                fprintf(f, "%-24s %8d %10.4f %6.1f\n", phase_names[i],
+                        phase_calls[i], phase_time[i],
+                        total > 0 ? 100 * phase_time[i] / total : 0.);
+        fprintf(f, "%-24s %8s %10.4f %6.1f\n", "other", "",
+                other, total > 0 ? 100 * other / total : 0.);
+        fprintf(f, "%-24s %8s %10.4f\n\n", "total", "", total);
+        fprintf(f, "%-24s %8s\n", "counter", "value");
+        for (int i = 0; i < NPROFILE_COUNTERS; ++i)
+            fprintf(f, "%-24s %8ld\n", counter_names[i], profile_counters[i]);
+    }
+}
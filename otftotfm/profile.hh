@@ -0,0 +1,49 @@
+#ifndef OTFTOTFM_PROFILE_HH
+#define OTFTOTFM_PROFILE_HH
+#include <stdio.h>
+
+enum { PROFILE_OFF = 0, PROFILE_TABLE = 1, PROFILE_JSON = 2 };
+
+enum { P_READ = 0, P_ENCODING, P_GSUB, P_SHRINK, P_GPOS, P_OUTPUT,
+       P_PL, P_PLTOTF, P_FONTS, P_MAP, P_UPDMAP, P_KPATHSEA,
+       NPROFILE_PHASES };
+
+enum { C_SUBS_GENERATED = 0, C_SUBS_APPLIED, C_POS_GENERATED,
+       C_POS_APPLIED, C_GLYPH_BOUNDS, C_SUBPROCESSES, C_BYTES_WRITTEN,
+       NPROFILE_COUNTERS };
+
+extern int profiling;
+extern long profile_counters[NPROFILE_COUNTERS];
+
+double profile_timestamp();
+void profile_start(int format);
+void profile_report(FILE *f);
+double profile_phase_time(int phase);
+
+inline void
+profile_count(int counter, long amount = 1)
+{
+    if (profiling)
+        profile_counters[counter] += amount;
+}
+
+// Charges the time spent in its scope to a phase.  Phases nest; time spent
+// in an inner phase is not charged to the outer one.
+class ProfilePhase { public:
+
+    ProfilePhase(int phase)             : _prev(-2) { if (profiling) enter(phase); }
+    ~ProfilePhase()                     { if (_prev != -2) leave(); }
+
+  private:
+
+    int _prev;
+
+    void enter(int phase);
+    void leave();
+
+    ProfilePhase(const ProfilePhase &);
+    ProfilePhase &operator=(const ProfilePhase &);
+
+};
+
+#endif
@@ -15,8 +15,10 @@
 #include "secondary.hh"
 #include "metrics.hh"
 #include "automatic.hh"
+#include "conversion.hh"
 #include "otftotfm.hh"
 #include "util.hh"
+#include "profile.hh"
 #include <efont/t1bounds.hh>
 #include <efont/t1font.hh>
 #include <efont/t1rw.hh>
@@ -86,7 +88,7 @@ enum {
 
 FontInfo::FontInfo(const Efont::OpenType::Font *otf_, ErrorHandler *errh)
     : otf(otf_), cmap(0), cff_file(0), cff(0), post(0), name(0), _nglyphs(-1),
-      _got_glyph_names(false), _ttb_program(0), _override_is_fixed_pitch(false),
+      _glyph_map(0), _got_glyph_map(false), _ttb_program(0), _override_is_fixed_pitch(false),
       _override_italic_angle(false), _override_x_height(x_height_auto)
 {
     cmap = new Efont::OpenType::Cmap(otf->table("cmap"), errh);
@@ -144,20 +146,41 @@ FontInfo::glyph_names(Vector<PermString> &glyph_names) const
     return true;
 }
 
+void
+FontInfo::make_glyph_map() const
+{
+    // The first glyph with a given name wins.
+    Vector<PermString> names;
+    glyph_names(names);
+    _glyph_map.reserve(names.size());
+    for (int g = 0; g < names.size(); g++)
+        _glyph_map.find_force(names[g], g);
+    _got_glyph_map = true;
+}
+
 int
 FontInfo::glyphid(PermString name) const
 {
     if (cff)
         return cff->glyphid(name);
     else {
-        if (!_got_glyph_names) {
-            glyph_names(_glyph_names);
-            _got_glyph_names = true;
-        }
-        PermString *found = std::find(_glyph_names.begin(), _glyph_names.end(), name);
-        if (found == _glyph_names.end())
-            return 0;
-        return found - _glyph_names.begin();
+        if (!_got_glyph_map)
+            make_glyph_map();
+        return _glyph_map[name];
+    }
+}
+
+void
+FontInfo::glyphids(const Vector<PermString> &names, Vector<int> &gids) const
+{
+    if (cff)
+        cff->glyphids(names, gids);
+    else {
+        if (!_got_glyph_map)
+            make_glyph_map();
+        gids.resize(names.size());
+        for (int i = 0; i < names.size(); i++)
+            gids[i] = _glyph_map[names[i]];
     }
 }
 
@@ -290,8 +313,8 @@ Secondary::encode_uni(int code, PermString name,
 }
 
 T1Secondary::T1Secondary(const FontInfo &finfo, const String &font_name,
-                         const String &otf_file_name)
-    : Secondary(finfo), _font_name(font_name), _otf_file_name(otf_file_name),
+                         const String &otf_file_name, ConversionContext &ctx)
+    : Secondary(finfo), _ctx(ctx), _font_name(font_name), _otf_file_name(otf_file_name),
       _units_per_em(finfo.units_per_em()),
       _xheight((int) ceil(finfo.x_height(Transform()))),
       _spacewidth(_units_per_em)
@@ -334,14 +357,6 @@ SettingSet& SettingSet::show(int uni) {
 }
 
 
-static String dotlessj_file_name;
-
-static String
-dotlessj_dvips_include(const String &, const FontInfo &, ErrorHandler *)
-{
-    return "<" + pathname_filename(dotlessj_file_name);
-}
-
 int
 T1Secondary::dotlessj_font(Metrics &metrics, ErrorHandler *errh, Glyph &dj_glyph)
 {
@@ -351,7 +366,7 @@ T1Secondary::dotlessj_font(Metrics &metrics, ErrorHandler *errh, Glyph &dj_glyph
     String dj_name;
     bool install_metrics;
     // XXX make sure dotlessj is for the main font?
-    if ((dj_name = installed_metrics_font_name(_font_name, "dotlessj")))
+    if ((dj_name = _ctx.installed_metrics_font_name(_font_name, "dotlessj")))
         install_metrics = false;
     else {
         dj_name = suffix_font_name(_font_name, "--lcdfj");
@@ -363,7 +378,7 @@ T1Secondary::dotlessj_font(Metrics &metrics, ErrorHandler *errh, Glyph &dj_glyph
         if (metrics.mapped_font_name(i) == dj_name)
             return i;
 
-    if (String filename = installed_type1_dotlessj(_otf_file_name, _finfo.cff->font_name(), (output_flags & G_DOTLESSJ), errh)) {
+    if (String filename = _ctx.installed_type1_dotlessj(_otf_file_name, _finfo.cff->font_name(), (_ctx.options().output_flags & G_DOTLESSJ), errh)) {
 
         // check for special case: "\0" means the font's "j" is already
         // dotless
@@ -409,9 +424,9 @@ T1Secondary::dotlessj_font(Metrics &metrics, ErrorHandler *errh, Glyph &dj_glyph
         if (install_metrics) {
             Metrics dj_metrics(font, 256);
             dj_metrics.encode('j', U_DOTLESSJ, dj_glyph);
-            ::dotlessj_file_name = filename;
-            output_metrics(dj_metrics, font->font_name(), -1, _finfo, String(), String(), dj_name, dotlessj_dvips_include, errh);
-        } else if (verbose)
+            dj_metrics.set_letterspace(metrics.letterspace());
+            _ctx.output_metrics(dj_metrics, font->font_name(), -1, _finfo, String(), String(), dj_name, filename, errh);
+        } else if (_ctx.options().verbose)
             errh->message("using %<%s%> for dotless-J font metrics", dj_name.c_str());
 
         // add font to metrics
@@ -425,7 +440,7 @@ int
 T1Secondary::setting(uint32_t uni, SettingSet& set, ErrorHandler *errh)
 {
     Transform xform;
-    extern int letterspace;
+    int letterspace = set.metrics().letterspace();
 
     if (set.show(uni).check())
         return 1;
@@ -655,9 +670,10 @@ bool
 char_bounds(double bounds[4], double& width, const FontInfo &finfo,
             const Transform &transform, uint32_t uni)
 {
-    if (Efont::OpenType::Glyph g = finfo.cmap->map_uni(uni))
+    if (Efont::OpenType::Glyph g = finfo.cmap->map_uni(uni)) {
+        profile_count(C_GLYPH_BOUNDS);
         return Efont::CharstringBounds::bounds(transform, finfo.program()->glyph_context(g), bounds, width);
-    else
+    } else
         return false;
 }
 
@@ -5,6 +5,7 @@
 #include "setting.hh"
 class Metrics;
 class Secondary;
+class ConversionContext;
 class Transform;
 namespace Efont { class TrueTypeBoundsCharstringProgram; }
 
@@ -27,6 +28,7 @@ struct FontInfo {
     int nglyphs() const                 { return _nglyphs; }
     bool glyph_names(Vector<PermString> &) const;
     int glyphid(PermString) const;
+    void glyphids(const Vector<PermString> &, Vector<int> &) const;
     const Efont::CharstringProgram *program() const;
     int units_per_em() const {
         return program()->units_per_em();
@@ -57,8 +59,8 @@ struct FontInfo {
   private:
 
     int _nglyphs;
-    mutable Vector<PermString> _glyph_names;
-    mutable bool _got_glyph_names;
+    mutable HashMap<PermString, int> _glyph_map;
+    mutable bool _got_glyph_map;
     mutable Vector<uint32_t> _unicodes;
     mutable Efont::TrueTypeBoundsCharstringProgram *_ttb_program;
     bool _override_is_fixed_pitch;
@@ -68,6 +70,8 @@ struct FontInfo {
     double _italic_angle;
     double _x_height;
 
+    void make_glyph_map() const;
+
 };
 
 class SettingSet {
@@ -109,9 +113,10 @@ class Secondary { public:
 };
 
 class T1Secondary : public Secondary { public:
-    T1Secondary(const FontInfo &, const String &font_name, const String &otf_file_name);
+    T1Secondary(const FontInfo &, const String &font_name, const String &otf_file_name, ConversionContext &);
     int setting(uint32_t uni, SettingSet&, ErrorHandler *);
   private:
+    ConversionContext &_ctx;
     String _font_name;
     String _otf_file_name;
     int _units_per_em;
@@ -16,19 +16,28 @@ class UnicodeProperty { public:
         P_MAX = 0377
     };
 
-    static int property(uint32_t uni);
+    static inline int property(uint32_t uni);
     static const char* property_name(int p);
     static bool parse_property(const String&, int& prop, int& prop_mask);
 
   private:
 
-    enum { P_Lul = 070 };
-    static const unsigned char property_pages[];
-    static const unsigned int property_offsets[];
-    static const int nproperty_offsets;
-
-    static inline const unsigned int* find_offset(uint32_t uni);
+    // Two-stage table generated by mkuniprop.pl: property_blocks maps
+    // each block of code points to a block of properties in property_data.
+    enum { BLOCK_SHIFT = 8, BLOCK_SIZE = 1 << BLOCK_SHIFT,
+           MAX_UNICODE = 0x10FFFF };
+    static const unsigned char property_blocks[];
+    static const unsigned char property_data[];
 
 };
 
+inline int
+UnicodeProperty::property(uint32_t u)
+{
+    if (u > MAX_UNICODE)
+        return P_Cn;
+    int block = property_blocks[u >> BLOCK_SHIFT];
+    return property_data[(block << BLOCK_SHIFT) + (u & (BLOCK_SIZE - 1))];
+}
+
 #endif
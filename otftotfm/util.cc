@@ -15,6 +15,7 @@
 # include <config.h>
 #endif
 #include "util.hh"
+#include "profile.hh"
 #include <lcdf/error.hh>
 #include <lcdf/straccum.hh>
 #include <lcdf/vector.hh>
@@ -149,82 +150,6 @@ shell_quote(const String &str)
     return str;
 }
 
-int
-mysystem(const char *command, ErrorHandler *errh)
-{
-    if (no_create) {
-        errh->message("would run %s", command);
-        return 0;
-    } else {
-        if (verbose)
-            errh->message("running %s", command);
-        return system(command);
-    }
-}
-
-FILE*
-mypopen(const char* command, const char* type, ErrorHandler* errh)
-{
-    if (no_create) {
-        errh->message("would run %s", command);
-        return popen("true", type);
-    } else {
-        if (verbose)
-            errh->message("running %s", command);
-        return popen(command, type);
-    }
-}
-
-#if !HAVE_MKSTEMP
-static const char *
-my_tmpnam()
-{
-# ifndef WIN32
-    return tmpnam(0);
-# else
-    const char *dir = getenv("TEMP");
-    return _tempnam(dir ? dir : ".", "otftmp.");
-# endif
-}
-#endif
-
-int
-temporary_file(String &filename, ErrorHandler *errh)
-{
-    if (no_create)
-        return 0;               // random number suffices
-
-#if HAVE_MKSTEMP
-    const char *tmpdir = getenv("TMPDIR");
-    if (tmpdir)
-        filename = String(tmpdir) + "/otftotfm.XXXXXX";
-    else {
-# ifdef P_tmpdir
-        filename = P_tmpdir "/otftotfm.XXXXXX";
-# else
-        filename = "/tmp/otftotfm.XXXXXX";
-# endif
-    }
-    int fd = mkstemp(filename.mutable_c_str());
-    if (fd < 0)
-        errh->error("temporary file %<%s%>: %s", filename.c_str(), strerror(errno));
-    return fd;
-#else  // !HAVE_MKSTEMP
-    for (int tries = 0; tries < 5; tries++) {
-        if (!(filename = my_tmpnam()))
-            return errh->error("cannot create temporary file");
-# ifdef O_EXCL
-        int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_EXCL | O_TRUNC, 0600);
-# else
-        int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
-# endif
-        if (fd >= 0)
-            return fd;
-    }
-    return errh->error("temporary file %<%s%>: %s", filename.c_str(), strerror(errno));
-#endif
-}
-
 bool
 parse_unicode_number(const char* begin, const char* end, int require_prefix, uint32_t& result)
 {
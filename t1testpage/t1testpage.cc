@@ -583,6 +583,7 @@ int
 main(int argc, char *argv[])
 {
     PsresDatabase *psres = new PsresDatabase;
+    psres->set_cache_directory(getenv("PSRESOURCECACHE"));
     psres->add_psres_path(getenv("PSRESOURCEPATH"), 0, false);
 
     Clp_Parser *clp =
@@ -0,0 +1,128 @@
+/* afm-bench.cc -- time Slurper and AfmReader on a large set of AFM files
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/afm.hh>
+#include <efont/metrics.hh>
+#include <lcdf/error.hh>
+#include <lcdf/slurper.hh>
+#include <lcdf/straccum.hh>
+#include <lcdf/vector.hh>
+#include "testutil.hh"
+#include <stdio.h>
+
+// Writes a set of synthetic AFM files to the current directory: many
+// Latin-sized fonts and a few CJK-sized ones with tens of thousands of
+// kern pairs.  Then reads the whole set several ways.
+
+enum { NLATIN = 60, LATIN_GLYPHS = 400, LATIN_KERNS = 2500,
+       NCJK = 3, CJK_GLYPHS = 20000, CJK_KERNS = 50000, ROUNDS = 5 };
+
+static String
+make_afm(int id, int nglyphs, int nkerns)
+{
+    StringAccum sa;
+    sa << "StartFontMetrics 4.1\nComment synthetic font " << id
+       << "\nFontName Bench-" << id << "\nFullName Bench " << id
+       << "\nFamilyName Bench\nWeight Regular\nItalicAngle 0\n"
+       << "IsFixedPitch false\nFontBBox -168 -218 1000 898\n"
+       << "UnderlinePosition -100\nUnderlineThickness 50\nVersion 001.000\n"
+       << "EncodingScheme FontSpecific\nCapHeight 662\nXHeight 450\n"
+       << "Ascender 683\nDescender -217\n"
+       << "StartCharMetrics " << nglyphs << '\n';
+    for (int g = 0; g < nglyphs; ++g)
+        sa << "C " << (g < 256 ? g : -1) << " ; WX " << 250 + (g * 37) % 750
+           << " ; N g" << g << " ; B " << (g % 40) << " -" << (g % 17)
+           << ' ' << 200 + (g * 13) % 700 << ' ' << 600 + g % 90 << " ;\n";
+    sa << "EndCharMetrics\nStartKernData\nStartKernPairs " << nkerns << '\n';
+    unsigned r = id;
+    for (int k = 0; k < nkerns; ++k) {
+        r = r * 1103515245U + 12345;
+        int left = (r >> 8) % nglyphs;
+        r = r * 1103515245U + 12345;
+        sa << "KPX g" << left << " g" << (r >> 8) % nglyphs
+           << ' ' << -(int) ((r >> 4) % 120) << '\n';
+    }
+    sa << "EndKernPairs\nEndKernData\nEndFontMetrics\n";
+    return sa.take_string();
+}
+
+enum { M_STDIO, M_MAPPED, M_VIEW, M_AFM };
+static const char * const mode_names[] = {
+    "Slurper, stdio", "Slurper, mapped", "next_line_view()", "AfmReader::read"
+};
+
+static double
+run(int mode, const Vector<String> &files, unsigned long &sum)
+{
+    double best = 1e9;
+    ErrorHandler *errh = ErrorHandler::silent_handler();
+    for (int round = 0; round < ROUNDS; ++round) {
+        double t0 = test_timestamp();
+        for (int i = 0; i < files.size(); ++i) {
+            Filename fn(files[i]);
+            if (mode == M_AFM) {
+                Efont::Metrics *m = Efont::AfmReader::read(fn, errh);
+                sum += m ? m->nglyphs() : 0;
+                delete m;
+                continue;
+            }
+            Slurper s(fn, mode == M_STDIO ? fopen(files[i].c_str(), "rb") : 0);
+            if (mode == M_VIEW)
+                while (s.next_line_view())
+                    sum += s.cur_line_length();
+            else
+                while (char *l = s.next_line())
+                    sum += s.cur_line_length() + l[0];
+        }
+        double t = test_timestamp() - t0;
+        best = (t < best ? t : best);
+    }
+    return best;
+}
+
+int
+main()
+{
+    ErrorHandler::static_initialize(new FileErrorHandler(stderr));
+    Vector<String> files;
+    double bytes = 0;
+    for (int i = 0; i < NLATIN + NCJK; ++i) {
+        String fn = "afm-bench-" + String(i) + ".afm";
+        String text = (i < NLATIN ? make_afm(i, LATIN_GLYPHS, LATIN_KERNS)
+                       : make_afm(i, CJK_GLYPHS, CJK_KERNS));
+        FILE *f = fopen(fn.c_str(), "wb");
+        if (!f) {
+            perror(fn.c_str());
+            return 1;
+        }
+        fwrite(text.data(), 1, text.length(), f);
+        fclose(f);
+        files.push_back(fn);
+        bytes += text.length();
+    }
+
+    printf("%d files, %.1f MB\n", files.size(), bytes / 1048576);
+    for (int mode = M_STDIO; mode <= M_AFM; ++mode) {
+        unsigned long sum = 0;
+        double t = run(mode, files, sum);
+        printf("%-18s %8.2f ms  %7.1f MB/s\n", mode_names[mode], t * 1000,
+               bytes / 1048576 / t);
+    }
+
+    for (int i = 0; i < files.size(); ++i)
+        remove(files[i].c_str());
+    return 0;
+}
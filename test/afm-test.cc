@@ -0,0 +1,271 @@
+/* afm-test.cc -- compare AfmReader with the output of the previous reader
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/afm.hh>
+#include <efont/metrics.hh>
+#include <efont/pairop.hh>
+#include <lcdf/error.hh>
+#include <lcdf/filename.hh>
+#include <lcdf/straccum.hh>
+#include "testutil.hh"
+#include <stdio.h>
+#include <string.h>
+
+using namespace Efont;
+
+// afm/times.afm is a Times-style AFM with many malformed lines.  The test
+// reads it and NMUTATIONS randomly damaged copies, and dumps every name,
+// dimension, kern value, pair-program list and find() result, plus the
+// warnings.  afm/parity.txt holds the same dump from the reader before
+// keyword dispatch was rewritten; "afm-test -w" prints a new one.
+//
+// The rewrite changed one kind of message on purpose.  The old reader
+// chose between "bad `X' command: field N" and "unknown command `X'" using
+// state left over from earlier lines, so it often said "bad" about unknown
+// keywords and "unknown" about malformed known ones.  The dump therefore
+// reduces both forms to the line number and keyword, and the exact wording
+// is checked separately below.
+
+enum { NMUTATIONS = 16 };
+static const char tmp_filename[] = "afm-test.afm";
+
+class CaptureErrorHandler : public ErrorHandler { public:
+
+    void *emit(const String &str, void *user_data, bool) {
+        String landmark;
+        const char *s = parse_anno(str, str.begin(), str.end(),
+                                   "l", &landmark, (const char *) 0);
+        _sa << clean_landmark(landmark, true) << str.substring(s, str.end()) << '\n';
+        return user_data;
+    }
+
+    String take() {
+        return _sa.take_string();
+    }
+
+  private:
+
+    StringAccum _sa;
+
+};
+
+static unsigned long rng;
+
+static unsigned
+next_random()
+{
+    rng = rng * 1103515245UL + 12345;
+    return (rng >> 16) & 0x7FFF;
+}
+
+static String
+mutate(const String &text, int seed)
+{
+    static const char alphabet[] = " ;\t0123456789-+.eABCKLNPQWXY<>";
+    rng = seed;
+    String s = text;
+    int nedits = 1 + next_random() % 6;
+    for (int e = 0; e < nedits && s.length(); ++e) {
+        int pos = next_random() % s.length();
+        char c = alphabet[next_random() % (sizeof(alphabet) - 1)];
+        switch (next_random() % 4) {
+          case 0:               // delete a character
+            s = s.substring(0, pos) + s.substring(pos + 1);
+            break;
+          case 1:               // insert a character
+            s = s.substring(0, pos) + String(c) + s.substring(pos);
+            break;
+          case 2:               // replace a character
+            s = s.substring(0, pos) + String(c) + s.substring(pos + 1);
+            break;
+          default: {            // delete or duplicate a line
+              int b = pos, x = pos;
+              while (b > 0 && s[b - 1] != '\n')
+                  --b;
+              while (x < s.length() && s[x] != '\n')
+                  ++x;
+              x = (x < s.length() ? x + 1 : x);
+              if (next_random() & 1)
+                  s = s.substring(0, b) + s.substring(x);
+              else
+                  s = s.substring(0, x) + s.substring(b);
+              break;
+          }
+        }
+    }
+    return s;
+}
+
+// Reduce "bad `X' command..." (and its "field N" line) and "unknown command
+// `X'..." to "LANDMARK: keyword `X'".
+static String
+normalize_messages(const String &messages)
+{
+    StringAccum sa;
+    bool skip_field = false;
+    const char *s = messages.begin(), *end = messages.end();
+    while (s != end) {
+        const char *eol = (const char *) memchr(s, '\n', end - s);
+        eol = (eol ? eol + 1 : end);
+        String line(s, eol);
+        s = eol;
+        int colon = line.find_left(": ");
+        String landmark = line.substring(0, colon + 2);
+        String text = line.substring(colon + 2);
+        if (skip_field && text.starts_with("field ")) {
+            skip_field = false;
+            continue;
+        }
+        skip_field = text.starts_with("bad `");
+        if (skip_field || text.starts_with("unknown command `")) {
+            int open = text.find_left('`');
+            int close = text.find_left('\'', open);
+            sa << landmark << "keyword " << text.substring(open, close + 1 - open) << '\n';
+        } else
+            sa << line;
+    }
+    return sa.take_string();
+}
+
+static String
+dump(const String &text, String *messages)
+{
+    StringAccum sa;
+    if (FILE *f = fopen(tmp_filename, "wb")) {
+        fwrite(text.data(), 1, text.length(), f);
+        fclose(f);
+    } else {
+        perror(tmp_filename);
+        return String();
+    }
+
+    CaptureErrorHandler errh;
+    Metrics *m = AfmReader::read(Filename(tmp_filename), &errh);
+    if (messages)
+        *messages = errh.take();
+    sa << normalize_messages(messages ? *messages : errh.take());
+    if (!m) {
+        sa << "FAILED\n";
+        return sa.take_string();
+    }
+
+    sa << m->font_name() << '|' << m->family() << '|' << m->full_name()
+       << '|' << m->weight() << '|' << m->version() << '\n';
+    char buf[256];
+    for (int i = 0; i < m->nfd(); ++i) {
+        sprintf(buf, "fd%d=%.17g\n", i, m->fd(i));
+        sa << buf;
+    }
+    for (int g = 0; g < m->nglyphs(); ++g) {
+        sprintf(buf, " c=%d w=%.17g %.17g %.17g %.17g %.17g\n", m->code(g),
+                m->wd(g), m->lf(g), m->rt(g), m->tp(g), m->bt(g));
+        sa << 'g' << g << ' ' << m->name(g) << buf;
+    }
+    for (int i = 0; i < m->nkv(); ++i) {
+        sprintf(buf, "kv%d=%.17g\n", i, m->kv(i));
+        sa << buf;
+    }
+    const PairProgram *pp = m->pair_program();
+    for (int g = 0; g < m->nglyphs(); ++g) {
+        for (PairOpIndex opi = pp->find_left(g); opi >= 0; opi = pp->op(opi).next_left()) {
+            const PairOp &op = pp->op(opi);
+            sa << "op " << op.left() << ' ' << op.right() << ' ' << op.value()
+               << ' ' << (op.is_lig() ? op.result() : -9) << '\n';
+        }
+        for (int r = 0; r < m->nglyphs(); ++r) {
+            PairOpIndex opi = pp->find(g, r);
+            if (opi >= 0) {
+                const PairOp &op = pp->op(opi);
+                sa << "find " << g << ' ' << r << " -> " << op.value()
+                   << ' ' << (op.is_lig() ? op.result() : -9) << '\n';
+            }
+        }
+    }
+    delete m;
+    return sa.take_string();
+}
+
+static String
+read_file(const String &filename)
+{
+    StringAccum sa;
+    if (FILE *f = fopen(filename.c_str(), "rb")) {
+        char buf[BUFSIZ];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            sa.append(buf, n);
+        fclose(f);
+    } else
+        perror(filename.c_str());
+    return sa.take_string();
+}
+
+static bool
+contains_line(const String &text, const String &line)
+{
+    String t = "\n" + text, l = "\n" + line + "\n";
+    return t.find_left(l) >= 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    bool write = (argc > 1 && strcmp(argv[1], "-w") == 0);
+    String afm = read_file(TEST_SRCDIR "/afm/times.afm");
+    if (!afm)
+        return 1;
+
+    StringAccum sa;
+    String times_messages;
+    for (int i = 0; i <= NMUTATIONS; ++i) {
+        sa << "== input " << i << '\n';
+        sa << dump(i ? mutate(afm, i) : afm, i ? 0 : &times_messages);
+    }
+    remove(tmp_filename);
+
+    if (write) {
+        fwrite(sa.data(), 1, sa.length(), stdout);
+        return 0;
+    }
+
+    // Compare with the previous reader, line by line.
+    String expected = read_file(TEST_SRCDIR "/afm/parity.txt");
+    String actual = sa.take_string();
+    CHECK(expected.length() > 0);
+    if (actual != expected) {
+        int lineno = 1, i = 0;
+        while (i < actual.length() && i < expected.length() && actual[i] == expected[i]) {
+            if (actual[i] == '\n')
+                ++lineno;
+            ++i;
+        }
+        fprintf(stderr, "afm/parity.txt:%d: output differs from the previous reader\n", lineno);
+        CHECK(actual == expected);
+    }
+
+    // The exact wording for unknown and malformed commands.  Lines 40, 45
+    // and 75 used to say "bad `X' command: field 0"; line 64 used to say
+    // "unknown command `KPX'".
+    CHECK(contains_line(times_messages, "afm-test.afm:40: unknown command `Q' in character metrics"));
+    CHECK(contains_line(times_messages, "afm-test.afm:45: unknown command `L'"));
+    CHECK(contains_line(times_messages, "afm-test.afm:52: unknown command `Cfoo'"));
+    CHECK(contains_line(times_messages, "afm-test.afm:63: bad `KPX' command:"));
+    CHECK(contains_line(times_messages, "afm-test.afm:63: field 3 should be a real number"));
+    CHECK(contains_line(times_messages, "afm-test.afm:64: bad `KPX' command:"));
+    CHECK(contains_line(times_messages, "afm-test.afm:64: field 3 "));
+    CHECK(contains_line(times_messages, "afm-test.afm:75: unknown command `Unknown'"));
+    return test_status();
+}
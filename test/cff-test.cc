@@ -0,0 +1,148 @@
+/* cff-test.cc -- check CFF glyph-name lookups
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/cff.hh>
+#include <lcdf/error.hh>
+#include <lcdf/straccum.hh>
+#include "testutil.hh"
+#include <stdio.h>
+
+using namespace Efont;
+
+// Builds a bare CFF whose strings INDEX holds "dup" twice, a user copy of
+// the standard string "A", and "custom".  Its charset names glyph 1 with
+// the second "dup", glyph 2 with the user "A", glyph 3 "custom" and glyph
+// 4 the standard "B".  Cff::Font::glyphid() must find a glyph only through
+// the SID that Cff::sid() returns for its name, so "dup" and "A" resolve
+// to no glyph, as they did before glyph names were hashed.
+
+static void
+append_card16(StringAccum &sa, int x)
+{
+    sa << (char) (x >> 8) << (char) x;
+}
+
+// An INDEX with 1-byte offsets.
+static void
+append_index(StringAccum &sa, const Vector<String> &items)
+{
+    append_card16(sa, items.size());
+    if (!items.size())
+        return;
+    sa << (char) 1;
+    int offset = 1;
+    sa << (char) offset;
+    for (const String *s = items.begin(); s != items.end(); ++s) {
+        offset += s->length();
+        sa << (char) offset;
+    }
+    for (const String *s = items.begin(); s != items.end(); ++s)
+        sa << *s;
+}
+
+// A DICT integer operand in its 5-byte form.
+static void
+append_dict_int(StringAccum &sa, int x)
+{
+    sa << (char) 29 << (char) (x >> 24) << (char) (x >> 16)
+       << (char) (x >> 8) << (char) x;
+}
+
+static String
+make_cff()
+{
+    static const int charset_sids[] = { 392, 393, 394, 35 };
+    const int nglyphs = 5;
+
+    Vector<String> names, strings, charstrings;
+    names.push_back("Test");
+    strings.push_back("dup");
+    strings.push_back("dup");
+    strings.push_back("A");
+    strings.push_back("custom");
+    for (int g = 0; g < nglyphs; ++g)
+        charstrings.push_back(String((char) 14)); // endchar
+
+    // header, Name INDEX, Top DICT INDEX (one 12-byte DICT), strings
+    // INDEX, and empty Global Subr INDEX
+    StringAccum tail;
+    append_index(tail, strings);
+    append_card16(tail, 0);
+    int charset_pos = 4 + (2 + 1 + 2 + 4) + (2 + 1 + 2 + 12) + tail.length();
+    int charstrings_pos = charset_pos + 1 + 2 * (nglyphs - 1);
+
+    StringAccum dict;
+    append_dict_int(dict, charset_pos);
+    dict << (char) 15;          // charset
+    append_dict_int(dict, charstrings_pos);
+    dict << (char) 17;          // CharStrings
+    Vector<String> dicts;
+    dicts.push_back(dict.take_string());
+
+    StringAccum sa;
+    sa << (char) 1 << (char) 0 << (char) 4 << (char) 1;
+    append_index(sa, names);
+    append_index(sa, dicts);
+    sa << tail;
+    sa << (char) 0;             // charset format 0
+    for (int g = 1; g < nglyphs; ++g)
+        append_card16(sa, charset_sids[g - 1]);
+    append_index(sa, charstrings);
+    return sa.take_string();
+}
+
+int
+main(int, char *[])
+{
+    ErrorHandler::static_initialize(new FileErrorHandler(stderr));
+    Cff cff(make_cff(), 1000, ErrorHandler::default_handler());
+    CHECK(cff.ok());
+    Cff::Font *font = dynamic_cast<Cff::Font *>(cff.font(PermString(), ErrorHandler::default_handler()));
+    CHECK(font && font->ok());
+    if (!font || !font->ok())
+        return test_status();
+
+    static const struct {
+        const char *name;
+        int gid;
+    } lookups[] = {
+        { ".notdef", 0 }, { "dup", -1 }, { "A", -1 }, { "custom", 3 },
+        { "B", 4 }, { "missing", -1 }
+    };
+    Vector<PermString> names;
+    for (size_t i = 0; i < sizeof(lookups) / sizeof(lookups[0]); ++i) {
+        names.push_back(lookups[i].name);
+        if (font->glyphid(lookups[i].name) != lookups[i].gid)
+            fprintf(stderr, "%s: glyph %d, expected %d\n", lookups[i].name,
+                    font->glyphid(lookups[i].name), lookups[i].gid);
+        CHECK(font->glyphid(lookups[i].name) == lookups[i].gid);
+        CHECK((font->glyph(PermString(lookups[i].name)) != 0) == (lookups[i].gid >= 0));
+    }
+
+    Vector<int> gids;
+    font->glyphids(names, gids);
+    CHECK(gids.size() == names.size());
+    for (int i = 0; i < gids.size(); ++i)
+        CHECK(gids[i] == lookups[i].gid);
+
+    // looking up strings by SID doesn't change which SID a name has
+    CHECK(cff.sid_permstring(Cff::NSTANDARD_STRINGS + 1) == "dup");
+    CHECK(cff.sid_permstring(Cff::NSTANDARD_STRINGS + 2) == "A");
+    CHECK(cff.sid("dup") == Cff::NSTANDARD_STRINGS);
+    CHECK(cff.sid("A") == 34);
+    CHECK(font->glyphid("dup") == -1);
+    return test_status();
+}
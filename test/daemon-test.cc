@@ -0,0 +1,167 @@
+/* daemon-test.cc -- round-trip requests through the otftotfm daemon
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <lcdf/error.hh>
+#include <lcdf/parallel.hh>
+#include <lcdf/straccum.hh>
+#include "daemon.hh"
+#include "util.hh"
+#include "testutil.hh"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if HAVE_SYS_SOCKET_H && HAVE_SYS_UN_H && HAVE_SYS_WAIT_H
+# include <sys/socket.h>
+# include <sys/un.h>
+# include <sys/wait.h>
+#endif
+#include <fcntl.h>
+#include <unistd.h>
+
+// Starts a daemon on a socket in a temporary directory and sends it
+// requests with run_daemon_client().  The daemon runs echo_main in place
+// of otftotfm, which reports the directory, arguments, environment and
+// umask it was given.  Also checks that the socket is private and that a
+// client that never sends its request does not hold up other requests.
+
+static int
+echo_main(int argc, char *argv[])
+{
+    char cwd[8192];
+    printf("%s\n", getcwd(cwd, sizeof(cwd)) ? cwd : "?");
+    for (int i = 0; i < argc; ++i)
+        printf("%s\n", argv[i]);
+    const char *v = getenv("DAEMON_TEST");
+    printf("%s\n", v ? v : "(unset)");
+    mode_t mask = umask(0);
+    printf("%03o\n", (unsigned) mask);
+    return 7;
+}
+
+// Runs one request with standard output redirected to outfile.
+static int
+request(const String &socket, const String &outfile, int argc, const char *argv[])
+{
+    fflush(stdout);
+    int saved = dup(1);
+    int fd = open(outfile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    dup2(fd, 1);
+    close(fd);
+    SilentErrorHandler errh;
+    int status = run_daemon_client(socket.c_str(), argc, const_cast<char **>(argv), &errh);
+    dup2(saved, 1);
+    close(saved);
+    return status;
+}
+
+#if HAVE_SYS_SOCKET_H && HAVE_SYS_UN_H && HAVE_SYS_WAIT_H
+static int
+connect_to(const String &path)
+{
+    struct sockaddr_un sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    strcpy(sa.sun_path, path.c_str());
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<struct sockaddr *>(&sa), sizeof(sa)) < 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+#endif
+
+int
+main()
+{
+#if HAVE_SYS_SOCKET_H && HAVE_SYS_UN_H && HAVE_SYS_WAIT_H
+    ErrorHandler::static_initialize(new FileErrorHandler(stderr));
+    char dirbuf[] = "/tmp/daemon-test.XXXXXX";
+    if (!mkdtemp(dirbuf)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    String dir = dirbuf;
+    String socket = dir + "/socket", outfile = dir + "/out";
+
+    umask(022);
+    pid_t daemon = fork();
+    if (daemon == 0) {
+        parallel_jobs = 1;
+        SilentErrorHandler errh;
+        run_daemon(socket, echo_main, &errh);
+        _exit(1);
+    }
+    struct stat st;
+    for (int i = 0; i < 500 && stat(socket.c_str(), &st) < 0; ++i)
+        usleep(10000);
+
+    if (stat(socket.c_str(), &st) < 0) {
+        CHECK(!"daemon socket created");
+    } else {
+        CHECK((st.st_mode & 0777) == 0600);
+
+        // a request carries its arguments, directory, environment and
+        // umask, and returns main's status
+        const char *argv[] = { "otftotfm", "-a", "two words" };
+        setenv("DAEMON_TEST", "forwarded", 1);
+        umask(027);
+        CHECK(chdir(dirbuf) == 0);
+        CHECK(request(socket, outfile, 3, argv) == 7);
+        StringAccum expect;
+        expect << dir << "\notftotfm\n-a\ntwo words\nforwarded\n027\n";
+        CHECK(read_file(outfile, ErrorHandler::silent_handler()) == expect.take_string());
+
+        // with one job slot, a client that connects and sends nothing
+        // must not delay the next request by its 10-second read timeout
+        int idle = connect_to(socket);
+        CHECK(idle >= 0);
+        usleep(100000);
+        double t0 = test_timestamp();
+        CHECK(request(socket, outfile, 3, argv) == 7);
+        CHECK(test_timestamp() - t0 < 5);
+        close(idle);
+
+        // the daemon drops a connection from another user, even if the
+        // socket's mode lets it connect; run_daemon_client() returns 1
+        // when the daemon closes the connection without a reply
+        if (geteuid() == 0) {
+            chmod(dirbuf, 0711);
+            chmod(socket.c_str(), 0666);
+            pid_t child = fork();
+            if (child == 0) {
+                if (setuid(65534) < 0)
+                    _exit(2);
+                _exit(request(socket, "/dev/null", 3, argv) == 1 ? 0 : 1);
+            }
+            int status;
+            waitpid(child, &status, 0);
+            CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        }
+    }
+
+    kill(daemon, SIGTERM);
+    waitpid(daemon, 0, 0);
+    unlink(socket.c_str());
+    unlink(outfile.c_str());
+    rmdir(dirbuf);
+#endif
+    return test_status();
+}
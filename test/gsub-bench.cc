@@ -0,0 +1,129 @@
+/* gsub-bench.cc -- time GsubShaper over sample text
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/otf.hh>
+#include <efont/otfcmap.hh>
+#include <efont/otfgsub.hh>
+#include <lcdf/error.hh>
+#include <lcdf/straccum.hh>
+#include "testutil.hh"
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+using namespace Efont::OpenType;
+
+// Shapes sample text, a word at a time, with a font's liga, calt and salt
+// lookups, and reports glyphs per second.  The default fonts come from
+// mktestfont.py; other fonts may be given on the command line.
+
+enum { NWORDS = 20000, ROUNDS = 5 };
+
+static String
+read_file(const String &filename)
+{
+    StringAccum sa;
+    if (FILE *f = fopen(filename.c_str(), "rb")) {
+        char buf[BUFSIZ];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            sa.append(buf, n);
+        fclose(f);
+    } else
+        perror(filename.c_str());
+    return sa.take_string();
+}
+
+// Pseudo-English: common letter pairs, so ligatures fire now and then.
+static Vector<Vector<Glyph> >
+make_words(const Cmap &cmap)
+{
+    static const char letters[] = "etaoinshrdlucmfwypvbgkjqxzffifl";
+    Vector<Vector<Glyph> > words;
+    unsigned r = 1;
+    for (int i = 0; i < NWORDS; ++i) {
+        r = r * 1103515245U + 12345;
+        int len = 2 + (r >> 16) % 8;
+        Vector<Glyph> w;
+        for (int j = 0; j < len; ++j) {
+            r = r * 1103515245U + 12345;
+            w.push_back(cmap.map_uni(letters[(r >> 16) % (sizeof(letters) - 1)]));
+        }
+        words.push_back(w);
+    }
+    return words;
+}
+
+static void
+bench(const String &filename)
+{
+    String data = read_file(filename);
+    Font otf(data);
+    if (!otf.ok())
+        return;
+    Gsub gsub(otf.table("GSUB"), &otf);
+    Cmap cmap(otf.table("cmap"));
+    GsubShaper shaper(gsub, otf);
+
+    Vector<Tag> ftags;
+    ftags.push_back(Tag("calt"));
+    ftags.push_back(Tag("liga"));
+    ftags.push_back(Tag("salt"));
+    std::sort(ftags.begin(), ftags.end());
+    Vector<int> lookups;
+    gsub.feature_list().lookups(gsub.script_list(), Tag("latn"), Tag(),
+                                ftags, lookups);
+
+    Vector<Vector<Glyph> > words = make_words(cmap);
+    long nglyphs = 0;
+    for (int i = 0; i < words.size(); ++i)
+        nglyphs += words[i].size();
+
+    double best = 1e9;
+    for (int round = 0; round < ROUNDS; ++round) {
+        double t0 = test_timestamp();
+        Vector<Glyph> g;
+        Vector<int> clusters;
+        for (int i = 0; i < words.size(); ++i) {
+            g = words[i];
+            clusters.clear();
+            for (int j = 0; j < g.size(); ++j)
+                clusters.push_back(j);
+            shaper.shape(g, clusters, lookups);
+        }
+        double t = test_timestamp() - t0;
+        best = (t < best ? t : best);
+    }
+
+    const char *slash = strrchr(filename.c_str(), '/');
+    printf("%-12s %3d lookups  %7ld glyphs  %8.2f ms  %6.2f Mglyphs/s\n",
+           slash ? slash + 1 : filename.c_str(), lookups.size(), nglyphs,
+           best * 1000, nglyphs / best / 1e6);
+}
+
+int
+main(int argc, char *argv[])
+{
+    ErrorHandler::static_initialize(new FileErrorHandler(stderr));
+    if (argc > 1)
+        for (int i = 1; i < argc; ++i)
+            bench(argv[i]);
+    else {
+        bench(TEST_SRCDIR "/otf/shape.ttf");
+        bench(TEST_SRCDIR "/otf/many.ttf");
+    }
+    return 0;
+}
@@ -0,0 +1,390 @@
+/* gsub-test.cc -- test GsubShaper against hand results and otftotfm
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/otf.hh>
+#include <efont/otfcmap.hh>
+#include <efont/otfgsub.hh>
+#include <efont/otfpost.hh>
+#include <lcdf/error.hh>
+#include <lcdf/hashmap.hh>
+#include <lcdf/straccum.hh>
+#include "automatic.hh"
+#include "conversion.hh"
+#include "glyphfilter.hh"
+#include "util.hh"
+#include "testutil.hh"
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+using namespace Efont;
+using namespace Efont::OpenType;
+
+// otf/shape.ttf comes from mktestfont.py.  Its lookups are:
+//   ccmp  ij -> i j (multiple)
+//   liga  ff, fi, fl, ffi, ffl ligatures, ignoring marks
+//   calt  q a' -> a.alt1; a' [j j.sc] -> a.alt1; o x' y -> x_y (chaining,
+//         nested lookups)
+//   salt  a -> a.alt1 or a.alt2 (alternate)
+//   smcp  a-z -> a.sc-z.sc (single)
+//   dlig  a' z -> a.alt2, ignoring ligatures (chaining)
+
+static Vector<PermString> glyph_names;
+static HashMap<PermString, int> glyph_ids(-1);
+
+static String
+read_file(const String &filename)
+{
+    StringAccum sa;
+    if (FILE *f = fopen(filename.c_str(), "rb")) {
+        char buf[BUFSIZ];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            sa.append(buf, n);
+        fclose(f);
+    } else
+        perror(filename.c_str());
+    return sa.take_string();
+}
+
+static Vector<String>
+split(const String &s)
+{
+    Vector<String> v;
+    const char *x = s.begin(), *end = s.end();
+    while (x != end) {
+        while (x != end && *x == ' ')
+            ++x;
+        const char *w = x;
+        while (x != end && *x != ' ')
+            ++x;
+        if (w != x)
+            v.push_back(String(w, x));
+    }
+    return v;
+}
+
+static Vector<int>
+feature_lookups(const Gsub &gsub, const char *features)
+{
+    Vector<String> names = split(features);
+    Vector<OpenType::Tag> ftags;
+    for (int i = 0; i < names.size(); ++i)
+        ftags.push_back(OpenType::Tag(names[i].c_str()));
+    std::sort(ftags.begin(), ftags.end());
+    Vector<int> lookups;
+    gsub.feature_list().lookups(gsub.script_list(), OpenType::Tag("latn"),
+                                OpenType::Tag(), ftags, lookups);
+    return lookups;
+}
+
+// Shape a space-separated list of glyph names.  Returns the output names,
+// then " |", then the clusters.
+static String
+shape(const GsubShaper &shaper, const Vector<int> &lookups, const char *text)
+{
+    Vector<String> names = split(text);
+    Vector<Glyph> glyphs;
+    Vector<int> clusters;
+    for (int i = 0; i < names.size(); ++i) {
+        glyphs.push_back(glyph_ids[names[i]]);
+        clusters.push_back(i);
+    }
+    shaper.shape(glyphs, clusters, lookups);
+    StringAccum sa;
+    for (int i = 0; i < glyphs.size(); ++i)
+        sa << (i ? " " : "") << glyph_names[glyphs[i]];
+    sa << " |";
+    for (int i = 0; i < clusters.size(); ++i)
+        sa << ' ' << clusters[i];
+    return sa.take_string();
+}
+
+// The ligature program from an otftotfm PL or VPL: for each left glyph name, the
+// right glyph names and results of its LIG instructions.  Other
+// instructions are recorded with an empty result.
+typedef HashMap<String, String> LigMap;
+
+static void
+parse_pl_ligatures(const String &pl, HashMap<String, LigMap> &ligs)
+{
+    // character codes to glyph names
+    HashMap<String, String> code_names;
+    Vector<String> lines;
+    for (int pos = 0; pos < pl.length(); ) {
+        int nl = pl.find_left('\n', pos);
+        nl = (nl < 0 ? pl.length() : nl);
+        lines.push_back(pl.substring(pos, nl - pos));
+        pos = nl + 1;
+    }
+    for (int i = 0; i < lines.size(); ++i)
+        if (lines[i].starts_with("(CHARACTER ")) {
+            Vector<String> w = split(lines[i].substring(11));
+            String code = w[0] + " " + w[1];
+            if (w[0] == "C")
+                code_names.insert(code, w[1]);
+            else if (w.size() >= 4 && w[2] == "(COMMENT")
+                code_names.insert(code, w[3].substring(0, w[3].length() - 1));
+        }
+
+    Vector<String> labels;
+    bool in_program = false;
+    for (int i = 0; i < lines.size(); ++i) {
+        Vector<String> w = split(lines[i]);
+        if (w.size() >= 3 && w[0] == "(LABEL") {
+            if (in_program)
+                labels.clear();
+            in_program = false;
+            labels.push_back(code_names[w[1] + " " + w[2].substring(0, w[2].length() - 1)]);
+        } else if (w.size() >= 1 && w[0] == "(STOP)") {
+            labels.clear();
+            in_program = false;
+        } else if (w.size() >= 5 && labels.size() && w[0].length() > 1
+                   && (w[0].find_left("LIG") >= 0 || w[0] == "(KRN")) {
+            in_program = true;
+            String right = code_names[w[1] + " " + w[2]];
+            String result;
+            if (w[0] == "(LIG")
+                result = code_names[w[3] + " " + w[4].substring(0, w[4].length() - 1)];
+            for (int j = 0; j < labels.size(); ++j)
+                if (w[0] != "(KRN")
+                    ligs.find_force(labels[j]).insert(right, result);
+        }
+    }
+}
+
+// Apply TeX's ligature algorithm, which knows only adjacent pairs.
+static String
+tex_ligatures(HashMap<String, LigMap> &ligs, const Vector<String> &word)
+{
+    Vector<String> w = word;
+    for (int i = 0; i + 1 < w.size(); ) {
+        String *result = ligs.find_force(w[i]).findp(w[i + 1]);
+        if (!result)
+            ++i;
+        else if (!*result)
+            return "unsupported ligature instruction";
+        else {
+            w[i] = *result;
+            w.erase(w.begin() + i + 1);
+        }
+    }
+    StringAccum sa;
+    for (int i = 0; i < w.size(); ++i)
+        sa << (i ? " " : "") << w[i];
+    return sa.take_string();
+}
+
+static String
+strip_clusters(const String &s)
+{
+    return s.substring(0, s.find_left(" |"));
+}
+
+static void
+test_otftotfm_ligatures(const String &font_data, const GsubShaper &shaper,
+                        const Vector<int> &liga)
+{
+    static GlyphFilter null_filter;
+    ConversionOptions copt;
+    copt.encoding_file = TEST_SRCDIR "/otf/shape.enc";
+    copt.interesting_features.push_back(OpenType::Tag("liga"));
+    copt.feature_filters.insert(OpenType::Tag("liga"), &null_filter);
+    copt.output_flags = G_METRICS | G_VMETRICS | G_ASCII;
+    copt.in_memory = true;
+    copt.no_create = false;
+    ConversionContext cc(copt);
+    ErrorHandler *errh = ErrorHandler::silent_handler();
+    CHECK(cc.convert_file("shape.ttf", font_data, errh) == 0);
+
+    // The ligatures are in the PL, or in the VPL if otftotfm needed a
+    // virtual font.
+    String pl;
+    for (int i = 0; i < cc.outputs().size(); ++i)
+        if (cc.outputs()[i].kind == O_VPL
+            || (cc.outputs()[i].kind == O_PL && !pl))
+            pl = cc.outputs()[i].data;
+    CHECK(pl.length() > 0);
+    HashMap<String, LigMap> ligs;
+    parse_pl_ligatures(pl, ligs);
+    CHECK(ligs["f"]["i"] == "f_i");
+    CHECK(ligs["f_f"]["i"] == "f_f_i");
+
+    // every word of up to four letters from "afil"
+    static const char letters[] = "afil";
+    for (int len = 1; len <= 4; ++len) {
+        int nwords = 1;
+        for (int i = 0; i < len; ++i)
+            nwords *= 4;
+        for (int n = 0; n < nwords; ++n) {
+            Vector<String> word;
+            StringAccum text;
+            for (int i = 0, x = n; i < len; ++i, x /= 4) {
+                word.push_back(String(letters[x % 4]));
+                text << (i ? " " : "") << letters[x % 4];
+            }
+            String expected = tex_ligatures(ligs, word);
+            String actual = strip_clusters(shape(shaper, liga, text.c_str()));
+            if (actual != expected) {
+                fprintf(stderr, "%s: otftotfm gives %s, GsubShaper gives %s\n",
+                        text.c_str(), expected.c_str(), actual.c_str());
+                CHECK(actual == expected);
+            }
+        }
+    }
+}
+
+// Compare Gsub::closure with the walk it replaced, which called
+// mark_out_glyphs() for every lookup.  The closure must be a subset of the
+// old set.  The substitutions unparsed with it must be those unparsed with
+// the old set, minus some whose glyphs it does not contain; and those whose
+// glyphs it does contain must have their outputs in it.  Returns the number
+// of substitutions dropped.
+static bool
+reachable(const Substitution &s, const Vector<bool> &used, bool out)
+{
+    Vector<Glyph> gs;
+    if (out)
+        s.all_out_glyphs(gs);
+    else
+        s.all_in_glyphs(gs);
+    for (int i = 0; i < gs.size(); ++i)
+        if (!used[gs[i]])
+            return false;
+    return true;
+}
+
+static int
+test_closure(const Gsub &gsub, const Vector<bool> &initial)
+{
+    Vector<int> lookups;
+    for (int i = 0; i < gsub.nlookups(); ++i)
+        lookups.push_back(i);
+    Vector<bool> old_used = initial, used = initial;
+    for (int i = 0; i < lookups.size(); ++i)
+        gsub.lookup(lookups[i]).mark_out_glyphs(gsub, old_used);
+    gsub.closure(used, lookups);
+    bool subset = true;
+    for (int g = 0; g < used.size(); ++g)
+        subset &= (!used[g] || old_used[g]);
+    CHECK(subset);
+
+    Coverage old_coverage(old_used), coverage(used);
+    int ndropped = 0;
+    for (int i = 0; i < lookups.size(); ++i) {
+        GsubLookup l = gsub.lookup(lookups[i]);
+        Vector<Substitution> old_subs, subs;
+        l.unparse_automatics(gsub, old_subs, old_coverage);
+        l.unparse_automatics(gsub, subs, coverage);
+
+        int k = 0;
+        bool dropped_ok = true, closed = true;
+        for (int j = 0; j < old_subs.size(); ++j) {
+            StringAccum old_sa, sa;
+            old_subs[j].unparse(old_sa, 0);
+            if (k < subs.size())
+                subs[k].unparse(sa, 0);
+            if (k < subs.size() && old_sa.take_string() == sa.take_string()) {
+                if (reachable(subs[k], used, false))
+                    closed &= reachable(subs[k], used, true);
+                ++k;
+            } else {
+                dropped_ok &= !reachable(old_subs[j], used, false);
+                ++ndropped;
+            }
+        }
+        CHECK(k == subs.size());
+        CHECK(dropped_ok);
+        CHECK(closed);
+    }
+    return ndropped;
+}
+
+int
+main()
+{
+    ErrorHandler::static_initialize(new FileErrorHandler(stderr));
+    Vector<String> glyphlists;
+    glyphlists.push_back(TEST_SRCDIR "/../glyphlist.txt");
+    glyphlists.push_back(TEST_SRCDIR "/../texglyphlist.txt");
+    load_glyphlists(glyphlists, false, ErrorHandler::default_handler());
+
+    String font_data = read_file(TEST_SRCDIR "/otf/shape.ttf");
+    OpenType::Font otf(font_data);
+    CHECK(otf.ok());
+    OpenType::Post post(otf.table("post"));
+    CHECK(post.glyph_names(glyph_names));
+    for (int i = 0; i < glyph_names.size(); ++i)
+        glyph_ids.insert(glyph_names[i], i);
+
+    OpenType::Gsub gsub(otf.table("GSUB"), &otf);
+    GsubShaper shaper(gsub, otf);
+
+    // single, multiple, alternate
+    Vector<int> smcp = feature_lookups(gsub, "smcp");
+    CHECK(shape(shaper, smcp, "a b f_i acutecomb") == "a.sc b.sc f_i acutecomb | 0 1 2 3");
+    Vector<int> ccmp = feature_lookups(gsub, "ccmp");
+    CHECK(shape(shaper, ccmp, "a ij b") == "a i j b | 0 1 1 2");
+    Vector<int> salt = feature_lookups(gsub, "salt");
+    CHECK(shape(shaper, salt, "b a") == "b a.alt1 | 0 1");
+    shaper.set_alternate(1);
+    CHECK(shape(shaper, salt, "b a") == "b a.alt2 | 0 1");
+    shaper.set_alternate(0);
+
+    // ligatures, and the clusters they merge
+    Vector<int> liga = feature_lookups(gsub, "liga");
+    CHECK(shape(shaper, liga, "o f f i c e") == "o f_f_i c e | 0 1 4 5");
+    CHECK(shape(shaper, liga, "f f f l") == "f_f f_l | 0 2");
+    CHECK(shape(shaper, feature_lookups(gsub, "ccmp liga"), "ij f i") == "i j f_i | 0 0 1");
+
+    // liga ignores marks; the skipped mark follows the ligature
+    CHECK(shape(shaper, liga, "f acutecomb i") == "f_i acutecomb | 0 1");
+    CHECK(shape(shaper, liga, "f acutecomb f acutecomb l") == "f_f_l acutecomb acutecomb | 0 1 3");
+    CHECK(shape(shaper, smcp, "f acutecomb i") == "f.sc acutecomb i.sc | 0 1 2");
+
+    // chaining contexts with nested single and ligature lookups
+    Vector<int> calt = feature_lookups(gsub, "calt");
+    CHECK(shape(shaper, calt, "q a a") == "q a.alt1 a | 0 1 2");
+    CHECK(shape(shaper, calt, "o x y") == "o x_y | 0 1");
+    CHECK(shape(shaper, calt, "a x y") == "a x y | 0 1 2");
+
+    // dlig ignores ligatures, so f_i does not separate a from z
+    Vector<int> dlig = feature_lookups(gsub, "dlig");
+    Vector<int> liga_dlig = feature_lookups(gsub, "liga dlig");
+    CHECK(shape(shaper, liga_dlig, "a f i z") == "a.alt2 f_i z | 0 1 3");
+    CHECK(shape(shaper, dlig, "a f i z") == "a f i z | 0 1 2 3");
+    CHECK(shape(shaper, dlig, "a z") == "a.alt2 z | 0 1");
+
+    test_otftotfm_ligatures(font_data, shaper, liga);
+
+    // closure from letters without f or y, so the old walk over-reaches
+    // through the ligatures, ij, x_y and small caps
+    Vector<bool> initial(glyph_names.size(), false);
+    Vector<String> letters = split("a i l o q x z");
+    for (int i = 0; i < letters.size(); ++i)
+        initial[glyph_ids[letters[i]]] = true;
+    CHECK(test_closure(gsub, initial) > 0);
+
+    String many_data = read_file(TEST_SRCDIR "/otf/many.ttf");
+    OpenType::Font many(many_data);
+    OpenType::Gsub many_gsub(many.table("GSUB"), &many);
+    OpenType::Cmap many_cmap(many.table("cmap"));
+    initial.assign(OpenType::Post(many.table("post")).nglyphs(), false);
+    for (int c = 'a'; c <= 'z'; ++c)
+        initial[many_cmap.map_uni(c)] = true;
+    test_closure(many_gsub, initial);
+    return test_status();
+}
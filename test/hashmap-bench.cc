@@ -0,0 +1,119 @@
+/* hashmap-bench.cc -- time HashMap on otftotfm's common key types
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <lcdf/hashmap.hh>
+#include <lcdf/string.hh>
+#include <lcdf/permstr.hh>
+#include <lcdf/vector.hh>
+#include <efont/otf.hh>
+#include "hashmap-old.hh"
+#include "testutil.hh"
+#include <stdlib.h>
+#include <string.h>
+
+// Build a table from keys, then probe it; half the probes miss.  Glyph
+// names come from glyphlist.txt, and Unicode scalars are offset by one
+// because OldHashMap cannot store a zero key.
+
+enum { ROUNDS = 20 };
+
+template <template <class, class> class M, class K> static void
+run(const char *name, const Vector<K> &keys, const Vector<K> &probes)
+{
+    double best_insert = 1e9, best_lookup = 1e9;
+    long sum = 0;
+    for (int rep = 0; rep < 5; ++rep) {
+        M<K, int> h(-1);
+        double t0 = test_timestamp();
+        for (int r = 0; r < ROUNDS; ++r) {
+            M<K, int> x(-1);
+            for (int i = 0; i < keys.size(); ++i)
+                x.insert(keys[i], i);
+            if (r == ROUNDS - 1)
+                h.swap(x);
+        }
+        double t1 = test_timestamp();
+        for (int r = 0; r < ROUNDS; ++r)
+            for (int i = 0; i < probes.size(); ++i)
+                sum += h[probes[i]];
+        double t2 = test_timestamp();
+        best_insert = std::min(best_insert, (t1 - t0) / (ROUNDS * (double) keys.size()));
+        best_lookup = std::min(best_lookup, (t2 - t1) / (ROUNDS * (double) probes.size()));
+    }
+    printf("%-20s %6d keys: insert %6.1f ns, lookup %6.1f ns%s\n", name,
+           keys.size(), best_insert * 1e9, best_lookup * 1e9, sum == 42 ? " " : "");
+}
+
+template <class K> static void
+compare(const char *name, const Vector<K> &keys, const Vector<K> &probes)
+{
+    String s(name);
+    run<OldHashMap>((s + " (old)").c_str(), keys, probes);
+    run<HashMap>((s + " (new)").c_str(), keys, probes);
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *glyphlist = (argc > 1 ? argv[1] : TEST_SRCDIR "/../glyphlist.txt");
+    FILE *f = fopen(glyphlist, "r");
+    if (!f) {
+        perror(glyphlist);
+        return 1;
+    }
+    Vector<String> names;
+    Vector<PermString> pnames;
+    Vector<int> unis;
+    char buf[BUFSIZ];
+    while (fgets(buf, sizeof(buf), f))
+        if (const char *semi = (buf[0] != '#' ? strchr(buf, ';') : 0)) {
+            names.push_back(String(buf, semi - buf));
+            pnames.push_back(PermString(buf, semi - buf));
+            unis.push_back(strtol(semi + 1, 0, 16) + 1);
+        }
+    fclose(f);
+
+    static const char * const tag_names[] = {
+        "aalt", "c2sc", "calt", "case", "ccmp", "cpsp", "dlig", "dnom",
+        "frac", "hlig", "kern", "liga", "lnum", "locl", "mark", "mkmk",
+        "numr", "onum", "ordn", "pnum", "salt", "sinf", "smcp", "ss01",
+        "ss02", "ss03", "subs", "sups", "swsh", "tnum", "zero", "size",
+        "DFLT", "latn", "cyrl", "grek"
+    };
+    Vector<Efont::OpenType::Tag> tags;
+    for (size_t i = 0; i < sizeof(tag_names) / sizeof(tag_names[0]); ++i)
+        tags.push_back(Efont::OpenType::Tag(tag_names[i]));
+
+    Vector<String> name_probes;
+    Vector<PermString> pname_probes;
+    Vector<Efont::OpenType::Tag> tag_probes;
+    Vector<int> uni_probes;
+    srandom(3);
+    for (int i = 0; i < 100000; ++i) {
+        int j = random() % names.size();
+        String miss = names[j] + ".sc";
+        name_probes.push_back(i & 1 ? names[j] : miss);
+        pname_probes.push_back(i & 1 ? pnames[j] : PermString(miss.c_str()));
+        uni_probes.push_back(i & 1 ? unis[j] : (int) (random() % 0x10000) + 1);
+        tag_probes.push_back(i & 1 ? tags[random() % tags.size()] : Efont::OpenType::Tag("zzzz"));
+    }
+
+    compare("glyph names", names, name_probes);
+    compare("PermString names", pnames, pname_probes);
+    compare("feature tags", tags, tag_probes);
+    compare("Unicode scalars", unis, uni_probes);
+    return 0;
+}
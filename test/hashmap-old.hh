@@ -0,0 +1,394 @@
+#ifndef TEST_HASHMAP_OLD_HH
+#define TEST_HASHMAP_OLD_HH
+
+/*
+ * hashmap.{cc,hh} -- simple open-coded hash table class
+ * Eddie Kohler
+ *
+ * Copyright (c) 1999-2000 Massachusetts Institute of Technology
+ * Copyright (c) 2001-2003 International Computer Science Institute
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, subject to the conditions
+ * listed in the Click LICENSE file. These conditions include: you must
+ * preserve this copyright notice, and you cannot mention the copyright
+ * holders in advertising related to the Software without their permission.
+ * The Software is provided WITHOUT ANY WARRANTY, EXPRESS OR IMPLIED. This
+ * notice is a summary of the Click LICENSE file; the license in that file is
+ * legally binding.
+ */
+
+// This is lcdf/hashmap.{cc,hh} from before the Robin Hood table, renamed
+// OldHashMap, for comparison by hashmap-bench.
+
+#include <assert.h>
+#include <lcdf/hashcode.hh>
+
+// K AND V REQUIREMENTS:
+//
+//		K::K()
+//		K::operator bool() const
+//			Must have (bool)(K()) == false
+//			and no k with (bool)k == false is stored.
+// K &		K::operator=(const K &)
+//		k1 == k2
+// hashcode_t	hashcode(const K &)
+//			If hashcode(k1) != hashcode(k2), then k1 != k2.
+//			Actually any unsigned integer type may be used.
+//
+//		V::V()
+// V &		V::operator=(const V &)
+
+template <class K, class V> class _OldOldHashMap_const_iterator;
+template <class K, class V> class _OldOldHashMap_iterator;
+
+template <class K, class V>
+class OldHashMap { public:
+
+    OldHashMap();
+    explicit OldHashMap(const V &);
+    OldHashMap(const OldHashMap<K, V> &);
+    ~OldHashMap()				{ delete[] _e; }
+
+    int size() const			{ return _n; }
+    bool empty() const			{ return _n == 0; }
+    int capacity() const		{ return _capacity; }
+    const V &default_value() const	{ return _default_value; }
+    void set_default_value(const V &v)	{ _default_value = v; }
+
+    typedef _OldOldHashMap_const_iterator<K, V> const_iterator;
+    typedef _OldOldHashMap_iterator<K, V> iterator;
+
+    inline const_iterator begin() const;
+    inline iterator begin();
+    inline const_iterator end() const;
+    inline iterator end();
+
+    inline const V &find(const K &) const;
+    inline V *findp(const K &) const;
+    inline const V &operator[](const K &k) const;
+    V &find_force(const K &, const V &);
+    inline V &find_force(const K &);
+
+    bool insert(const K &, const V &);
+    void clear();
+
+    OldHashMap<K, V> &operator=(const OldHashMap<K, V> &);
+    void swap(OldHashMap<K, V> &);
+
+    void resize(int size)		{ increase(size); }
+
+    struct Pair {
+	K key;
+	V value;
+	Pair()				: key(), value() { }
+    };
+
+  private:
+
+    int _capacity;
+    int _grow_limit;
+    int _n;
+    Pair *_e;
+    V _default_value;
+
+    void increase(int);
+    inline void check_capacity();
+    inline int bucket(const K &) const;
+
+    friend class _OldOldHashMap_const_iterator<K, V>;
+    friend class _OldOldHashMap_iterator<K, V>;
+
+};
+
+template <class K, class V>
+class _OldOldHashMap_const_iterator { public:
+    typedef _OldOldHashMap_const_iterator const_iterator;
+    typedef typename OldHashMap<K, V>::Pair Pair;
+
+    operator bool() const		{ return _pos < _hm->_capacity; }
+    bool operator!() const		{ return _pos >= _hm->_capacity; }
+
+    void operator++(int);
+    void operator++()			{ (*this)++; }
+
+    const K &key() const		{ return _hm->_e[_pos].key; }
+    const V &value() const		{ return _hm->_e[_pos].value; }
+    const Pair &pair() const		{ return _hm->_e[_pos]; }
+
+    inline bool operator==(const const_iterator &) const;
+    inline bool operator!=(const const_iterator &) const;
+
+  private:
+    const OldHashMap<K, V> *_hm;
+    int _pos;
+    _OldOldHashMap_const_iterator(const OldHashMap<K, V> *, int);
+    friend class OldHashMap<K, V>;
+    friend class _OldOldHashMap_iterator<K, V>;
+};
+
+template <class K, class V>
+class _OldOldHashMap_iterator : public _OldOldHashMap_const_iterator<K, V> { public:
+    typedef _OldOldHashMap_iterator iterator;
+
+    V &value() const		{ return this->_hm->_e[this->_pos].value; }
+
+  private:
+    _OldOldHashMap_iterator(const OldHashMap<K, V> *hm, int pos) : _OldOldHashMap_const_iterator<K, V>(hm, pos) { }
+    friend class OldHashMap<K, V>;
+};
+
+
+template <class K, class V>
+inline int
+OldHashMap<K, V>::bucket(const K &key) const
+{
+    assert(key);
+    hashcode_t hc = hashcode(key);
+    int i =   hc       & (_capacity - 1);
+    int j = ((hc >> 6) & (_capacity - 1)) | 1;
+
+    while (_e[i].key && !(_e[i].key == key))
+	i = (i + j) & (_capacity - 1);
+
+    return i;
+}
+
+template <class K, class V>
+inline const V &
+OldHashMap<K, V>::find(const K &key) const
+{
+    int i = bucket(key);
+    const V *v = (_e[i].key ? &_e[i].value : &_default_value);
+    return *v;
+}
+
+template <class K, class V>
+inline const V &
+OldHashMap<K, V>::operator[](const K &key) const
+{
+    return find(key);
+}
+
+template <class K, class V>
+inline V *
+OldHashMap<K, V>::findp(const K &key) const
+{
+    int i = bucket(key);
+    return _e[i].key ? &_e[i].value : 0;
+}
+
+template <class K, class V>
+inline V &
+OldHashMap<K, V>::find_force(const K &key)
+{
+    return find_force(key, _default_value);
+}
+
+template <class K, class V>
+inline _OldOldHashMap_const_iterator<K, V>
+OldHashMap<K, V>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template <class K, class V>
+inline _OldOldHashMap_const_iterator<K, V>
+OldHashMap<K, V>::end() const
+{
+    return const_iterator(this, _capacity);
+}
+
+template <class K, class V>
+inline _OldOldHashMap_iterator<K, V>
+OldHashMap<K, V>::begin()
+{
+    return iterator(this, 0);
+}
+
+template <class K, class V>
+inline _OldOldHashMap_iterator<K, V>
+OldHashMap<K, V>::end()
+{
+    return iterator(this, _capacity);
+}
+
+template <class K, class V>
+inline bool
+_OldOldHashMap_const_iterator<K, V>::operator==(const const_iterator &i) const
+{
+    return _hm == i._hm && _pos == i._pos;
+}
+
+template <class K, class V>
+inline bool
+_OldOldHashMap_const_iterator<K, V>::operator!=(const const_iterator &i) const
+{
+    return _hm != i._hm || _pos != i._pos;
+}
+
+template <class K, class V>
+OldHashMap<K, V>::OldHashMap()
+    : _capacity(0), _grow_limit(0), _n(0), _e(0), _default_value()
+{
+    increase(-1);
+}
+
+template <class K, class V>
+OldHashMap<K, V>::OldHashMap(const V &def)
+    : _capacity(0), _grow_limit(0), _n(0), _e(0), _default_value(def)
+{
+    increase(-1);
+}
+
+
+template <class K, class V>
+OldHashMap<K, V>::OldHashMap(const OldHashMap<K, V> &m)
+    : _capacity(m._capacity), _grow_limit(m._grow_limit), _n(m._n),
+      _e(new Pair[m._capacity]), _default_value(m._default_value)
+{
+    for (int i = 0; i < _capacity; i++)
+	_e[i] = m._e[i];
+}
+
+
+template <class K, class V>
+OldHashMap<K, V> &
+OldHashMap<K, V>::operator=(const OldHashMap<K, V> &o)
+{
+    // This works with self-assignment.
+
+    _capacity = o._capacity;
+    _grow_limit = o._grow_limit;
+    _n = o._n;
+    _default_value = o._default_value;
+
+    Pair *new_e = new Pair[_capacity];
+    for (int i = 0; i < _capacity; i++)
+	new_e[i] = o._e[i];
+
+    delete[] _e;
+    _e = new_e;
+
+    return *this;
+}
+
+
+template <class K, class V>
+void
+OldHashMap<K, V>::increase(int min_size)
+{
+    int ncap = (_capacity < 8 ? 8 : _capacity * 2);
+    while (ncap < min_size && ncap > 0)
+	ncap *= 2;
+    if (ncap <= 0)		// want too many elements
+	return;
+
+    Pair *ne = new Pair[ncap];
+    if (!ne)			// out of memory
+	return;
+
+    Pair *oe = _e;
+    int ocap = _capacity;
+    _e = ne;
+    _capacity = ncap;
+    _grow_limit = ((3 * _capacity) >> 2) - 1;
+
+    Pair *otrav = oe;
+    for (int i = 0; i < ocap; i++, otrav++)
+	if (otrav->key) {
+	    int j = bucket(otrav->key);
+	    _e[j] = *otrav;
+	}
+
+    delete[] oe;
+}
+
+template <class K, class V>
+inline void
+OldHashMap<K, V>::check_capacity()
+{
+    if (_n >= _grow_limit)
+	increase(-1);
+}
+
+template <class K, class V>
+bool
+OldHashMap<K, V>::insert(const K &key, const V &val)
+{
+    check_capacity();
+    int i = bucket(key);
+    bool is_new = !(bool)_e[i].key;
+    _e[i].key = key;
+    _e[i].value = val;
+    _n += is_new;
+    return is_new;
+}
+
+template <class K, class V>
+V &
+OldHashMap<K, V>::find_force(const K &key, const V &value)
+{
+    check_capacity();
+    int i = bucket(key);
+    if (!(bool)_e[i].key) {
+	_e[i].key = key;
+	_e[i].value = value;
+	_n++;
+    }
+    return _e[i].value;
+}
+
+template <class K, class V>
+void
+OldHashMap<K, V>::clear()
+{
+    delete[] _e;
+    _e = 0;
+    _capacity = _grow_limit = _n = 0;
+    increase(-1);
+}
+
+template <class K, class V>
+void
+OldHashMap<K, V>::swap(OldHashMap<K, V> &o)
+{
+    int capacity = _capacity;
+    int grow_limit = _grow_limit;
+    int n = _n;
+    Pair *e = _e;
+    V default_value = _default_value;
+    _capacity = o._capacity;
+    _grow_limit = o._grow_limit;
+    _n = o._n;
+    _e = o._e;
+    _default_value = o._default_value;
+    o._capacity = capacity;
+    o._grow_limit = grow_limit;
+    o._n = n;
+    o._e = e;
+    o._default_value = default_value;
+}
+
+template <class K, class V>
+_OldOldHashMap_const_iterator<K, V>::_OldOldHashMap_const_iterator(const OldHashMap<K, V> *hm, int pos)
+    : _hm(hm), _pos(pos)
+{
+    typename OldHashMap<K, V>::Pair *e = _hm->_e;
+    int capacity = _hm->_capacity;
+    while (_pos < capacity && !(bool)e[_pos].key)
+	_pos++;
+}
+
+template <class K, class V>
+void
+_OldOldHashMap_const_iterator<K, V>::operator++(int)
+{
+    typename OldHashMap<K, V>::Pair *e = _hm->_e;
+    int capacity = _hm->_capacity;
+    for (_pos++; _pos < capacity && !(bool)e[_pos].key; _pos++)
+	;
+}
+
+#endif
@@ -0,0 +1,211 @@
+/* hashmap-test.cc -- check HashMap
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <lcdf/string.hh>
+#include <lcdf/hashmap.hh>
+#include <lcdf/vector.hh>
+#include "testutil.hh"
+#include <stdlib.h>
+#include <map>
+#if __cplusplus >= 201103L
+# include <memory>
+#endif
+
+// Keys whose hash codes collide in groups, so that erase() must shift
+// long clusters back, including clusters that wrap around the table.
+struct Collider {
+    int k;
+    Collider()                          : k(0) { }
+    Collider(int k_)                    : k(k_) { }
+};
+inline bool operator==(const Collider &a, const Collider &b) { return a.k == b.k; }
+inline hashcode_t hashcode(const Collider &c) { return c.k % 7; }
+
+template <class K> static bool
+same(const HashMap<K, int> &h, const std::map<int, int> &m)
+{
+    if (h.size() != (int) m.size())
+        return false;
+    int n = 0;
+    for (typename HashMap<K, int>::const_iterator it = h.begin(); it; ++it, ++n) {
+        std::map<int, int>::const_iterator mit = m.find(it.key().k);
+        if (mit == m.end() || mit->second != it.value())
+            return false;
+    }
+    for (std::map<int, int>::const_iterator mit = m.begin(); mit != m.end(); ++mit)
+        if (h[K(mit->first)] != mit->second)
+            return false;
+    return n == h.size();
+}
+
+struct IntKey {
+    int k;
+    IntKey()                            : k(0) { }
+    IntKey(int k_)                      : k(k_) { }
+};
+inline bool operator==(const IntKey &a, const IntKey &b) { return a.k == b.k; }
+inline hashcode_t hashcode(const IntKey &c) { return c.k; }
+
+// Random inserts, erases, and lookups, checked against std::map.
+template <class K> static void
+test_random(int nkeys, int nops)
+{
+    HashMap<K, int> h(-1);
+    std::map<int, int> m;
+    srandom(1);
+    for (int i = 0; i < nops; ++i) {
+        int k = random() % nkeys + 1;
+        switch (random() % 3) {
+        case 0: {
+            bool fresh = m.find(k) == m.end();
+            m[k] = i;
+            CHECK(h.insert(K(k), i) == fresh);
+            break;
+        }
+        case 1:
+            CHECK(h.erase(K(k)) == (m.erase(k) == 1));
+            CHECK(!h.findp(K(k)));
+            break;
+        default: {
+            std::map<int, int>::iterator it = m.find(k);
+            CHECK(h[K(k)] == (it == m.end() ? -1 : it->second));
+            break;
+        }
+        }
+        if (i % 1000 == 0)
+            CHECK(same(h, m));
+    }
+    CHECK(same(h, m));
+
+    // erase everything in a different order than insertion
+    Vector<int> keys;
+    for (std::map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+        keys.push_back(it->first);
+    for (int i = keys.size() - 1; i >= 0; i -= 2) {
+        CHECK(h.erase(K(keys[i])));
+        m.erase(keys[i]);
+    }
+    CHECK(same(h, m));
+    for (int i = 0; i < keys.size(); ++i)
+        h.erase(K(keys[i]));
+    CHECK(h.size() == 0 && h.empty());
+    CHECK(h.begin() == h.end());
+}
+
+static void
+test_reserve()
+{
+    HashMap<int, int> h(-1);
+    h.reserve(1000);
+    int capacity = h.capacity();
+    CHECK(capacity >= 1000);
+    for (int i = 1; i <= 1000; ++i)
+        h.insert(i, i * 2);
+    CHECK(h.capacity() == capacity);
+    CHECK(h.size() == 1000);
+    for (int i = 1; i <= 1000; ++i)
+        CHECK(h[i] == i * 2);
+    // reserving less than the current size changes nothing
+    h.reserve(10);
+    CHECK(h.capacity() == capacity);
+    CHECK(h[500] == 1000);
+    // growing keeps entries
+    h.reserve(100000);
+    CHECK(h.capacity() >= 100000);
+    for (int i = 1; i <= 1000; ++i)
+        CHECK(h[i] == i * 2);
+}
+
+static void
+test_strings()
+{
+    HashMap<String, int> h(-1);
+    for (int i = 0; i < 500; ++i)
+        h.insert(String("glyph") + String(i), i);
+    CHECK(h.find_like("glyph250") == 250);
+    CHECK(h.findp_like("glyph500") == 0);
+    CHECK(h.erase("glyph250"));
+    CHECK(h.find_like("glyph250") == -1);
+    CHECK(h.find_force("glyph250") == -1 && h.size() == 500);
+
+    HashMap<String, int> copy(h);
+    HashMap<String, int> assigned;
+    assigned = h;
+    h.clear();
+    CHECK(h.size() == 0 && h["glyph1"] == -1);
+    CHECK(copy.size() == 500 && copy["glyph1"] == 1);
+    CHECK(assigned.size() == 500 && assigned["glyph499"] == 499);
+    copy.swap(h);
+    CHECK(copy.size() == 0 && h.size() == 500 && h["glyph2"] == 2);
+}
+
+#if __cplusplus >= 201103L
+// A move-only value that counts live instances.
+struct Token {
+    static int live;
+    std::unique_ptr<int> p;
+    Token()                             { ++live; }
+    explicit Token(int x)               : p(new int(x)) { ++live; }
+    Token(Token &&t)                    : p(std::move(t.p)) { ++live; }
+    Token &operator=(Token &&t)         { p = std::move(t.p); return *this; }
+    ~Token()                            { --live; }
+};
+int Token::live;
+
+static void
+test_move_only()
+{
+    int before = Token::live;
+    {
+        HashMap<Collider, Token> h;
+        for (int i = 1; i <= 300; ++i)
+            CHECK(h.insert(Collider(i), Token(i)));
+        CHECK(!h.insert(Collider(7), Token(-7)));
+        CHECK(*h.findp(Collider(7))->p == -7);
+        CHECK(!h[Collider(1000)].p);
+
+        for (int i = 2; i <= 300; i += 2)
+            CHECK(h.erase(Collider(i)));
+        for (int i = 1; i <= 300; ++i) {
+            Token *t = h.findp(Collider(i));
+            CHECK(i % 2 ? t && *t->p == (i == 7 ? -7 : i) : !t);
+        }
+
+        HashMap<Collider, Token> moved(std::move(h));
+        CHECK(h.size() == 0 && moved.size() == 150);
+        HashMap<Collider, Token> assigned;
+        assigned = std::move(moved);
+        CHECK(moved.size() == 0 && assigned.size() == 150);
+        CHECK(*assigned[Collider(299)].p == 299);
+        assigned.clear();
+        CHECK(assigned.size() == 0 && !assigned.findp(Collider(299)));
+    }
+    CHECK(Token::live == before);
+}
+#endif
+
+int
+main(int, char *[])
+{
+    test_random<IntKey>(5000, 200000);
+    test_random<Collider>(400, 50000);
+    test_reserve();
+    test_strings();
+#if __cplusplus >= 201103L
+    test_move_only();
+#endif
+    return test_status();
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+# mktestfont.py -- generate the OpenType fonts in test/otf
+#
+# Requires fontTools.  The fonts have no outlines, only the tables that the
+# layout tests and benchmarks read.  Run from the test directory:
+#
+#     python3 mktestfont.py
+#
+# otf/shape.ttf    a few lookups of every kind, for gsub-test
+# otf/many.ttf     200 lookups over 2000 glyphs, for the layout benchmarks
+
+import os
+import random
+from fontTools.fontBuilder import FontBuilder
+from fontTools.feaLib.builder import addOpenTypeFeaturesFromString
+
+LOWER = [chr(c) for c in range(ord('a'), ord('z') + 1)]
+
+
+def build(filename, glyphs, cmap, fea, marks=()):
+    fb = FontBuilder(1000, isTTF=True)
+    fb.setupGlyphOrder(['.notdef'] + glyphs)
+    fb.setupCharacterMap(cmap)
+    fb.setupGlyf({g: _empty_glyph() for g in ['.notdef'] + glyphs})
+    fb.setupHorizontalMetrics({g: (500 if g not in marks else 0, 0)
+                               for g in ['.notdef'] + glyphs})
+    fb.setupHorizontalHeader(ascent=800, descent=-200)
+    name = os.path.splitext(os.path.basename(filename))[0]
+    fb.setupNameTable({'familyName': 'LCDF Test ' + name.title(),
+                       'styleName': 'Regular',
+                       'psName': 'LCDFTest-' + name.title()})
+    fb.setupOS2(sTypoAscender=800, usWinAscent=800, usWinDescent=200)
+    fb.setupPost(keepGlyphNames=True)
+    addOpenTypeFeaturesFromString(fb.font, fea)
+    fb.font['head'].created = fb.font['head'].modified = 0
+    fb.save(filename)
+
+
+def _empty_glyph():
+    from fontTools.pens.ttGlyphPen import TTGlyphPen
+    return TTGlyphPen(None).glyph()
+
+
+def shape_font():
+    sc = [g + '.sc' for g in LOWER]
+    glyphs = (['space'] + LOWER + sc
+              + ['f_f', 'f_i', 'f_l', 'f_f_i', 'f_f_l', 'x_y', 'ij',
+                 'a.alt1', 'a.alt2', 'acutecomb'])
+    cmap = {0x20: 'space', 0x133: 'ij', 0x301: 'acutecomb'}
+    for g in LOWER:
+        cmap[ord(g)] = g
+    fea = """
+languagesystem DFLT dflt;
+languagesystem latn dflt;
+
+@lower = [%s];
+@lower_sc = [%s];
+
+table GDEF {
+    GlyphClassDef @lower, [f_f f_i f_l f_f_i f_f_l x_y], [acutecomb], ;
+} GDEF;
+
+feature ccmp {
+    sub ij by i j;
+} ccmp;
+
+feature liga {
+    lookupflag IgnoreMarks;
+    sub f f i by f_f_i;
+    sub f f l by f_f_l;
+    sub f f by f_f;
+    sub f i by f_i;
+    sub f l by f_l;
+} liga;
+
+lookup ALT1 {
+    sub a by a.alt1;
+} ALT1;
+
+lookup XLIG {
+    sub x y by x_y;
+} XLIG;
+
+lookup DROPZ {
+    lookupflag IgnoreLigatures;
+    sub a' z by a.alt2;
+} DROPZ;
+
+feature calt {
+    sub q a' lookup ALT1;
+    sub a' lookup ALT1 [j j.sc];
+    sub o x' lookup XLIG y;
+} calt;
+
+feature salt {
+    sub a from [a.alt1 a.alt2];
+} salt;
+
+feature smcp {
+    sub @lower by @lower_sc;
+} smcp;
+
+feature dlig {
+    lookup DROPZ;
+} dlig;
+""" % (' '.join(LOWER), ' '.join(sc))
+    build('otf/shape.ttf', glyphs, cmap, fea, marks=('acutecomb',))
+
+
+def many_font():
+    rng = random.Random(1)
+    nbase = 2000
+    base = ['g%04d' % i for i in range(nbase)]
+    glyphs = ['space'] + LOWER + base
+    cmap = {0x20: 'space'}
+    for g in LOWER:
+        cmap[ord(g)] = g
+    pool = LOWER + base
+    lines = ['languagesystem DFLT dflt;', 'languagesystem latn dflt;']
+    features = {}
+    for i in range(200):
+        kind = i % 4
+        lines.append('lookup L%d {' % i)
+        if kind == 0:
+            # single substitutions from the encoded glyphs
+            for g in LOWER:
+                lines.append('    sub %s by %s;' % (g, rng.choice(base)))
+        elif kind == 1:
+            # ligatures of encoded glyphs
+            seen = set()
+            for _ in range(60):
+                a, b = rng.choice(LOWER), rng.choice(LOWER)
+                if (a, b) not in seen:
+                    seen.add((a, b))
+                    lines.append('    sub %s %s by %s;' % (a, b, rng.choice(base)))
+        elif kind == 2:
+            # alternates
+            for g in LOWER:
+                alts = ' '.join(rng.sample(base, 3))
+                lines.append('    sub %s from [%s];' % (g, alts))
+        else:
+            # single substitutions over the whole glyph set
+            for g in rng.sample(pool, 400):
+                lines.append('    sub %s by %s;' % (g, rng.choice(base)))
+        lines.append('} L%d;' % i)
+        tag = ('ss%02d' % (1 + i % 20), 'liga', 'salt', 'calt')[kind]
+        features.setdefault(tag, []).append(i)
+    lines.append('lookup KERN {')
+    for _ in range(3000):
+        lines.append('    pos %s %s %d;' % (rng.choice(LOWER), rng.choice(pool),
+                                            -rng.randrange(1, 80)))
+    lines.append('} KERN;')
+    for tag in sorted(features):
+        lines.append('feature %s {' % tag)
+        for i in features[tag]:
+            lines.append('    lookup L%d;' % i)
+        lines.append('} %s;' % tag)
+    lines.append('feature kern { lookup KERN; } kern;')
+    build('otf/many.ttf', glyphs, cmap, '\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    if not os.path.isdir('otf'):
+        os.mkdir('otf')
+    shape_font()
+    many_font()
@@ -0,0 +1,159 @@
+/* otftotfm-bench.cc -- time otftotfm's layout phases on a large font
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/otf.hh>
+#include <efont/otflayout.hh>
+#include <lcdf/error.hh>
+#include <lcdf/parallel.hh>
+#include <lcdf/straccum.hh>
+#include "conversion.hh"
+#include "glyphfilter.hh"
+#include "profile.hh"
+#include "util.hh"
+#include "testutil.hh"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Converts otf/many.ttf (200 GSUB lookups, from mktestfont.py) in memory
+// with every feature on, and reports the time spent in the GSUB and GPOS
+// phases and in the whole conversion, with --jobs=1 and with more threads.
+// Then compares --jobs=1 conversions without a layout snapshot, while
+// creating one, and reading an existing one from --layout-cache.  Other
+// fonts may be given on the command line; they are converted with
+// otf/shape.enc.
+
+enum { ROUNDS = 10 };
+
+static const char * const features[] = {
+    "calt", "kern", "liga", "salt", "ss01", "ss05", "ss09", "ss13", "ss17"
+};
+
+static String
+read_file(const String &filename)
+{
+    StringAccum sa;
+    if (FILE *f = fopen(filename.c_str(), "rb")) {
+        char buf[BUFSIZ];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            sa.append(buf, n);
+        fclose(f);
+    } else
+        perror(filename.c_str());
+    return sa.take_string();
+}
+
+struct Times {
+    double gsub;
+    double gpos;
+    double total;
+};
+
+// If remove_file is set, it is removed before each round, so every round
+// creates a fresh layout snapshot.
+static Times
+run(const String &filename, const String &data, const ConversionOptions &copt,
+    const String &remove_file = String())
+{
+    Times best = { 1e9, 1e9, 1e9 };
+    for (int round = 0; round < ROUNDS; ++round) {
+        if (remove_file)
+            unlink(remove_file.c_str());
+        double gsub0 = profile_phase_time(P_GSUB);
+        double gpos0 = profile_phase_time(P_GPOS);
+        double t0 = test_timestamp();
+        ConversionContext cc(copt);
+        if (cc.convert_file(filename, data, ErrorHandler::silent_handler()) < 0)
+            fprintf(stderr, "%s: conversion failed\n", filename.c_str());
+        Times t = { profile_phase_time(P_GSUB) - gsub0,
+                    profile_phase_time(P_GPOS) - gpos0,
+                    test_timestamp() - t0 };
+        best.gsub = (t.gsub < best.gsub ? t.gsub : best.gsub);
+        best.gpos = (t.gpos < best.gpos ? t.gpos : best.gpos);
+        best.total = (t.total < best.total ? t.total : best.total);
+    }
+    return best;
+}
+
+static void
+bench(const String &filename)
+{
+    String data = read_file(filename);
+    if (!data)
+        return;
+    static GlyphFilter null_filter;
+    ConversionOptions copt;
+    copt.encoding_file = TEST_SRCDIR "/otf/shape.enc";
+    for (size_t i = 0; i < sizeof(features) / sizeof(features[0]); ++i) {
+        Efont::OpenType::Tag t(features[i]);
+        copt.interesting_features.push_back(t);
+        copt.feature_filters.insert(t, &null_filter);
+    }
+    copt.output_flags = G_METRICS | G_VMETRICS | G_ASCII;
+    copt.in_memory = true;
+
+    const char *slash = strrchr(filename.c_str(), '/');
+    printf("%s\n", slash ? slash + 1 : filename.c_str());
+    int njobs[] = { 1, 2, 4, default_parallel_jobs() };
+    for (int j = 0; j < 4; ++j) {
+        if (j == 3 && njobs[3] <= 4)
+            break;
+        parallel_jobs = njobs[j];
+        Times t = run(filename, data, copt);
+        printf("  --jobs=%-3d  gsub %8.2f ms  gpos %8.2f ms  total %8.2f ms\n",
+               njobs[j], t.gsub * 1000, t.gpos * 1000, t.total * 1000);
+    }
+
+    Efont::OpenType::Font otf(data, ErrorHandler::silent_handler());
+    String dir = "/tmp/otftotfm-bench.XXXXXX";
+    if (!otf.ok() || !mkdtemp(dir.mutable_c_str()))
+        return;
+    String key = Efont::OpenType::LayoutSnapshot::font_key(otf);
+    String snapshot = dir + "/" + Efont::OpenType::LayoutSnapshot::key_text(key) + ".otls";
+    parallel_jobs = 1;
+    for (int which = 0; which < 3; ++which) {
+        static const char * const names[] = { "no snapshot", "create snapshot", "read snapshot" };
+        ConversionOptions scopt(copt);
+        if (which > 0)
+            scopt.layout_cache_dir = dir;
+        Times t = run(filename, data, scopt, which == 1 ? snapshot : String());
+        printf("  %-16s gsub %8.2f ms  gpos %8.2f ms  total %8.2f ms\n",
+               names[which], t.gsub * 1000, t.gpos * 1000, t.total * 1000);
+    }
+    unlink(snapshot.c_str());
+    rmdir(dir.c_str());
+}
+
+int
+main(int argc, char *argv[])
+{
+    ErrorHandler::static_initialize(new FileErrorHandler(stderr));
+    Vector<String> glyphlists;
+    glyphlists.push_back(TEST_SRCDIR "/../glyphlist.txt");
+    glyphlists.push_back(TEST_SRCDIR "/../texglyphlist.txt");
+    load_glyphlists(glyphlists, false, ErrorHandler::default_handler());
+    profile_start(PROFILE_TABLE);
+
+    printf("%d processors\n", default_parallel_jobs());
+    if (argc > 1)
+        for (int i = 1; i < argc; ++i)
+            bench(argv[i]);
+    else
+        bench(TEST_SRCDIR "/otf/many.ttf");
+    return 0;
+}
@@ -0,0 +1,46 @@
+#ifndef TEST_TESTUTIL_HH
+#define TEST_TESTUTIL_HH
+#include <stdio.h>
+#include <time.h>
+#if HAVE_SYS_TIME_H
+# include <sys/time.h>
+#endif
+
+// CHECK(e) reports a failure if e is false.  A test's main() returns
+// test_status(), which is nonzero if any check failed.
+#define CHECK(e)        ((e) ? (void) 0 : test_fail(__FILE__, __LINE__, #e))
+
+inline int &
+test_failures()
+{
+    static int n;
+    return n;
+}
+
+inline void
+test_fail(const char *file, int line, const char *expr)
+{
+    fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+    ++test_failures();
+}
+
+inline int
+test_status()
+{
+    return test_failures() ? 1 : 0;
+}
+
+// Benchmarks report the best of several runs, in seconds.
+inline double
+test_timestamp()
+{
+#if HAVE_SYS_TIME_H
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec / 1000000.;
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+#endif
@@ -0,0 +1,123 @@
+/* thread-test.cc -- stress String, PermString and ErrorHandler on threads
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <lcdf/string.hh>
+#include <lcdf/permstr.hh>
+#include <lcdf/error.hh>
+#include <lcdf/parallel.hh>
+#include "testutil.hh"
+
+// Many items share one String memo, intern the same PermStrings, and
+// report to one ErrorHandler at once.  On every iteration, half the items
+// append to copies of a fresh String while the other half call c_str() on
+// copies of it, so c_str() races appends that claim the byte just past
+// the shared data.  Build with -fsanitize=thread to
+// check for races; without it, the test still checks that reference
+// counts, interning and error counts come out right.
+
+enum { NITEMS = 64, NITER = 2000, NNAMES = 500 };
+
+static PermString::Initializer perm_initializer;
+static SilentErrorHandler shared_errh;
+
+class StressTask : public ParallelTask { public:
+
+    StressTask()
+        : shared("shared-"), names(NITEMS * NNAMES, PermString()),
+          ok(NITEMS, 0) {
+        shared += "base-string"; // leaves room for appends to share the memo
+        // unterminated Strings with room after their data
+        for (int i = 0; i < NITER; ++i) {
+            String s("fresh-");
+            s += String(i);
+            fresh.push_back(s);
+        }
+    }
+
+    void *thread_begin(bool) {
+        return 0;
+    }
+    void run(int item, void *);
+    void thread_end(void *) {
+    }
+
+    String shared;
+    Vector<String> fresh;
+    Vector<PermString> names;
+    Vector<int> ok;
+
+};
+
+void
+StressTask::run(int item, void *)
+{
+    bool good = true;
+    for (int i = 0; i < NITER; ++i) {
+        String a = shared;
+        String b = a;
+        b += (char) ('a' + item % 26);
+        good = good && b.length() == shared.length() + 1
+            && b.substring(0, -1) == shared;
+        good = good && strcmp(a.c_str(), "shared-base-string") == 0;
+        String c = shared.substring(0, 6);
+        good = good && strcmp(c.c_str(), "shared") == 0;
+
+        String f = fresh[i];
+        if (item % 2) {
+            f += 'x';
+            good = good && f.length() == fresh[i].length() + 1
+                && f.back() == 'x';
+        } else {
+            const char *cs = f.c_str();
+            good = good && strlen(cs) == (size_t) f.length()
+                && memcmp(cs, "fresh-", 6) == 0;
+        }
+
+        int n = (i + item) % NNAMES;
+        PermString p = permprintf("name%d", n);
+        PermString q(String("name" + String(n)).c_str());
+        good = good && p == q;
+        names[item * NNAMES + n] = p;
+
+        shared_errh.error("stress %d", i);
+        DeferredErrorHandler d;
+        d.warning("deferred");
+        d.error("deferred");
+        good = good && d.nerrors() == 1;
+    }
+    ok[item] = good;
+}
+
+int
+main()
+{
+    ErrorHandler::static_initialize(new FileErrorHandler(stderr));
+    parallel_jobs = 8;
+
+    StressTask task;
+    run_parallel(task, NITEMS);
+
+    for (int item = 0; item < NITEMS; ++item)
+        CHECK(task.ok[item]);
+    // every item interned every name, and all got the same PermString
+    for (int n = 0; n < NNAMES; ++n)
+        for (int item = 1; item < NITEMS; ++item)
+            CHECK(task.names[item * NNAMES + n].c_str()
+                  == task.names[n].c_str());
+    CHECK(shared_errh.nerrors() == NITEMS * NITER);
+    CHECK(task.shared == "shared-base-string");
+    return test_status();
+}
@@ -0,0 +1,50 @@
+/* uniprop-bench.cc -- time UnicodeProperty lookups
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include "uniprop-old.hh"
+#include "testutil.hh"
+
+// Look up every code point, and the Basic Multilingual Plane letters that
+// otftotfm's glyph filters see most often, with both tables.
+
+template <typename P> static double
+time_lookups(uint32_t first, uint32_t last, int rounds, unsigned &sum)
+{
+    double best = 1e9;
+    for (int r = 0; r < 5; ++r) {
+        double t0 = test_timestamp();
+        for (int i = 0; i < rounds; ++i)
+            for (uint32_t u = first; u <= last; ++u)
+                sum += P::property(u);
+        double t = test_timestamp() - t0;
+        if (t < best)
+            best = t;
+    }
+    return best * 1e9 / ((double) rounds * (last - first + 1));
+}
+
+int
+main(int, char *[])
+{
+    unsigned sum = 0;
+    double old_all = time_lookups<OldUnicodeProperty>(0, 0x10FFFF, 1, sum);
+    double new_all = time_lookups<UnicodeProperty>(0, 0x10FFFF, 1, sum);
+    double old_latin = time_lookups<OldUnicodeProperty>(0x20, 0x24F, 200, sum);
+    double new_latin = time_lookups<UnicodeProperty>(0x20, 0x24F, 200, sum);
+    printf("all code points: old %.2f ns, new %.2f ns per lookup\n", old_all, new_all);
+    printf("U+0020-U+024F:   old %.2f ns, new %.2f ns per lookup\n", old_latin, new_latin);
+    return sum == 0;            // keep the loops
+}
@@ -0,0 +1,20 @@
+#ifndef TEST_UNIPROP_OLD_HH
+#define TEST_UNIPROP_OLD_HH
+#include "uniprop.hh"
+
+class OldUnicodeProperty : public UnicodeProperty { public:
+
+    static int property(uint32_t uni);
+
+  private:
+
+    enum { P_Lul = 070 };
+    static const unsigned char property_pages[];
+    static const unsigned int property_offsets[];
+    static const int nproperty_offsets;
+
+    static inline const unsigned int* find_offset(uint32_t uni);
+
+};
+
+#endif
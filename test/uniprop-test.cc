@@ -0,0 +1,143 @@
+/* uniprop-test.cc -- check the two-stage UnicodeProperty table
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include "uniprop-old.hh"
+#include "testutil.hh"
+
+// uniprop.cc is generated from Unicode 16.0.  The test checks it against
+// that version's per-category totals and some characters it added, and
+// against the old binary-search table, which is Unicode 9.0.
+
+// Code points assigned in Unicode 16.0, by general category, from
+// DerivedGeneralCategory.txt.
+static const struct {
+    int property;
+    uint32_t count;
+} category_counts[] = {
+    { UnicodeProperty::P_Cn, 819533 }, { UnicodeProperty::P_Co, 137468 },
+    { UnicodeProperty::P_Cs, 2048 }, { UnicodeProperty::P_Cf, 170 },
+    { UnicodeProperty::P_Cc, 65 },
+    { UnicodeProperty::P_Zs, 17 }, { UnicodeProperty::P_Zl, 1 },
+    { UnicodeProperty::P_Zp, 1 },
+    { UnicodeProperty::P_Mn, 2020 }, { UnicodeProperty::P_Mc, 468 },
+    { UnicodeProperty::P_Me, 13 },
+    { UnicodeProperty::P_Lo, 136477 }, { UnicodeProperty::P_Lu, 1858 },
+    { UnicodeProperty::P_Ll, 2258 }, { UnicodeProperty::P_Lt, 31 },
+    { UnicodeProperty::P_Lm, 404 },
+    { UnicodeProperty::P_No, 915 }, { UnicodeProperty::P_Nd, 760 },
+    { UnicodeProperty::P_Nl, 236 },
+    { UnicodeProperty::P_Po, 640 }, { UnicodeProperty::P_Pc, 10 },
+    { UnicodeProperty::P_Pd, 27 }, { UnicodeProperty::P_Ps, 79 },
+    { UnicodeProperty::P_Pe, 77 }, { UnicodeProperty::P_Pi, 12 },
+    { UnicodeProperty::P_Pf, 10 },
+    { UnicodeProperty::P_So, 7376 }, { UnicodeProperty::P_Sm, 950 },
+    { UnicodeProperty::P_Sc, 63 }, { UnicodeProperty::P_Sk, 125 }
+};
+
+// Code points the old table assigned whose category changed since 9.0.
+static const struct {
+    uint32_t first, last;
+    int property;
+} changed[] = {
+    { 0x10D0, 0x10FA, UnicodeProperty::P_Ll },  // Georgian Mtavruli, 11.0
+    { 0x10FD, 0x10FF, UnicodeProperty::P_Ll },
+    { 0x166D, 0x166D, UnicodeProperty::P_So },  // 12.0
+    { 0x1734, 0x1734, UnicodeProperty::P_Mc },  // 14.0
+    { 0x1CF2, 0x1CF3, UnicodeProperty::P_Lo },  // 12.0
+    { 0xA9BD, 0xA9BD, UnicodeProperty::P_Mn },  // 12.0
+    { 0x111C9, 0x111C9, UnicodeProperty::P_Mn }, // 11.0
+    { 0x1171E, 0x1171E, UnicodeProperty::P_Mc }  // 16.0
+};
+
+// Characters added after 9.0.
+static const struct {
+    uint32_t u;
+    int property;
+} added[] = {
+    { 0x20C0, UnicodeProperty::P_Sc },          // SOM SIGN, 14.0
+    { 0x0CF3, UnicodeProperty::P_Mc },          // 15.0
+    { 0x1F6DC, UnicodeProperty::P_So },         // WIRELESS, 15.0
+    { 0x31350, UnicodeProperty::P_Lo },         // CJK Extension H, 15.0
+    { 0x2EBF0, UnicodeProperty::P_Lo },         // CJK Extension I, 15.1
+    { 0x0897, UnicodeProperty::P_Mn },          // 16.0
+    { 0x1C89, UnicodeProperty::P_Lu },          // 16.0
+    { 0x1CC00, UnicodeProperty::P_So },         // 16.0
+    { 0x1E5F0, UnicodeProperty::P_Lo }          // Ol Onal, 16.0
+};
+
+static int
+expected_property(uint32_t u)
+{
+    for (size_t i = 0; i < sizeof(changed) / sizeof(changed[0]); ++i)
+        if (u >= changed[i].first && u <= changed[i].last)
+            return changed[i].property;
+    return OldUnicodeProperty::property(u);
+}
+
+int
+main(int, char *[])
+{
+    uint32_t counts[UnicodeProperty::P_MAX + 1] = { 0 };
+    int nchanged = 0, nassigned = 0;
+    for (uint32_t u = 0; u < 0x110000; ++u) {
+        int old_prop = OldUnicodeProperty::property(u);
+        int new_prop = UnicodeProperty::property(u);
+        ++counts[new_prop];
+        if (old_prop == UnicodeProperty::P_Cn) {
+            nassigned += new_prop != UnicodeProperty::P_Cn;
+            continue;
+        }
+        if (new_prop != expected_property(u)) {
+            fprintf(stderr, "U+%04X: %s, expected %s\n", u,
+                    UnicodeProperty::property_name(new_prop),
+                    UnicodeProperty::property_name(expected_property(u)));
+            CHECK(new_prop == expected_property(u));
+        }
+        nchanged += new_prop != old_prop;
+    }
+    CHECK(nchanged == 53);
+    CHECK(nassigned > 0);
+
+    uint32_t total = 0;
+    for (size_t i = 0; i < sizeof(category_counts) / sizeof(category_counts[0]); ++i) {
+        int p = category_counts[i].property;
+        if (counts[p] != category_counts[i].count)
+            fprintf(stderr, "%s: %u code points, expected %u\n",
+                    UnicodeProperty::property_name(p), counts[p],
+                    category_counts[i].count);
+        CHECK(counts[p] == category_counts[i].count);
+        total += category_counts[i].count;
+    }
+    CHECK(total == 0x110000);
+
+    for (size_t i = 0; i < sizeof(added) / sizeof(added[0]); ++i) {
+        CHECK(OldUnicodeProperty::property(added[i].u) == UnicodeProperty::P_Cn);
+        CHECK(UnicodeProperty::property(added[i].u) == added[i].property);
+    }
+
+    // out of range and special cases
+    CHECK(UnicodeProperty::property(0x110000) == UnicodeProperty::P_Cn);
+    CHECK(UnicodeProperty::property(0xFFFFFFFFU) == UnicodeProperty::P_Cn);
+    CHECK(UnicodeProperty::property(0xD800) == UnicodeProperty::P_Cs);
+    CHECK(UnicodeProperty::property(0xE000) == UnicodeProperty::P_Co);
+    CHECK(UnicodeProperty::property(0x10FFFD) == UnicodeProperty::P_Co);
+    CHECK(UnicodeProperty::property(0x20000) == UnicodeProperty::P_Lo);
+    CHECK(UnicodeProperty::property('A') == UnicodeProperty::P_Lu);
+    CHECK(UnicodeProperty::property('a') == UnicodeProperty::P_Ll);
+
+    printf("%d code points changed category, %d newly assigned\n", nchanged, nassigned);
+    return test_status();
+}
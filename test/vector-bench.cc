@@ -0,0 +1,169 @@
+/* vector-bench.cc -- time Vector on otftotfm's GSUB-phase element types
+ *
+ * Copyright (c) 2003-2019 Eddie Kohler
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option)
+ * any later version. This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+#include <efont/otf.hh>
+#include <efont/otfgsub.hh>
+#include <efont/otfpost.hh>
+#include <lcdf/error.hh>
+#include <lcdf/straccum.hh>
+#include <lcdf/vector.hh>
+#include "vector-old.hh"
+#include "testutil.hh"
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+using namespace Efont::OpenType;
+
+// Replays the Vector traffic of otftotfm's GSUB phase with Vector and
+// with OldVector: collecting a font's unparsed substitutions and sorting
+// them, growing an encoding of Metrics::Char-like entries that hold
+// nested Vectors, and inserting glyph names at the front of a list.  The
+// default font comes from mktestfont.py; other fonts may be given on the
+// command line.
+
+enum { ROUNDS = 20, NCHARS = 4096 };
+
+static String
+read_file(const String &filename)
+{
+    StringAccum sa;
+    if (FILE *f = fopen(filename.c_str(), "rb")) {
+        char buf[BUFSIZ];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            sa.append(buf, n);
+        fclose(f);
+    } else
+        perror(filename.c_str());
+    return sa.take_string();
+}
+
+// Shaped like Metrics::Char, which is private to Metrics.
+struct Char {
+    Glyph glyph;
+    Vector<int> ligatures;
+    Vector<int> kerns;
+    int flags;
+};
+
+static bool
+substitution_less(const Substitution &a, const Substitution &b)
+{
+    return a.in_glyph() < b.in_glyph();
+}
+
+template <template <class> class V> static double
+time_substitutions(const Vector<Substitution> &subs)
+{
+    double best = 1e9;
+    for (int round = 0; round < ROUNDS; ++round) {
+        double t0 = test_timestamp();
+        V<Substitution> all;
+        for (const Substitution *s = subs.begin(); s != subs.end(); ++s)
+            all.push_back(*s);
+        std::sort(all.begin(), all.end(), substitution_less);
+        double t = test_timestamp() - t0;
+        best = (t < best ? t : best);
+    }
+    return best;
+}
+
+template <template <class> class V> static double
+time_encoding()
+{
+    double best = 1e9;
+    for (int round = 0; round < ROUNDS; ++round) {
+        double t0 = test_timestamp();
+        V<Char> encoding;
+        for (int i = 0; i < NCHARS; ++i) {
+            Char c;
+            c.glyph = i;
+            for (int j = 0; j < 3; ++j)
+                c.ligatures.push_back(i + j);
+            for (int j = 0; j < 8; ++j)
+                c.kerns.push_back(i * j);
+            c.flags = 0;
+            encoding.push_back(c);
+        }
+        double t = test_timestamp() - t0;
+        best = (t < best ? t : best);
+    }
+    return best;
+}
+
+template <template <class> class V> static double
+time_names(const Vector<PermString> &names)
+{
+    double best = 1e9;
+    for (int round = 0; round < ROUNDS; ++round) {
+        double t0 = test_timestamp();
+        V<String> v;
+        for (int i = 0; i < names.size() && i < NCHARS / 4; ++i)
+            v.insert(v.begin(), names[i]);
+        while (v.size())
+            v.erase(v.begin());
+        double t = test_timestamp() - t0;
+        best = (t < best ? t : best);
+    }
+    return best;
+}
+
+static void
+report(const char *what, double old_t, double new_t)
+{
+    printf("  %-26s OldVector %8.2f ms  Vector %8.2f ms  %5.2fx\n",
+           what, old_t * 1000, new_t * 1000, old_t / new_t);
+}
+
+static void
+bench(const String &filename)
+{
+    String data = read_file(filename);
+    Font otf(data);
+    if (!otf.ok())
+        return;
+    Gsub gsub(otf.table("GSUB"), &otf);
+    Coverage all_glyphs(0, 0xFFFF);
+    Vector<Substitution> subs;
+    for (int i = 0; i < gsub.nlookups(); ++i)
+        gsub.lookup(i).unparse_automatics(gsub, subs, all_glyphs);
+    Vector<PermString> names;
+    Post(otf.table("post")).glyph_names(names);
+
+    const char *slash = strrchr(filename.c_str(), '/');
+    printf("%s\n", slash ? slash + 1 : filename.c_str());
+    char buf[64];
+    sprintf(buf, "%d substitutions", subs.size());
+    report(buf, time_substitutions<OldVector>(subs),
+           time_substitutions<Vector>(subs));
+    sprintf(buf, "%d encoding entries", (int) NCHARS);
+    report(buf, time_encoding<OldVector>(), time_encoding<Vector>());
+    sprintf(buf, "%d front inserts", std::min(names.size(), (int) NCHARS / 4));
+    report(buf, time_names<OldVector>(names), time_names<Vector>(names));
+}
+
+int
+main(int argc, char *argv[])
+{
+    ErrorHandler::static_initialize(new FileErrorHandler(stderr));
+    if (argc > 1)
+        for (int i = 1; i < argc; ++i)
+            bench(argv[i]);
+    else
+        bench(TEST_SRCDIR "/otf/many.ttf");
+    return 0;
+}
@@ -0,0 +1,300 @@
+#ifndef TEST_VECTOR_OLD_HH
+#define TEST_VECTOR_OLD_HH
+
+/*
+ * vector.{cc,hh} -- simple array template class
+ * Eddie Kohler
+ *
+ * Copyright (c) 1999-2000 Massachusetts Institute of Technology
+ * Copyright (c) 2001-2003 International Computer Science Institute
+ * Copyright (c) 1999-2019 Eddie Kohler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, subject to the conditions
+ * listed in the Click LICENSE file. These conditions include: you must
+ * preserve this copyright notice, and you cannot mention the copyright
+ * holders in advertising related to the Software without their permission.
+ * The Software is provided WITHOUT ANY WARRANTY, EXPRESS OR IMPLIED. This
+ * notice is a summary of the Click LICENSE file; the license in that file is
+ * legally binding.
+ */
+
+// This is lcdf/vector.{cc,hh} from before move semantics and relocation,
+// renamed OldVector, for comparison by vector-bench.  Growing, inserting
+// and erasing copy each element and destroy the original.
+
+#include <assert.h>
+#include <stdlib.h>
+#include <new>
+
+template <class T>
+class OldVector { public:
+
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef const T& const_access_type;
+
+    typedef int size_type;
+    enum { RESERVE_GROW = (size_type) -1 };
+
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    explicit OldVector()
+	: _l(0), _n(0), _capacity(0) {
+    }
+    explicit OldVector(size_type n, const T &e)
+	: _l(0), _n(0), _capacity(0) {
+	resize(n, e);
+    }
+    // template <class In> ...
+    OldVector(const OldVector<T> &x);
+    ~OldVector();
+
+    OldVector<T>& operator=(const OldVector<T>&);
+    OldVector<T>& assign(size_type n, const T& e = T());
+    // template <class In> ...
+
+    // iterators
+    iterator begin()			{ return _l; }
+    const_iterator begin() const	{ return _l; }
+    iterator end()			{ return _l + _n; }
+    const_iterator end() const		{ return _l + _n; }
+
+    // capacity
+    size_type size() const		{ return _n; }
+    void resize(size_type nn, const T& e = T());
+    size_type capacity() const		{ return _capacity; }
+    bool empty() const			{ return _n == 0; }
+    bool reserve(size_type n)		{ return reserve_and_push_back(n, 0); }
+
+    // element access
+    T &operator[](size_type i) {
+	assert((unsigned) i < (unsigned) _n);
+	return _l[i];
+    }
+    const T &operator[](size_type i) const {
+	assert((unsigned) i < (unsigned) _n);
+	return _l[i];
+    }
+    T& at(size_type i)			{ return operator[](i); }
+    const T& at(size_type i) const	{ return operator[](i); }
+    T& front()				{ return operator[](0); }
+    const T& front() const		{ return operator[](0); }
+    T& back()				{ return operator[](_n - 1); }
+    const T& back() const		{ return operator[](_n - 1); }
+    T& at_u(size_type i)		{ return _l[i]; }
+    const T& at_u(size_type i) const	{ return _l[i]; }
+
+    // modifiers
+    inline void push_back(const T& x);
+    inline void pop_back();
+    inline void push_front(const T& x);
+    inline void pop_front();
+    iterator insert(iterator it, const T& x);
+    inline iterator erase(iterator it);
+    iterator erase(iterator a, iterator b);
+    void swap(OldVector<T>& x);
+    void clear()			{ erase(begin(), end()); }
+
+ private:
+
+    T *_l;
+    size_type _n;
+    size_type _capacity;
+
+    void *velt(size_type i) const		{ return (void *)&_l[i]; }
+    static void *velt(T *l, size_type i)	{ return (void *)&l[i]; }
+    bool reserve_and_push_back(size_type n, const T *x);
+
+};
+
+template <class T> inline void
+OldVector<T>::push_back(const T& x)
+{
+    if (_n < _capacity) {
+	new(velt(_n)) T(x);
+	++_n;
+    } else
+	reserve_and_push_back(RESERVE_GROW, &x);
+}
+
+template <class T> inline void
+OldVector<T>::pop_back()
+{
+    assert(_n > 0);
+    --_n;
+    _l[_n].~T();
+}
+
+template <class T> inline typename OldVector<T>::iterator
+OldVector<T>::erase(iterator it)
+{
+    return (it < end() ? erase(it, it + 1) : it);
+}
+
+template <class T> inline void
+OldVector<T>::push_front(const T& x)
+{
+    insert(begin(), x);
+}
+
+template <class T> inline void
+OldVector<T>::pop_front()
+{
+    erase(begin());
+}
+
+template <class T>
+OldVector<T>::OldVector(const OldVector<T> &x)
+    : _l(0), _n(0), _capacity(0)
+{
+    *this = x;
+}
+
+template <class T>
+OldVector<T>::~OldVector()
+{
+    for (size_type i = 0; i < _n; i++)
+	_l[i].~T();
+    delete[] (unsigned char *)_l;
+}
+
+template <class T> OldVector<T> &
+OldVector<T>::operator=(const OldVector<T> &o)
+{
+    if (&o != this) {
+	for (size_type i = 0; i < _n; i++)
+	    _l[i].~T();
+	_n = 0;
+	if (reserve(o._n)) {
+	    _n = o._n;
+	    for (size_type i = 0; i < _n; i++)
+		new(velt(i)) T(o._l[i]);
+	}
+    }
+    return *this;
+}
+
+template <class T> OldVector<T> &
+OldVector<T>::assign(size_type n, const T &x)
+{
+    if (&x >= begin() && &x < end()) {
+	T x_copy(x);
+	return assign(n, x_copy);
+    } else {
+	resize(0, x);
+	resize(n, x);
+	return *this;
+    }
+}
+
+template <class T> typename OldVector<T>::iterator
+OldVector<T>::insert(iterator it, const T &x)
+{
+    assert(it >= begin() && it <= end());
+    if (&x >= begin() && &x < end()) {
+	T x_copy(x);
+	return insert(it, x_copy);
+    }
+    if (_n == _capacity) {
+	size_type pos = it - begin();
+	if (!reserve(RESERVE_GROW))
+	    return end();
+	it = begin() + pos;
+    }
+    for (iterator j = end(); j > it; ) {
+	--j;
+	new((void*) (j + 1)) T(*j);
+	j->~T();
+    }
+    new((void*) it) T(x);
+    _n++;
+    return it;
+}
+
+template <class T> typename OldVector<T>::iterator
+OldVector<T>::erase(iterator a, iterator b)
+{
+    if (b > a) {
+	assert(a >= begin() && b <= end());
+	iterator i = a, j = b;
+	for (; j < end(); i++, j++) {
+	    i->~T();
+	    new((void*) i) T(*j);
+	}
+	for (; i < end(); i++)
+	    i->~T();
+	_n -= b - a;
+	return a;
+    } else
+	return b;
+}
+
+template <class T> bool
+OldVector<T>::reserve_and_push_back(size_type want, const T *push_x)
+{
+    if (push_x && push_x >= begin() && push_x < end()) {
+	T x_copy(*push_x);
+	return reserve_and_push_back(want, &x_copy);
+    }
+
+    if (want < 0)
+	want = (_capacity > 0 ? _capacity * 2 : 4);
+
+    if (want > _capacity) {
+	T *new_l = (T *)new unsigned char[sizeof(T) * want];
+	if (!new_l)
+	    return false;
+
+	for (size_type i = 0; i < _n; i++) {
+	    new(velt(new_l, i)) T(_l[i]);
+	    _l[i].~T();
+	}
+	delete[] (unsigned char *)_l;
+
+	_l = new_l;
+	_capacity = want;
+    }
+
+    if (push_x)
+	push_back(*push_x);
+    return true;
+}
+
+template <class T> void
+OldVector<T>::resize(size_type n, const T &x)
+{
+    if (&x >= begin() && &x < end()) {
+	T x_copy(x);
+	resize(n, x_copy);
+    } else if (n <= _capacity || reserve(n)) {
+	for (size_type i = n; i < _n; i++)
+	    _l[i].~T();
+	for (size_type i = _n; i < n; i++)
+	    new(velt(i)) T(x);
+	_n = n;
+    }
+}
+
+template <class T> void
+OldVector<T>::swap(OldVector<T> &x)
+{
+    T *l = _l;
+    _l = x._l;
+    x._l = l;
+
+    size_type n = _n;
+    _n = x._n;
+    x._n = n;
+
+    size_type cap = _capacity;
+    _capacity = x._capacity;
+    x._capacity = cap;
+}
+
+#endif